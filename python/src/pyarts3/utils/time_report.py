@@ -7,13 +7,9 @@ from matplotlib import cm
 def time_report(*, mode="plot", clear=True, scale=1.0, fig=None, mintime=None):
     """Plots the time report.
 
-    The time report is available only when
-    ARTS has been compiled with the CMake option ``-DENABLE_ARTS_PROFILING=ON``,
-    which is not part of the default distribution.
-
-    Nevertheless, there is enough helpful parts in being able to see the
-    state of parallelism and report the time of internal methods that
-    this method is part of the distribution.
+    Methods are only timed while profiling is on.  Turn it on with
+    ``pyarts.arts.globals.set_profiling(True)``, or compile ARTS with the
+    CMake option ``-DENABLE_ARTS_PROFILING=ON`` to have it on from the start.
 
     There is a cost in terms of performance to having the time report
     enabled, so it should not be used in production runs.
@@ -33,7 +33,9 @@ def save(var, filename, precision='.7e', format='ascii', comment=None,
         filename (str): Name of output XML file.
             If the name ends in .gz, the file is compressed on the fly.
         precision (str): Format for output precision.
-        format (str): Output format: 'ascii' (default) or 'binary'.
+        format (str): Output format: 'ascii' (default), 'binary', or 'cbinary'.
+            The latter is binary data deflated in independent blocks, which
+            are inflated in parallel when reading.
         comment (str): Comment string included in a tag above data.
         parents (bool): Create missing parent directories.
 
@@ -4,11 +4,19 @@
 #include <arts_omp.h>
 #include <mystring.h>
 
+#include <algorithm>
+#include <atomic>
+#include <format>
+#include <limits>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <print>
+#include <span>
 #include <unordered_map>
 
+namespace stdr = std::ranges;
+
 namespace arts {
 namespace {
 std::string short_name(const std::string& name) {
@@ -24,64 +32,409 @@ std::string short_name(const std::string& name) {
   return join(s2, " ");
 }
 
-TimeReport profile_report;
-std::mutex mprofile_report;
+using steady = std::chrono::steady_clock;
 }  // namespace
 
-profiler::profiler(std::string&& key) : name(std::move(key)), start(std::chrono::system_clock::now()) {}
+std::atomic<bool> detail::profiling_on{
+#if ARTS_PROFILING
+    true
+#else
+    false
+#endif
+};
+
+/*! The scopes closed by one thread but not yet collected
+
+  Only the owning thread writes events and moves the head.  Collection
+  moves the tail, always under the lock of the profile store, so the
+  owning thread never waits unless the ring is full.
+
+  The ring starts empty and grows when it is full, up to max_capacity.
+  It is resized and released only under the lock, and only while the
+  owning thread is not between opening and closing a scope.
+*/
+struct profile_buffer {
+  static constexpr Size min_capacity = 1 << 8;
+  static constexpr Size max_capacity = 1 << 14;
+
+  Size id;
+  int  core;
+
+  //! The number of open scopes, written only by the owning thread
+  std::atomic<std::uint32_t> depth{0};
+
+  std::atomic<Size> head{0};
+  std::atomic<Size> tail{0};
+
+  std::vector<profile_event> ring;
+
+  profile_buffer(Size i, int c) : id(i), core(c) {}
+};
+
+namespace {
+struct profile_store {
+  std::mutex mtx;
+
+  steady::time_point start{steady::now()};
+  time_t            epoch{std::chrono::system_clock::now()};
+
+  std::vector<std::string>                       names;
+  std::unordered_map<std::string, std::uint32_t> name_ids;
+
+  std::vector<std::shared_ptr<profile_buffer>> buffers;
+  std::vector<std::vector<profile_event>>      events;
 
-profiler::profiler(std::source_location loc) : profiler(short_name(loc.function_name())) {}
+  //! Moves the events from the ring to events, requires mtx
+  void drain(profile_buffer& buf) {
+    const Size t = buf.tail.load(std::memory_order_relaxed);
+    const Size h = buf.head.load(std::memory_order_acquire);
 
-profiler::~profiler() {
-  const time_t end{std::chrono::system_clock::now()};
-  const int    core = arts_omp_get_thread_num();
+    auto& out = events[buf.id];
+    for (Size i = t; i < h; i++) out.push_back(buf.ring[i % buf.ring.size()]);
 
-  // Lock might add extra pause inbetween thread calls, but it is safe
-  std::scoped_lock lock{mprofile_report};
-  profile_report[core][name].emplace_back(start, end);
+    buf.tail.store(h, std::memory_order_release);
+  }
+
+  //! Drains and frees the ring, requires mtx and that no scope is open on the thread
+  void release(profile_buffer& buf) {
+    drain(buf);
+    buf.ring = std::vector<profile_event>{};
+  }
+
+  std::uint32_t intern(std::string&& name) {
+    std::scoped_lock lock{mtx};
+    auto [ptr, is_new] = name_ids.try_emplace(name, static_cast<std::uint32_t>(names.size()));
+    if (is_new) names.push_back(std::move(name));
+    return ptr->second;
+  }
+
+  std::shared_ptr<profile_buffer> add_thread() {
+    std::scoped_lock lock{mtx};
+    buffers.push_back(std::make_shared<profile_buffer>(buffers.size(), arts_omp_get_thread_num()));
+    events.emplace_back();
+    return buffers.back();
+  }
+};
+
+profile_store& store() {
+  static profile_store s;
+  return s;
 }
 
-TimeReport get_report(bool clear) {
-  std::scoped_lock lock{mprofile_report};
+profile_buffer& local_buffer() {
+  thread_local const std::shared_ptr<profile_buffer> buf = store().add_thread();
+  return *buf;
+}
 
-  TimeReport copy = profile_report;
+std::int64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(steady::now() - store().start).count();
+}
 
-  if (clear)
-    for (auto& [key, value] : profile_report) value.clear();
-  return copy;
+void push(profile_buffer& buf, const profile_event& e) {
+  const Size h = buf.head.load(std::memory_order_relaxed);
+  if (h - buf.tail.load(std::memory_order_acquire) == buf.ring.size()) {
+    auto&            s = store();
+    std::scoped_lock lock{s.mtx};
+    s.drain(buf);
+
+    // Empty after the drain, so the positions need not be kept
+    if (buf.ring.size() < profile_buffer::max_capacity) {
+      buf.ring.resize(std::max(profile_buffer::min_capacity, 2 * buf.ring.size()));
+    }
+  }
+
+  buf.ring[h % buf.ring.size()] = e;
+  buf.head.store(h + 1, std::memory_order_release);
 }
 
-void print_report() {
-  const auto report = get_report(false);
-
-  // sort
-  std::map<std::string, std::vector<StartEnd>> merged;
-  for (const auto& [core, core_report] : report) {
-    for (const auto& [name, times] : core_report) {
-      auto& merged_times = merged[name];
-      merged_times.insert(merged_times.end(), times.begin(), times.end());
+/*! Marks a scope as open on the thread of the buffer
+
+  The increment of the depth and the check of the flag pair with the store
+  of the flag and the check of the depth in set_profiling, so either this
+  thread sees that profiling was turned off or set_profiling sees the open
+  scope and keeps the ring.
+
+  @return Whether the scope should be recorded
+*/
+bool enter(profile_buffer& buf) {
+  buf.depth.fetch_add(1);
+  if (detail::profiling_on.load()) return true;
+  buf.depth.fetch_sub(1);
+  return false;
+}
+
+//! The events of a thread in the order they were opened, parents before children
+std::vector<profile_event> opening_order(const std::vector<profile_event>& events) {
+  std::vector<profile_event> out = events;
+  stdr::sort(out, [](const profile_event& a, const profile_event& b) {
+    return a.start < b.start or (a.start == b.start and a.depth < b.depth);
+  });
+  return out;
+}
+
+std::string json_string(const std::string_view s) {
+  std::string out{'"'};
+  for (const char c : s) {
+    switch (c) {
+      case '"':  out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\t': out += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          out += std::format("\\u{:04x}", static_cast<unsigned>(c));
+        } else {
+          out += c;
+        }
+    }
+  }
+  out += '"';
+  return out;
+}
+
+Numeric seconds(const profile_event& e) { return 1e-9 * static_cast<Numeric>(e.end - e.start); }
+
+void set_self(profile_node& node) {
+  node.self = node.total;
+  for (auto& child : node.children) {
+    set_self(child);
+    node.self -= child.total;
+  }
+}
+
+void print_node(const profile_node& node, const Size depth) {
+  const Numeric avg = node.total / static_cast<Numeric>(node.calls);
+
+  const auto [ut, t] = Conversion::metric_prefix(node.total);
+  const auto [us, s] = Conversion::metric_prefix(node.self);
+  const auto [ua, a] = Conversion::metric_prefix(avg);
+  const auto [um, m] = Conversion::metric_prefix(node.min);
+  const auto [ux, x] = Conversion::metric_prefix(node.max);
+
+  std::println("| {}{} | {} | {:.2f} {}s | {:.2f} {}s | {:.2f} {}s | {:.2f} {}s | {:.2f} {}s |",
+               std::string(2 * depth, ' '),
+               node.name,
+               node.calls,
+               t,
+               ut,
+               s,
+               us,
+               a,
+               ua,
+               m,
+               um,
+               x,
+               ux);
+
+  for (auto& child : node.children) print_node(child, depth + 1);
+}
+}  // namespace
+
+void profiler::open(std::string&& key) {
+  thread_local std::unordered_map<std::string, std::uint32_t> ids;
+
+  auto& buf = local_buffer();
+  if (not enter(buf)) return;
+
+  auto ptr = ids.find(key);
+  if (ptr == ids.end()) ptr = ids.emplace(key, store().intern(std::string{key})).first;
+
+  buffer = &buf;
+  name   = ptr->second;
+  start  = now();
+}
+
+void profiler::open(std::source_location loc) {
+  // The function name of a source location has static storage
+  thread_local std::unordered_map<const char*, std::uint32_t> ids;
+
+  auto& buf = local_buffer();
+  if (not enter(buf)) return;
+
+  auto ptr = ids.find(loc.function_name());
+  if (ptr == ids.end()) {
+    ptr = ids.emplace(loc.function_name(), store().intern(short_name(loc.function_name()))).first;
+  }
+
+  buffer = &buf;
+  name   = ptr->second;
+  start  = now();
+}
+
+void profiler::close() {
+  const std::int64_t  end   = now();
+  const std::uint32_t depth = buffer->depth.load(std::memory_order_relaxed) - 1;
+
+  // The scope stays open while it is pushed, so the ring cannot be released under it
+  push(*buffer, {.name = name, .depth = depth, .start = start, .end = end});
+  buffer->depth.fetch_sub(1);
+
+  // The outermost scope of a thread that was open when profiling was turned off
+  if (depth == 0 and not detail::profiling_on.load()) {
+    auto&            s = store();
+    std::scoped_lock lock{s.mtx};
+    s.release(*buffer);
+  }
+}
+
+void set_profiling(bool on) {
+  detail::profiling_on.store(on);
+  if (on) return;
+
+  auto&            s = store();
+  std::scoped_lock lock{s.mtx};
+  for (auto& buf : s.buffers) {
+    if (buf->depth.load() == 0) s.release(*buf);
+  }
+}
+
+bool profiling() { return detail::profiling_on.load(std::memory_order_relaxed); }
+
+profile_trace get_trace(bool clear) {
+  auto&            s = store();
+  std::scoped_lock lock{s.mtx};
+
+  profile_trace out{.names = s.names, .threads = {}, .epoch = s.epoch};
+  for (auto& buf : s.buffers) {
+    s.drain(*buf);
+
+    auto& events = s.events[buf->id];
+    if (events.empty()) continue;
+
+    out.threads.push_back({.id = buf->id, .core = buf->core, .events = events});
+    if (clear) events.clear();
+  }
+
+  return out;
+}
+
+profile_node aggregate(const profile_trace& trace) {
+  profile_node root;
+
+  for (auto& thread : trace.threads) {
+    std::vector<std::pair<profile_node*, std::uint32_t>> open;
+
+    for (auto& e : opening_order(thread.events)) {
+      while (not open.empty() and open.back().second >= e.depth) open.pop_back();
+
+      auto& siblings = open.empty() ? root.children : open.back().first->children;
+      auto  ptr      = stdr::find(siblings, trace.names[e.name], &profile_node::name);
+      if (ptr == siblings.end()) {
+        siblings.push_back({.name = trace.names[e.name],
+                            .min  = std::numeric_limits<Numeric>::max(),
+                            .max  = std::numeric_limits<Numeric>::lowest()});
+        ptr = std::prev(siblings.end());
+      }
+
+      const Numeric t  = seconds(e);
+      ptr->calls++;
+      ptr->total      += t;
+      ptr->min         = std::min(ptr->min, t);
+      ptr->max         = std::max(ptr->max, t);
+
+      open.emplace_back(&*ptr, e.depth);
     }
   }
 
-  std::println("| Method | Average Time | Min Time | Max Time | # Calls |");
-  std::println("|---|---|---|---|---|");
-  for (const auto& [name, times] : merged) {
-    Numeric total = 0.0;
-    Numeric max   = std::numeric_limits<Numeric>::lowest();
-    Numeric min   = std::numeric_limits<Numeric>::max();
-    for (const auto& [start, end] : times) {
-      const Numeric t  = std::chrono::duration<Numeric>(end - start).count();
-      total           += t;
-      max              = std::max(max, t);
-      min              = std::min(min, t);
+  for (auto& child : root.children) root.total += child.total;
+  set_self(root);
+  return root;
+}
+
+std::string to_chrome_trace(const profile_trace& trace) {
+  std::string out = R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+  bool first = true;
+  for (auto& thread : trace.threads) {
+    out += std::format(R"({}{{"name":"thread_name","ph":"M","pid":0,"tid":{},"args":{{"name":"Thread {} (OpenMP {})"}}}})",
+                       first ? "" : ",",
+                       thread.id,
+                       thread.id,
+                       thread.core);
+    first = false;
+
+    for (auto& e : thread.events) {
+      out += std::format(R"(,{{"name":{},"cat":"arts","ph":"X","pid":0,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                         json_string(trace.names[e.name]),
+                         thread.id,
+                         1e-3 * static_cast<Numeric>(e.start),
+                         1e-3 * static_cast<Numeric>(e.end - e.start));
     }
-    const Numeric avg = total / static_cast<Numeric>(times.size());
+  }
+
+  out += "]}";
+  return out;
+}
 
-    const auto [ua, a] = Conversion::metric_prefix(avg);
-    const auto [um, m] = Conversion::metric_prefix(min);
-    const auto [ux, x] = Conversion::metric_prefix(max);
+std::string to_speedscope(const profile_trace& trace) {
+  std::string out =
+      R"({"$schema":"https://www.speedscope.app/file-format-schema.json","exporter":"arts","shared":{"frames":[)";
 
-    std::println("| {} | {:.2f} {}s | {:.2f} {}s | {:.2f} {}s | {} |", name, a, ua, m, um, x, ux, times.size());
+  for (Size i = 0; i < trace.names.size(); i++) {
+    out += std::format(R"({}{{"name":{}}})", i == 0 ? "" : ",", json_string(trace.names[i]));
   }
+  out += R"(]},"profiles":[)";
+
+  for (Size it = 0; it < trace.threads.size(); it++) {
+    const auto& thread = trace.threads[it];
+    const auto  events = opening_order(thread.events);
+
+    const std::int64_t t0 = events.front().start;
+    const std::int64_t t1 = stdr::max(events, {}, &profile_event::end).end;
+
+    out += std::format(
+        R"({}{{"type":"evented","name":"Thread {} (OpenMP {})","unit":"nanoseconds","startValue":{},"endValue":{},"events":[)",
+        it == 0 ? "" : ",",
+        thread.id,
+        thread.core,
+        t0,
+        t1);
+
+    // Scopes are closed in reverse order of opening, children before parents
+    std::vector<const profile_event*> open;
+    bool                              first = true;
+    const auto                        close = [&] {
+      out   += std::format(R"({}{{"type":"C","frame":{},"at":{}}})", first ? "" : ",", open.back()->name, open.back()->end);
+      first  = false;
+      open.pop_back();
+    };
+
+    for (auto& e : events) {
+      while (not open.empty() and open.back()->depth >= e.depth) close();
+      out   += std::format(R"({}{{"type":"O","frame":{},"at":{}}})", first ? "" : ",", e.name, e.start);
+      first  = false;
+      open.push_back(&e);
+    }
+    while (not open.empty()) close();
+
+    out += "]}";
+  }
+
+  out += "]}";
+  return out;
+}
+
+TimeReport get_report(bool clear) {
+  const auto trace = get_trace(clear);
+
+  TimeReport report;
+  for (auto& thread : trace.threads) {
+    auto& core = report[thread.core];
+    for (auto& e : thread.events) {
+      core[trace.names[e.name]].emplace_back(
+          trace.epoch + std::chrono::duration_cast<time_t::duration>(std::chrono::nanoseconds{e.start}),
+          trace.epoch + std::chrono::duration_cast<time_t::duration>(std::chrono::nanoseconds{e.end}));
+    }
+  }
+
+  return report;
+}
+
+void print_report() {
+  const auto tree = aggregate(get_trace(false));
+
+  std::println("| Method | # Calls | Total Time | Self Time | Average Time | Min Time | Max Time |");
+  std::println("|---|---|---|---|---|---|---|");
+  for (auto& node : tree.children) print_node(node, 0);
 }
-}  // namespace arts
\ No newline at end of file
+}  // namespace arts
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <configtypes.h>
+
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <source_location>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -11,30 +16,139 @@ using StartEnd        = std::pair<time_t, time_t>;
 using SingleCoreTimer = std::unordered_map<std::string, std::vector<StartEnd>>;
 using TimeReport      = std::unordered_map<int, SingleCoreTimer>;
 
+struct profile_buffer;
+
+namespace detail {
+//! Whether scopes are recorded, see set_profiling
+extern std::atomic<bool> profiling_on;
+}  // namespace detail
+
+/** Times the scope it lives in
+
+  Each thread records its scopes into its own buffer without locking.
+  Scopes that are opened while another scope is open on the same thread
+  are recorded as its children.
+
+  When profiling is off, construction is a single relaxed load of a flag.
+*/
 struct profiler {
-  std::string name;
-  time_t      start;
+  profile_buffer* buffer{nullptr};
+  std::uint32_t   name{};
+  std::int64_t    start{};
 
-  profiler(std::string&& key);
-  profiler(std::source_location loc = std::source_location::current());
+  profiler(std::string&& key) {
+    if (detail::profiling_on.load(std::memory_order_relaxed)) open(std::move(key));
+  }
+
+  profiler(std::source_location loc = std::source_location::current()) {
+    if (detail::profiling_on.load(std::memory_order_relaxed)) open(loc);
+  }
 
   profiler(const profiler&)            = delete;
   profiler(profiler&&)                 = delete;
   profiler& operator=(const profiler&) = delete;
   profiler& operator=(profiler&&)      = delete;
 
-  ~profiler();
+  ~profiler() {
+    if (buffer != nullptr) close();
+  }
+
+ private:
+  void open(std::string&& key);
+  void open(std::source_location loc);
+  void close();
 };
 
+//! A closed scope
+struct profile_event {
+  //! Position of the name in profile_trace::names
+  std::uint32_t name;
+
+  //! The number of scopes that were open on the thread when this scope was opened
+  std::uint32_t depth;
+
+  //! Nanoseconds since profile_trace::epoch
+  std::int64_t start;
+
+  //! Nanoseconds since profile_trace::epoch
+  std::int64_t end;
+};
+
+//! The closed scopes of one thread, ordered by their end
+struct profile_thread {
+  //! Unique for each thread that has been profiled
+  Size id;
+
+  //! The OpenMP thread number of the thread when it was first profiled
+  int core;
+
+  std::vector<profile_event> events;
+};
+
+//! All recorded scopes
+struct profile_trace {
+  std::vector<std::string> names;
+
+  std::vector<profile_thread> threads;
+
+  //! The time of the zero of the events
+  time_t epoch;
+};
+
+//! The aggregated statistics of all calls of a scope with the same parents
+struct profile_node {
+  std::string name{};
+
+  Size calls{};
+
+  //! Total time in seconds, including children
+  Numeric total{};
+
+  //! Total time in seconds, excluding children
+  Numeric self{};
+
+  //! Shortest call in seconds
+  Numeric min{};
+
+  //! Longest call in seconds
+  Numeric max{};
+
+  std::vector<profile_node> children{};
+};
+
+/** Turns recording on or off at runtime
+
+  On by default if ARTS_PROFILING is set.  Turning it off releases the
+  buffers of all threads that have no open scope.
+*/
+void set_profiling(bool on);
+
+[[nodiscard]] bool profiling();
+
+/** Collects the scopes that all threads have closed so far
+
+  @param clear Forget the collected scopes
+  @return The trace
+*/
+profile_trace get_trace(bool clear = true);
+
+/** Merges the calls of the trace into a tree
+
+  Calls with the same name and the same parents are merged, over all
+  threads.  The root has no name, and its total is the sum of its children.
+*/
+profile_node aggregate(const profile_trace& trace);
+
+//! The trace in the Chrome trace event format, readable by chrome://tracing and Perfetto
+std::string to_chrome_trace(const profile_trace& trace);
+
+//! The trace in the speedscope evented format, one profile per thread
+std::string to_speedscope(const profile_trace& trace);
+
 TimeReport get_report(bool clear = true);
 
 void print_report();
 }  // namespace arts
 
-#if ARTS_PROFILING
 #define ARTS_TIME_REPORT                   arts::profiler _arts_prof_var_name_{};
 #define ARTS_NAMED_TIME_REPORT(_name_var_) arts::profiler _arts_named__prof_var_name_{_name_var_};
-#else
-#define ARTS_TIME_REPORT
-#define ARTS_NAMED_TIME_REPORT(_name_var_)
-#endif
@@ -12,8 +12,10 @@
 #include <physics_funcs.h>
 
 #include <algorithm>
+#include <cmath>
 #include <exception>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <type_traits>
@@ -102,23 +104,32 @@ Numeric AtmPoint::number_density() const { return ::number_density(pressure, tem
 Numeric AtmPoint::number_density(const SpeciesEnum &spec) const {
   if (spec == "AIR"_spec) return number_density();
 
-  return specs.at(spec) * number_density();
+  return operator[](spec) * number_density();
 }
 
 Numeric AtmPoint::number_density(const SpeciesIsotope &spec) const {
-  return isots.at(spec) * number_density(spec.spec);
+  return operator[](spec) * number_density(spec.spec);
 }
 
-Numeric AtmPoint::operator[](SpeciesEnum x) const try { return specs.at(x); } catch (std::out_of_range &) {
-  ARTS_USER_ERROR("Species VMR not found: \"{}\"", toString<1>(x))
-}
+Numeric AtmPoint::operator[](SpeciesEnum x) const try {
+  if (frozen_) {
+    if (const Numeric v = (*frozen_)[x]; not std::isnan(v)) return v;
+  }
+  return specs_.at(x);
+} catch (std::out_of_range &) { ARTS_USER_ERROR("Species VMR not found: \"{}\"", toString<1>(x)) }
 
-Numeric AtmPoint::operator[](const SpeciesIsotope &x) const try { return isots.at(x); } catch (std::out_of_range &) {
-  ARTS_USER_ERROR("Isotopologue ratio not found: \"{}\"", x)
-}
+Numeric AtmPoint::operator[](const SpeciesIsotope &x) const try {
+  if (frozen_) {
+    if (const Numeric v = (*frozen_)[x]; not std::isnan(v)) return v;
+  }
+  return isots_.at(x);
+} catch (std::out_of_range &) { ARTS_USER_ERROR("Isotopologue ratio not found: \"{}\"", x) }
 
 Numeric AtmPoint::operator[](const QuantumLevelIdentifier &x) const try {
-  return nlte.at(x);
+  if (frozen_) {
+    if (const Numeric v = (*frozen_)[x]; not std::isnan(v)) return v;
+  }
+  return nlte_.at(x);
 } catch (std::out_of_range &) { ARTS_USER_ERROR("QuantumLevelIdentifier not found: \"{}\"", x) }
 
 Numeric AtmPoint::operator[](const ScatteringSpeciesProperty &x) const try {
@@ -139,11 +150,20 @@ Numeric AtmPoint::operator[](AtmKey x) const {
   std::unreachable();
 }
 
-Numeric &AtmPoint::operator[](SpeciesEnum x) { return specs[x]; }
+Numeric &AtmPoint::operator[](SpeciesEnum x) {
+  thaw();
+  return specs_[x];
+}
 
-Numeric &AtmPoint::operator[](const SpeciesIsotope &x) { return isots[x]; }
+Numeric &AtmPoint::operator[](const SpeciesIsotope &x) {
+  thaw();
+  return isots_[x];
+}
 
-Numeric &AtmPoint::operator[](const QuantumLevelIdentifier &x) { return nlte[x]; }
+Numeric &AtmPoint::operator[](const QuantumLevelIdentifier &x) {
+  thaw();
+  return nlte_[x];
+}
 
 Numeric &AtmPoint::operator[](const ScatteringSpeciesProperty &x) { return ssprops[x]; }
 
@@ -166,6 +186,87 @@ std::pair<Numeric, Numeric> AtmPoint::levels(const QuantumIdentifier &band) cons
 }
 
 namespace Atm {
+FrozenPoint::FrozenPoint(const Point &atm) {
+  constexpr Numeric nan = std::numeric_limits<Numeric>::quiet_NaN();
+
+  specs.fill(nan);
+  for (auto &[key, value] : atm.specs()) {
+    if (good_enum(key)) specs[static_cast<Size>(key)] = value;
+  }
+
+  isots.fill(nan);
+  for (auto &[key, value] : atm.isots()) {
+    if (const Size i = isot_slot(key); i < isots.size()) isots[i] = value;
+  }
+
+  nlte_keys.reserve(atm.nlte().size());
+  for (auto &[key, value] : atm.nlte()) nlte_keys.push_back(key);
+  stdr::sort(nlte_keys);
+
+  nlte.reserve(nlte_keys.size());
+  for (auto &key : nlte_keys) nlte.push_back(atm.nlte().at(key));
+}
+
+Size FrozenPoint::isot_slot(const SpeciesIsotope &x) noexcept {
+  if (not good_enum(x.spec)) return Species::Isotopologues.size();
+
+  const auto spec  = static_cast<Size>(x.spec);
+  const Size first = Species::IsotopologuesStart[spec];
+  const Size last  = Species::IsotopologuesStart[spec + 1];
+
+  for (Size i = first; i < last; i++) {
+    if (Species::Isotopologues[i].isotname.data() == x.isotname.data()) return i;
+  }
+
+  for (Size i = first; i < last; i++) {
+    if (Species::Isotopologues[i].isotname == x.isotname) return i;
+  }
+
+  return Species::Isotopologues.size();
+}
+
+Numeric FrozenPoint::operator[](SpeciesEnum x) const noexcept {
+  return good_enum(x) ? specs[static_cast<Size>(x)] : std::numeric_limits<Numeric>::quiet_NaN();
+}
+
+Numeric FrozenPoint::operator[](const SpeciesIsotope &x) const noexcept {
+  const Size i = isot_slot(x);
+  return i < isots.size() ? isots[i] : std::numeric_limits<Numeric>::quiet_NaN();
+}
+
+Numeric FrozenPoint::operator[](const QuantumLevelIdentifier &x) const noexcept {
+  const auto it = stdr::lower_bound(nlte_keys, x);
+  if (it == nlte_keys.end() or *it != x) return std::numeric_limits<Numeric>::quiet_NaN();
+  return nlte[std::distance(nlte_keys.begin(), it)];
+}
+
+void Point::freeze() { frozen_ = std::make_shared<const FrozenPoint>(*this); }
+
+void Point::thaw() noexcept { frozen_.reset(); }
+
+bool Point::is_frozen() const noexcept { return static_cast<bool>(frozen_); }
+
+void Point::set_specs(SpeciesMap x) {
+  thaw();
+  specs_ = std::move(x);
+}
+
+void Point::set_isots(SpeciesIsotopeMap x) {
+  thaw();
+  isots_ = std::move(x);
+}
+
+void Point::set_nlte(NlteMap x) {
+  thaw();
+  nlte_ = std::move(x);
+}
+
+void Point::reserve(Size nspecs, Size nisots, Size nnlte) {
+  specs_.reserve(nspecs);
+  isots_.reserve(nisots);
+  nlte_.reserve(nnlte);
+}
+
 Point::Point(const IsoRatioOption isots_key) {
   switch (isots_key) {
     case IsoRatioOption::Builtin: {
@@ -173,7 +274,7 @@ Point::Point(const IsoRatioOption isots_key) {
       for (Index i = 0; i < x.maxsize; i++) {
         if (Species::Isotopologues[i].is_joker()) continue;
         if (Species::Isotopologues[i].is_predefined()) continue;
-        isots[Species::Isotopologues[i]] = x.data[i];
+        isots_[Species::Isotopologues[i]] = x.data[i];
       }
     } break;
     case IsoRatioOption::Hitran: {
@@ -181,7 +282,7 @@ Point::Point(const IsoRatioOption isots_key) {
       for (Index i = 0; i < x.maxsize; i++) {
         if (Species::Isotopologues[i].is_joker()) continue;
         if (Species::Isotopologues[i].is_predefined()) continue;
-        isots[Species::Isotopologues[i]] = x.data[i];
+        isots_[Species::Isotopologues[i]] = x.data[i];
       }
     } break;
     case IsoRatioOption::None:
@@ -250,7 +351,7 @@ bool Point::contains(const KeyVal &key) const {
 Numeric Point::mean_mass(SpeciesEnum s) const {
   Numeric ratio = 0.0;
   Numeric mass  = 0.0;
-  for (auto &[isot, this_ratio] : isots) {
+  for (auto &[isot, this_ratio] : isots_) {
     if (isot.spec == s and not(isot.is_predefined() or isot.is_joker())) {
       ratio += this_ratio;
       mass  += this_ratio * isot.mass;
@@ -265,7 +366,7 @@ Numeric Point::mean_mass(SpeciesEnum s) const {
 Numeric Point::mean_mass() const {
   Numeric vmr  = 0.0;
   Numeric mass = 0.0;
-  for (auto &[spec, this_vmr] : specs) {
+  for (auto &[spec, this_vmr] : specs_) {
     vmr += this_vmr;
     if (this_vmr != 0.0) { mass += this_vmr * mean_mass(spec); }
   }
@@ -285,11 +386,11 @@ std::vector<KeyVal> Point::keys(
   }
 
   if (keep_specs) {
-    for (auto &a : specs) out.emplace_back(a.first);
+    for (auto &a : specs_) out.emplace_back(a.first);
   }
 
   if (keep_nlte) {
-    for (auto &a : nlte) out.emplace_back(a.first);
+    for (auto &a : nlte_) out.emplace_back(a.first);
   }
 
   if (keep_ssprops) {
@@ -297,18 +398,18 @@ std::vector<KeyVal> Point::keys(
   }
 
   if (keep_isots) {
-    for (auto &a : isots) out.emplace_back(a.first);
+    for (auto &a : isots_) out.emplace_back(a.first);
   }
   return out;
 }
 
-Index Point::nspec() const { return static_cast<Index>(specs.size()); }
+Index Point::nspec() const { return static_cast<Index>(specs_.size()); }
 
 Index Point::npart() const { return static_cast<Index>(ssprops.size()); }
 
-Index Point::nisot() const { return static_cast<Index>(isots.size()); }
+Index Point::nisot() const { return static_cast<Index>(isots_.size()); }
 
-Index Point::nnlte() const { return static_cast<Index>(nlte.size()); }
+Index Point::nnlte() const { return static_cast<Index>(nlte_.size()); }
 
 Index Point::size() const { return nspec() + nnlte() + nother() + npart() + nisot(); }
 
@@ -507,7 +608,7 @@ ComputeLimit find_limit(const Data &data, const Limits &lim, Numeric alt, Numeri
 }
 }  // namespace
 
-bool Point::is_lte() const noexcept { return nlte.empty(); }
+bool Point::is_lte() const noexcept { return nlte_.empty(); }
 
 namespace {
 template <class Key, class T, class Hash, class KeyEqual, class Allocator>
@@ -548,16 +649,16 @@ void Point::check() {
     errors.emplace_back(std::format(" - Bad magnetic field [mag_u, mag_v, mag_w]: {:B,}", mag));
   }
 
-  if (stdr::any_of(specs | stdv::values, isnan) or stdr::any_of(specs | stdv::values, Cmp::lt(0.0))) {
-    errors.emplace_back(std::format(" - Bad species VMR: {:NB,}", specs));
+  if (stdr::any_of(specs_ | stdv::values, isnan) or stdr::any_of(specs_ | stdv::values, Cmp::lt(0.0))) {
+    errors.emplace_back(std::format(" - Bad species VMR: {:NB,}", specs_));
   }
 
-  if (stdr::any_of(isots | stdv::values, isnan) or stdr::any_of(isots | stdv::values, Cmp::lt(0.0))) {
-    errors.emplace_back(std::format(" - Bad isotopologue ratio: {:NB,}", isots));
+  if (stdr::any_of(isots_ | stdv::values, isnan) or stdr::any_of(isots_ | stdv::values, Cmp::lt(0.0))) {
+    errors.emplace_back(std::format(" - Bad isotopologue ratio: {:NB,}", isots_));
   }
 
-  if (stdr::any_of(nlte | stdv::values, isnan) or stdr::any_of(nlte | stdv::values, Cmp::lt(0.0))) {
-    errors.emplace_back(std::format(" - Bad non-LTE ratio: {:NB,}", nlte));
+  if (stdr::any_of(nlte_ | stdv::values, isnan) or stdr::any_of(nlte_ | stdv::values, Cmp::lt(0.0))) {
+    errors.emplace_back(std::format(" - Bad non-LTE ratio: {:NB,}", nlte_));
   }
 
   if (stdr::any_of(ssprops | stdv::values, isnan)) {
@@ -795,19 +896,65 @@ Numeric Data::at(const Numeric alt, const Numeric lat, const Numeric lon) const
 
 Numeric Data::at(const Vector3 pos) const { return at(pos[0], pos[1], pos[2]); }
 
+void Data::at(VectorView out, const ConstVectorView &alt, const ConstVectorView &lat, const ConstVectorView &lon) const {
+  // Functional data has no limits, so the positions need no adjustment
+  if (is_batched()) {
+    ternary::get_batch(out, std::get<FunctionalData>(data).f, alt, lat, lon);
+    return;
+  }
+
+  ARTS_USER_ERROR_IF(alt.size() != out.size() or lat.size() != out.size() or lon.size() != out.size(),
+                     "Mismatching sizes: out {}, alt {}, lat {}, lon {}",
+                     out.size(),
+                     alt.size(),
+                     lat.size(),
+                     lon.size())
+
+  for (Size i = 0; i < out.size(); i++) out[i] = at(alt[i], lat[i], lon[i]);
+}
+
+bool Data::is_batched() const {
+  const auto *f = get_if<FunctionalData>();
+  return f != nullptr and ternary::is_batched(f->f);
+}
+
 namespace {
 Numeric point_at_error(const Data &data, const Numeric alt, const Numeric lat, const Numeric lon, const auto &key) try {
   return data.at(alt, lat, lon);
 } catch (std::exception &e) {
   throw std::runtime_error(std::format("Error while getting value for key {}: {}", key, e.what()));
 }
-}  // namespace
 
-Point Field::at(const Numeric alt, const Numeric lat, const Numeric lon) const try {
-  ARTS_USER_ERROR_IF(alt > top_of_atmosphere,
+//! Sets all three components of a vector field from one evaluation if they are one vector-valued functional
+bool vector_at(Point                                  &out,
+               const std::unordered_map<AtmKey, Data> &other,
+               const std::array<AtmKey, 3>            &keys,
+               const Numeric                           alt,
+               const Numeric                           lat,
+               const Numeric                           lon) try {
+  std::array<const FunctionalData *, 3> fs{};
+  for (Size i = 0; i < 3; i++) {
+    const auto it = other.find(keys[i]);
+    if (it == other.end()) return false;
+    fs[i] = it->second.get_if<FunctionalData>();
+    if (fs[i] == nullptr) return false;
+  }
+
+  const auto uvw = ternary::get_uvw(fs[0]->f, fs[1]->f, fs[2]->f, alt, lat, lon);
+  if (not uvw) return false;
+
+  for (Size i = 0; i < 3; i++) out[keys[i]] = (*uvw)[i];
+  return true;
+} catch (std::exception &e) {
+  throw std::runtime_error(std::format("Error while getting value for keys {:B,}: {}", keys, e.what()));
+}
+
+//! The values at a point, without the keys of batched functional data if skip_batched
+Point point_at(const Field &field, const Numeric alt, const Numeric lat, const Numeric lon, const bool skip_batched) {
+  ARTS_USER_ERROR_IF(alt > field.top_of_atmosphere,
                      "Cannot get values above the top of the atmosphere, which is at: {}"
                      " m.\nYour max input altitude is: {} m.",
-                     top_of_atmosphere,
+                     field.top_of_atmosphere,
                      alt)
 
   Point out;
@@ -815,23 +962,91 @@ Point Field::at(const Numeric alt, const Numeric lat, const Numeric lon) const t
   static_assert(
       sizeof(AtmField) == sizeof(std::unordered_map<AtmKey, Data>) * 5 + sizeof(Numeric),
       "The loops below must be over all keys, a size change of AtmField indicates that the number of keys have changed");
-  out.specs.reserve(specs.size());
-  out.isots.reserve(isots.size());
-  out.nlte.reserve(nlte.size());
-  out.ssprops.reserve(ssprops.size());
+  out.reserve(field.specs.size(), field.isots.size(), field.nlte.size());
+  out.ssprops.reserve(field.ssprops.size());
 
-  for (auto &[key, data] : other) { out[key] = point_at_error(data, alt, lat, lon, key); }
+  //! The magnetic field components are often one functional, e.g., IGRF
+  constexpr std::array mag_keys{AtmKey::mag_u, AtmKey::mag_v, AtmKey::mag_w};
+  const bool           mag_done = vector_at(out, field.other, mag_keys, alt, lat, lon);
 
-  for (auto &[key, data] : specs) { out[key] = point_at_error(data, alt, lat, lon, key); }
+  for (auto &[key, data] : field.other) {
+    if (mag_done and stdr::contains(mag_keys, key)) continue;
+    if (skip_batched and data.is_batched()) continue;
+    out[key] = point_at_error(data, alt, lat, lon, key);
+  }
 
-  for (auto &[key, data] : isots) { out[key] = point_at_error(data, alt, lat, lon, key); }
+  for (auto &[key, data] : field.specs) {
+    if (skip_batched and data.is_batched()) continue;
+    out[key] = point_at_error(data, alt, lat, lon, key);
+  }
 
-  for (auto &[key, data] : nlte) { out[key] = point_at_error(data, alt, lat, lon, key); }
+  for (auto &[key, data] : field.isots) {
+    if (skip_batched and data.is_batched()) continue;
+    out[key] = point_at_error(data, alt, lat, lon, key);
+  }
 
-  for (auto &[key, data] : ssprops) { out[key] = point_at_error(data, alt, lat, lon, key); }
+  for (auto &[key, data] : field.nlte) {
+    if (skip_batched and data.is_batched()) continue;
+    out[key] = point_at_error(data, alt, lat, lon, key);
+  }
+
+  for (auto &[key, data] : field.ssprops) {
+    if (skip_batched and data.is_batched()) continue;
+    out[key] = point_at_error(data, alt, lat, lon, key);
+  }
 
   return out;
 }
+}  // namespace
+
+Point Field::at(const Numeric alt, const Numeric lat, const Numeric lon) const try {
+  return point_at(*this, alt, lat, lon, false);
+}
+ARTS_METHOD_ERROR_CATCH
+
+void Field::at(std::span<Point>       out,
+               const ConstVectorView &alt,
+               const ConstVectorView &lat,
+               const ConstVectorView &lon) const try {
+  const Size n = out.size();
+  ARTS_USER_ERROR_IF(alt.size() != n or lat.size() != n or lon.size() != n,
+                     "Mismatching sizes: {} points, {} altitudes, {} latitudes, {} longitudes",
+                     n,
+                     alt.size(),
+                     lat.size(),
+                     lon.size())
+
+  std::string error{};
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size i = 0; i < n; i++) {
+    try {
+      out[i] = point_at(*this, alt[i], lat[i], lon[i], true);
+    } catch (const std::exception &e) {
+#pragma omp critical
+      if (error.empty()) {
+        error = std::format("At point {} ({}, {}, {}): {}", i, alt[i], lat[i], lon[i], e.what());
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  // One call for all points, so that a Python callback takes the GIL once
+  Vector values(n);
+  for (auto &key : keys()) {
+    const Data &data = operator[](key);
+    if (not data.is_batched()) continue;
+
+    try {
+      data.at(values, alt, lat, lon);
+    } catch (std::exception &e) {
+      throw std::runtime_error(std::format("Error while getting values for key {}: {}", key, e.what()));
+    }
+
+    for (Size i = 0; i < n; i++) out[i][key] = values[i];
+  }
+}
 ARTS_METHOD_ERROR_CATCH
 
 Point Field::at(const Vector3 pos) const try { return at(pos[0], pos[1], pos[2]); }
@@ -1142,26 +1357,26 @@ std::string std::formatter<AtmPoint>::to_string(const AtmPoint &v) const {
 
   if (tags.short_str) {
     out += tags.vformat(R"("SpeciesEnum": )"sv,
-                        v.specs.size(),
+                        v.specs().size(),
                         sep,
                         R"("SpeciesIsotope": )"sv,
-                        v.isots.size(),
+                        v.isots().size(),
                         sep,
                         R"("QuantumLevelIdentifier": )"sv,
-                        v.nlte.size(),
+                        v.nlte().size(),
                         sep,
                         R"("ScatteringSpeciesProperty": )"sv,
                         v.ssprops.size());
 
   } else {
     out += tags.vformat(R"("SpeciesEnum": )"sv,
-                        v.specs,
+                        v.specs(),
                         sep,
                         R"("SpeciesIsotope": )"sv,
-                        v.isots,
+                        v.isots(),
                         sep,
                         R"("QuantumLevelIdentifier": )"sv,
-                        v.nlte,
+                        v.nlte(),
                         sep,
                         R"("ScatteringSpeciesProperty": )"sv,
                         v.ssprops);
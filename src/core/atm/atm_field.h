@@ -12,7 +12,11 @@
 #include <quantum.h>
 #include <species.h>
 
+#include <array>
+#include <memory>
+#include <span>
 #include <stdexcept>
+#include <vector>
 
 #include "lagrange_interp.h"
 
@@ -59,15 +63,14 @@ concept ListOfNumeric = requires(T a) {
   { matpack::mdvalue(a, {Index{0}}) } -> std::same_as<Numeric>;
 };
 
+struct FrozenPoint;
+
 struct Point {
   using SpeciesMap           = std::unordered_map<SpeciesEnum, Numeric>;
   using SpeciesIsotopeMap    = std::unordered_map<SpeciesIsotope, Numeric>;
   using NlteMap              = std::unordered_map<QuantumLevelIdentifier, Numeric>;
   using ScatteringSpeciesMap = std::unordered_map<ScatteringSpeciesProperty, Numeric>;
 
-  SpeciesMap           specs{};
-  SpeciesIsotopeMap    isots{};
-  NlteMap              nlte{};
   ScatteringSpeciesMap ssprops{};
 
   Numeric pressure{0};
@@ -75,6 +78,18 @@ struct Point {
   Vector3 wind{0, 0, 0};
   Vector3 mag{0, 0, 0};
 
+ private:
+  //! Only changed through operator[] and the setters, so that the frozen copy is never stale
+  SpeciesMap        specs_{};
+  SpeciesIsotopeMap isots_{};
+  NlteMap           nlte_{};
+
+  //! Dense copy of specs_, isots_ and nlte_ for hash-free reads, see freeze()
+  std::shared_ptr<const FrozenPoint> frozen_{};
+
+  void thaw() noexcept;
+
+ public:
   Point(const IsoRatioOption);
   Point(Numeric pressure, Numeric temperature);
   Point();
@@ -105,13 +120,13 @@ struct Point {
   template <KeyType T, KeyType... Ts, std::size_t N = sizeof...(Ts)> constexpr bool has(T &&key, Ts &&...keys) const {
     const auto has_ = [](auto &x [[maybe_unused]], auto &&k [[maybe_unused]]) {
       if constexpr (isSpecies<T>)
-        return x.specs.end() not_eq x.specs.find(std::forward<T>(k));
+        return x.specs_.end() not_eq x.specs_.find(std::forward<T>(k));
       else if constexpr (isSpeciesIsotope<T>)
-        return x.isots.end() not_eq x.isots.find(std::forward<T>(k));
+        return x.isots_.end() not_eq x.isots_.find(std::forward<T>(k));
       else if constexpr (isAtmKey<T>)
         return true;
       else if constexpr (isQuantumLevelIdentifier<T>)
-        return x.nlte.end() not_eq x.nlte.find(std::forward<T>(k));
+        return x.nlte_.end() not_eq x.nlte_.find(std::forward<T>(k));
       else if constexpr (isScatteringSpeciesProperty<T>)
         return x.ssprops.end() not_eq x.ssprops.find(std::forward<T>(k));
     };
@@ -149,6 +164,63 @@ struct Point {
   [[nodiscard]] std::pair<Numeric, Numeric> levels(const QuantumIdentifier &band) const;
 
   void check();
+
+  [[nodiscard]] const SpeciesMap &specs() const noexcept { return specs_; }
+  [[nodiscard]] const SpeciesIsotopeMap &isots() const noexcept { return isots_; }
+  [[nodiscard]] const NlteMap &nlte() const noexcept { return nlte_; }
+
+  //! Replace all species VMRs, drops the frozen copy
+  void set_specs(SpeciesMap x);
+
+  //! Replace all isotopologue ratios, drops the frozen copy
+  void set_isots(SpeciesIsotopeMap x);
+
+  //! Replace all NLTE level populations, drops the frozen copy
+  void set_nlte(NlteMap x);
+
+  //! Reserve space for the number of keys of each kind
+  void reserve(Size nspecs, Size nisots, Size nnlte);
+
+  /** Builds the frozen copy so that the const operator[] of species, isotopologues and NLTE levels skip hashing
+   *
+   * Every write to the species, isotopologue or NLTE data, through
+   * the non-const operator[] or the setters, drops the copy again.
+   */
+  void freeze();
+
+  [[nodiscard]] bool is_frozen() const noexcept;
+};
+
+/** A flat, index-addressed copy of the hash maps of a Point
+ *
+ * Species are addressed by their enum value and isotopologues by their
+ * position in Species::Isotopologues.  Missing keys are stored as NaN.
+ * NLTE levels are kept sorted for binary search.
+ */
+struct FrozenPoint {
+  std::array<Numeric, enumsize::SpeciesEnumSize>     specs;
+  std::array<Numeric, Species::Isotopologues.size()> isots;
+  std::vector<QuantumLevelIdentifier>                nlte_keys;
+  std::vector<Numeric>                               nlte;
+
+  explicit FrozenPoint(const Point &atm);
+
+  /** The position of an isotopologue in isots, or isots.size() if it is not a known isotopologue
+   *
+   * Isotopologues copied from Species::Isotopologues share the name storage
+   * of the table entry, so they are found by comparing the name pointer
+   * within the range of their species.  Only other names are compared as strings.
+   */
+  [[nodiscard]] static Size isot_slot(const SpeciesIsotope &x) noexcept;
+
+  //! The VMR of the species or NaN if it is missing
+  [[nodiscard]] Numeric operator[](SpeciesEnum x) const noexcept;
+
+  //! The isotopologue ratio or NaN if it is missing
+  [[nodiscard]] Numeric operator[](const SpeciesIsotope &x) const noexcept;
+
+  //! The NLTE level population or NaN if it is missing
+  [[nodiscard]] Numeric operator[](const QuantumLevelIdentifier &x) const noexcept;
 };
 
 //! All the field data; if these types grow too much we might want to
@@ -219,6 +291,12 @@ struct Data {
 
   [[nodiscard]] Numeric at(const Vector3 pos) const;
 
+  //! Sets out[i] to the value at (alt[i], lat[i], lon[i]), in one call for batched functional data
+  void at(VectorView out, const ConstVectorView &alt, const ConstVectorView &lat, const ConstVectorView &lon) const;
+
+  //! Whether the data is functional data that evaluates many positions in one call, see ternary::Batched
+  [[nodiscard]] bool is_batched() const;
+
   [[nodiscard]] ConstVectorView flat_view() const;
 
   [[nodiscard]] VectorView flat_view();
@@ -289,6 +367,21 @@ struct Field final {
   //! Compute the values at a single point
   [[nodiscard]] Point at(const Vector3 pos) const;
 
+  /** Compute the values at many points
+   *
+   * Batched functional data is evaluated once for all points, the
+   * rest point by point in parallel.
+   *
+   * @param out The points, must have the size of the positions
+   * @param alt The altitudes of the points
+   * @param lat The latitudes of the points
+   * @param lon The longitudes of the points
+   */
+  void at(std::span<Point>       out,
+          const ConstVectorView &alt,
+          const ConstVectorView &lat,
+          const ConstVectorView &lon) const;
+
   [[nodiscard]] Size size() const;
   [[nodiscard]] Size nspec() const;
   [[nodiscard]] Size nisot() const;
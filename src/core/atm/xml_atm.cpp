@@ -7,9 +7,15 @@ void xml_io_stream<AtmPoint>::read(std::istream& is, AtmPoint& v, bifstream* pbi
   tag.read_from_stream(is);
   tag.check_name(type_name);
 
-  xml_read_from_stream(is, v.specs, pbifs);
-  xml_read_from_stream(is, v.isots, pbifs);
-  xml_read_from_stream(is, v.nlte, pbifs);
+  AtmPoint::SpeciesMap        specs;
+  AtmPoint::SpeciesIsotopeMap isots;
+  AtmPoint::NlteMap           nlte;
+  xml_read_from_stream(is, specs, pbifs);
+  xml_read_from_stream(is, isots, pbifs);
+  xml_read_from_stream(is, nlte, pbifs);
+  v.set_specs(std::move(specs));
+  v.set_isots(std::move(isots));
+  v.set_nlte(std::move(nlte));
   xml_read_from_stream(is, v.ssprops, pbifs);
   xml_read_from_stream(is, v.pressure, pbifs);
   xml_read_from_stream(is, v.temperature, pbifs);
@@ -24,9 +30,9 @@ void xml_io_stream<AtmPoint>::write(std::ostream& os, const AtmPoint& v, bofstre
   XMLTag tag(type_name, "name", name);
   tag.write_to_stream(os);
 
-  xml_write_to_stream(os, v.specs, pbofs, "Species Data"sv);
-  xml_write_to_stream(os, v.isots, pbofs, "Isotopologue Data"sv);
-  xml_write_to_stream(os, v.nlte, pbofs, "NLTE Data"sv);
+  xml_write_to_stream(os, v.specs(), pbofs, "Species Data"sv);
+  xml_write_to_stream(os, v.isots(), pbofs, "Isotopologue Data"sv);
+  xml_write_to_stream(os, v.nlte(), pbofs, "NLTE Data"sv);
   xml_write_to_stream(os, v.ssprops, pbofs, "Scattering Data"sv);
   xml_write_to_stream(os, v.pressure, pbofs, "pressure"sv);
   xml_write_to_stream(os, v.temperature, pbofs, "temperature"sv);
@@ -19,10 +19,15 @@
 bifstream::bifstream(const char* name, std::ios::openmode mode) : std::ifstream(name, mode) {
   // Open a second file descriptor for fast array reading
   if (!(this->mfilep = fopen(name, "rb"))) { ARTS_USER_ERROR("Failed to open {}", name); }
+
+  if (chunked_binary::is_chunked(mfilep)) mchunked = std::make_unique<chunked_binary::reader>(mfilep);
 }
 
 void bifstream::getRaw(char* c, std::streamsize n) {
-  if (n <= 8) {
+  if (mchunked) {
+    mchunked->read(c, mchunked_pos, static_cast<std::uint64_t>(n));
+    mchunked_pos += static_cast<std::uint64_t>(n);
+  } else if (n <= 8) {
     this->read(c, n);
   } else {
     fseek(mfilep, this->tellg(), SEEK_SET);
@@ -38,6 +43,15 @@ void bifstream::seek(long spos, Offset offs) {
     return;
   }
 
+  if (mchunked) {
+    switch (offs) {
+      case Set: mchunked_pos = static_cast<std::uint64_t>(spos); break;
+      case Add: mchunked_pos += spos; break;
+      case End: mchunked_pos = mchunked->size() + spos; break;
+    }
+    return;
+  }
+
   switch (offs) {
     case Set: this->seekg(spos, std::ios::beg); break;
     case Add: this->seekg(spos, std::ios::cur); break;
@@ -50,10 +64,22 @@ std::streampos bifstream::pos() {
     err = NotOpen;
     return 0;
   }
+  if (mchunked) return std::streampos(static_cast<std::streamoff>(mchunked_pos));
   return std::streampos(this->tellg());
 }
 
 bifstream::Byte bifstream::getByte() {
+  if (mchunked) {
+    if (mchunked_pos >= mchunked->size()) {
+      err |= Eof;
+      return static_cast<Byte>(EOF);
+    }
+
+    char c;
+    mchunked->read(&c, mchunked_pos++, 1);
+    return static_cast<Byte>(c);
+  }
+
   if (this->good()) {
     int iread;
     iread = this->get();
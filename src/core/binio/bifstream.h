@@ -15,13 +15,18 @@
 
 #include <cstdint>
 #include <fstream>
+#include <memory>
 
 #include "binio.h"
+#include "chunked_binary.h"
 
 //! Binary output file stream class
 /*!
-  Handles writing to an output file stream in binary format. It makes it
-  possible to use the operator<< for binary output.
+  Handles reading from an input file stream in binary format. It makes it
+  possible to use the operator>> for binary input.
+
+  Chunked binary files, see chunked_binary.h, are detected on opening and
+  read transparently, with positions referring to the inflated data.
 */
 class bifstream final : public binistream, public std::ifstream {
  public:
@@ -30,9 +35,13 @@ class bifstream final : public binistream, public std::ifstream {
   explicit bifstream(const char* name, std::ios::openmode mode = std::ios::in | std::ios::binary);
 
   ~bifstream() final {
+    mchunked.reset();
     if (mfilep) { fclose(mfilep); }
   }
 
+  //! Whether the file is a chunked binary file
+  [[nodiscard]] bool is_chunked() const { return mchunked != nullptr; }
+
   void           seek(long spos, Offset offs) final;
   std::streampos pos() final;
 
@@ -41,6 +50,9 @@ class bifstream final : public binistream, public std::ifstream {
 
  private:
   FILE* mfilep{nullptr};
+
+  std::unique_ptr<chunked_binary::reader> mchunked{};
+  std::uint64_t                           mchunked_pos{0};
 };
 
 /* Overloaded input operators */
@@ -14,12 +14,57 @@
 
 #include <debug.h>
 
+#include <cassert>
+#include <cstdio>
+#include <exception>
+#include <print>
+
+bofstream::bofstream(const char* name, std::uint64_t block_size)
+    : std::ofstream(name, std::ios::out | std::ios::trunc | std::ios::binary),
+      mchunked(std::make_unique<chunked_binary::writer>(*this, block_size)) {}
+
+bofstream::~bofstream() {
+  if (not mchunked) return;
+
+  // A file abandoned by an exception is left without its block index, so
+  // that reading it fails rather than returning partial data
+  if (std::uncaught_exceptions() > 0) return;
+
+  assert(false and "finish() must be called before a chunked bofstream is destroyed");
+
+  try {
+    finish();
+  } catch (const std::exception& e) {
+    std::println(stderr, "Cannot complete chunked binary file:\n{}", e.what());
+  } catch (...) {
+    std::println(stderr, "Cannot complete chunked binary file");
+  }
+}
+
+void bofstream::finish() {
+  if (not mchunked) return;
+
+  // Reset first so that a failure is not repeated on destruction
+  const std::unique_ptr<chunked_binary::writer> writer = std::move(mchunked);
+  writer->finish();
+}
+
+void bofstream::putRaw(const char* c, std::streamsize n) {
+  if (mchunked) {
+    mchunked->write(c, static_cast<std::uint64_t>(n));
+  } else {
+    this->write(c, n);
+  }
+}
+
 void bofstream::seek(long spos, Offset offs) {
   if (!in) {
     err = NotOpen;
     return;
   }
 
+  ARTS_USER_ERROR_IF(mchunked, "Cannot seek in a chunked binary file that is being written")
+
   switch (offs) {
     case Set: this->seekp(spos, std::ios::beg); break;
     case Add: this->seekp(spos, std::ios::cur); break;
@@ -32,6 +77,7 @@ std::streampos bofstream::pos() {
     err = NotOpen;
     return 0;
   }
+  if (mchunked) return std::streampos(static_cast<std::streamoff>(mchunked->size()));
   return std::streamoff(this->tellp());
 }
 
@@ -42,6 +88,12 @@ void bofstream::putByte(bofstream::Byte b) {
     return;
   }
 
+  if (mchunked) {
+    const auto c = static_cast<char>(b);
+    mchunked->write(&c, 1);
+    return;
+  }
+
   this->put(b);
   if (this->bad()) {
     err |= Fatal;
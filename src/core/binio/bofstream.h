@@ -15,8 +15,10 @@
 
 #include <cstdint>
 #include <fstream>
+#include <memory>
 
 #include "binio.h"
+#include "chunked_binary.h"
 
 //! Binary output file stream class
 /*!
@@ -30,11 +32,31 @@ class bofstream : public binostream, public std::ofstream {
   explicit bofstream(const char* name, std::ios::openmode mode = std::ios::out | std::ios::trunc | std::ios::binary)
       : std::ofstream(name, mode) {}
 
+  /*! Opens a chunked binary file, see chunked_binary.h
+
+    The data is deflated in blocks as it is written.  Call finish() to
+    write the last block and the block index.  The destructor does not
+    complete the file while an exception unwinds the stack, so reading a
+    file abandoned that way fails as truncated.
+  */
+  bofstream(const char* name, std::uint64_t block_size);
+
+  bofstream(const bofstream&)            = delete;
+  bofstream& operator=(const bofstream&) = delete;
+
+  ~bofstream() override;
+
+  //! Completes a chunked binary file, does nothing for other files
+  void finish();
+
   void           seek(long spos, Offset offs) final;
   std::streampos pos() final;
 
   void putByte(bofstream::Byte b) final;
-  void putRaw(const char* c, std::streamsize n) final { this->write(c, n); }
+  void putRaw(const char* c, std::streamsize n) final;
+
+ private:
+  std::unique_ptr<chunked_binary::writer> mchunked{};
 };
 
 /* Overloaded output operators */
@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////////////////////
+//   File description
+////////////////////////////////////////////////////////////////////////////
+/*!
+  \file   chunked_binary.cc
+
+  \brief  Implementation of the chunked binary container.
+*/
+
+#include "chunked_binary.h"
+
+#include <arts_omp.h>
+#include <debug.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <format>
+#include <string>
+
+namespace chunked_binary {
+namespace {
+void put_u64(std::ostream& os, std::uint64_t x) {
+  std::array<char, 8> b;
+  for (char& c : b) {
+    c   = static_cast<char>(x & 0xff);
+    x >>= 8;
+  }
+  os.write(b.data(), b.size());
+}
+
+std::uint64_t get_u64(std::FILE* file) {
+  std::array<unsigned char, 8> b;
+  ARTS_USER_ERROR_IF(std::fread(b.data(), 1, b.size(), file) != b.size(),
+                     "Unexpectedly reached end of chunked binary file.")
+
+  std::uint64_t x = 0;
+  for (auto c = b.rbegin(); c != b.rend(); ++c) x = (x << 8) | *c;
+  return x;
+}
+
+//! As std::fseek, but with 64-bit offsets also where long is 32 bits
+void seek(std::FILE* file, std::int64_t pos, int origin) {
+#ifdef _MSC_VER
+  const int res = _fseeki64(file, pos, origin);
+#else
+  const int res = fseeko(file, static_cast<off_t>(pos), origin);
+#endif
+  ARTS_USER_ERROR_IF(res != 0, "Cannot seek in chunked binary file.")
+}
+
+//! As std::ftell, but with 64-bit offsets also where long is 32 bits
+std::int64_t tell(std::FILE* file) {
+#ifdef _MSC_VER
+  return _ftelli64(file);
+#else
+  return static_cast<std::int64_t>(ftello(file));
+#endif
+}
+
+bool read_magic(std::FILE* file) {
+  std::array<char, 8> b;
+  return std::fread(b.data(), 1, b.size(), file) == b.size() and b == magic;
+}
+}  // namespace
+
+bool is_chunked(std::FILE* file) {
+  const std::int64_t pos = tell(file);
+  ARTS_USER_ERROR_IF(pos < 0, "Cannot get the position in binary file.")
+
+  seek(file, 0, SEEK_SET);
+  const bool out = read_magic(file);
+  seek(file, pos, SEEK_SET);
+  return out;
+}
+
+reader::reader(std::FILE* f) : file(f) {
+  seek(file, 0, SEEK_SET);
+  ARTS_USER_ERROR_IF(not read_magic(file), "Not a chunked binary file.")
+  block_size = get_u64(file);
+
+  seek(file, -24, SEEK_END);
+  nbytes                     = get_u64(file);
+  const std::uint64_t nblock = get_u64(file);
+  ARTS_USER_ERROR_IF(not read_magic(file), "Truncated chunked binary file.")
+  ARTS_USER_ERROR_IF(block_size == 0 or nblock != (nbytes + block_size - 1) / block_size,
+                     "Corrupt chunked binary file: {} blocks of {} bytes cannot hold {} bytes",
+                     nblock,
+                     block_size,
+                     nbytes)
+
+  seek(file, -24 - 8 * static_cast<std::int64_t>(nblock), SEEK_END);
+  offsets.resize(nblock + 1);
+  offsets[0] = 16;
+  for (std::uint64_t i = 0; i < nblock; i++) offsets[i + 1] = offsets[i] + get_u64(file);
+}
+
+void reader::inflate_block(char* dest, std::uint64_t block, const char* src) const {
+  const std::uint64_t expected = std::min(block_size, nbytes - block * block_size);
+
+  uLongf    len = static_cast<uLongf>(expected);
+  const int res = uncompress(reinterpret_cast<Bytef*>(dest),
+                             &len,
+                             reinterpret_cast<const Bytef*>(src),
+                             static_cast<uLong>(offsets[block + 1] - offsets[block]));
+  ARTS_USER_ERROR_IF(res != Z_OK or len != expected, "Cannot inflate block {} of chunked binary file.", block)
+}
+
+void reader::read(char* dest, std::uint64_t pos, std::uint64_t n) {
+  if (n == 0) return;
+  ARTS_USER_ERROR_IF(pos + n > nbytes, "Unexpectedly reached end of binary input file.")
+
+  const std::uint64_t b0 = pos / block_size;
+  const std::uint64_t b1 = (pos + n - 1) / block_size;
+
+  const auto read_deflated = [this](std::uint64_t first, std::uint64_t last) {
+    std::vector<char> src(offsets[last + 1] - offsets[first]);
+    seek(file, static_cast<std::int64_t>(offsets[first]), SEEK_SET);
+    ARTS_USER_ERROR_IF(std::fread(src.data(), 1, src.size(), file) != src.size(),
+                       "Unexpectedly reached end of chunked binary file.")
+    return src;
+  };
+
+  // Small reads go through the cached block
+  if (b0 == b1 and n < block_size) {
+    if (cache.empty() or cached_block != b0) {
+      const std::vector<char> src = read_deflated(b0, b0);
+      cache.resize(std::min(block_size, nbytes - b0 * block_size));
+      inflate_block(cache.data(), b0, src.data());
+      cached_block = b0;
+    }
+    std::memcpy(dest, cache.data() + (pos - b0 * block_size), n);
+    return;
+  }
+
+  // The deflated data is read in one go, then inflated in parallel
+  const std::vector<char> src = read_deflated(b0, b1);
+
+  std::string error;
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (std::uint64_t b = b0; b <= b1; b++) {
+    try {
+      const std::uint64_t start = b * block_size;
+      const std::uint64_t end   = std::min(start + block_size, nbytes);
+      const std::uint64_t lo    = std::max(start, pos);
+      const std::uint64_t hi    = std::min(end, pos + n);
+      const char*         in    = src.data() + (offsets[b] - offsets[b0]);
+
+      if (lo == start and hi == end) {
+        inflate_block(dest + (start - pos), b, in);
+      } else {
+        std::vector<char> tmp(end - start);
+        inflate_block(tmp.data(), b, in);
+        std::memcpy(dest + (lo - pos), tmp.data() + (lo - start), hi - lo);
+      }
+    } catch (const std::exception& e) {
+#pragma omp critical
+      error += std::string{e.what()} + '\n';
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+}
+
+writer::writer(std::ostream& o, std::uint64_t bs) : os(&o), block_size(bs) {
+  ARTS_USER_ERROR_IF(block_size == 0, "The block size must be positive")
+  os->write(magic.data(), magic.size());
+  put_u64(*os, block_size);
+}
+
+void writer::flush(std::uint64_t nblocks) {
+  std::vector<std::vector<char>> out(nblocks);
+
+  std::string error;
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (std::uint64_t i = 0; i < nblocks; i++) {
+    const std::uint64_t start = i * block_size;
+    const std::uint64_t len   = std::min<std::uint64_t>(block_size, pending.size() - start);
+
+    uLongf dlen = compressBound(static_cast<uLong>(len));
+    out[i].resize(dlen);
+    const int res = compress2(reinterpret_cast<Bytef*>(out[i].data()),
+                              &dlen,
+                              reinterpret_cast<const Bytef*>(pending.data() + start),
+                              static_cast<uLong>(len),
+                              Z_DEFAULT_COMPRESSION);
+    if (res != Z_OK) {
+#pragma omp critical
+      error += std::format("Cannot deflate block {} of chunked binary file.\n", sizes.size() + i);
+    }
+    out[i].resize(dlen);
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  for (auto& block : out) {
+    os->write(block.data(), block.size());
+    sizes.push_back(block.size());
+  }
+  ARTS_USER_ERROR_IF(os->bad(), "Writing to binary file failed")
+
+  pending.erase(pending.begin(),
+                pending.begin() + static_cast<std::ptrdiff_t>(std::min<std::uint64_t>(pending.size(), nblocks * block_size)));
+}
+
+void writer::write(const char* c, std::uint64_t n) {
+  pending.insert(pending.end(), c, c + n);
+  nbytes += n;
+
+  // Deflate one full block per thread at a time
+  const std::uint64_t batch = block_size * static_cast<std::uint64_t>(std::max(1, arts_omp_get_max_threads()));
+  if (pending.size() >= batch) flush(pending.size() / block_size);
+}
+
+void writer::finish() {
+  if (not pending.empty()) flush((pending.size() + block_size - 1) / block_size);
+
+  for (auto s : sizes) put_u64(*os, s);
+  put_u64(*os, nbytes);
+  put_u64(*os, sizes.size());
+  os->write(magic.data(), magic.size());
+  os->flush();
+  ARTS_USER_ERROR_IF(os->bad(), "Writing to binary file failed")
+}
+}  // namespace chunked_binary
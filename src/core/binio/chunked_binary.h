@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////
+//   File description
+////////////////////////////////////////////////////////////////////////////
+/*!
+  \file   chunked_binary.h
+
+  \brief  A binary container of independently deflated blocks.
+
+  The layout of a chunked binary file is
+
+    magic (8 bytes), block size (uint64)
+    the deflated blocks, back to back
+    the deflated size of each block (uint64 each)
+    the total inflated size (uint64), the number of blocks (uint64), magic (8 bytes)
+
+  All integers are little endian.  Every block but the last inflates to
+  exactly the block size, so any byte range maps directly to a range of
+  blocks that can be inflated independently of each other.
+*/
+
+#ifndef CHUNKED_BINARY_H_INCLUDED
+#define CHUNKED_BINARY_H_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <vector>
+
+namespace chunked_binary {
+inline constexpr std::array<char, 8> magic{'A', 'R', 'T', 'S', 'C', 'B', 'I', 'N'};
+
+//! The inflated size of all but the last block
+inline constexpr std::uint64_t default_block_size = std::uint64_t{1} << 22;
+
+//! Whether the open file starts like a chunked binary file, the position is restored
+bool is_chunked(std::FILE* file);
+
+//! Random access reads from a chunked binary file
+class reader {
+  std::FILE*                 file;
+  std::uint64_t              block_size{};
+  std::uint64_t              nbytes{};
+  std::vector<std::uint64_t> offsets{};
+
+  // The last inflated block, for small reads
+  std::uint64_t     cached_block{};
+  std::vector<char> cache{};
+
+  void inflate_block(char* dest, std::uint64_t block, const char* src) const;
+
+ public:
+  //! Reads the block index, the file must outlive the reader
+  explicit reader(std::FILE* file);
+
+  //! The total inflated size
+  [[nodiscard]] std::uint64_t size() const { return nbytes; }
+
+  /*! Copies n inflated bytes, starting at pos, to dest.
+
+    Reads spanning several blocks inflate them in parallel, directly
+    into dest where a block is fully covered by the read.
+  */
+  void read(char* dest, std::uint64_t pos, std::uint64_t n);
+};
+
+//! Sequential writes to a chunked binary file
+class writer {
+  std::ostream*              os;
+  std::uint64_t              block_size;
+  std::uint64_t              nbytes{0};
+  std::vector<std::uint64_t> sizes{};
+  std::vector<char>          pending{};
+
+  //! Deflates and writes the first nblocks pending blocks, the last may be partial
+  void flush(std::uint64_t nblocks);
+
+ public:
+  //! Writes the header, os must outlive the writer
+  explicit writer(std::ostream& os, std::uint64_t block_size = default_block_size);
+
+  void write(const char* c, std::uint64_t n);
+
+  //! The number of bytes written so far
+  [[nodiscard]] std::uint64_t size() const { return nbytes; }
+
+  //! Writes the remaining data and the block index
+  void finish();
+};
+}  // namespace chunked_binary
+
+#endif
@@ -0,0 +1,147 @@
+#include <disort-test.h>
+
+#include <chrono>
+#include <print>
+#include <string>
+
+namespace {
+constexpr Index NQuad    = 32;
+constexpr Index NLeg     = 32;
+constexpr Index NFourier = 32;
+constexpr Index NLayers  = 100;
+
+struct setup {
+  AscendingGrid             tau_arr;
+  Vector                    omega_arr;
+  Matrix                    Leg_coeffs_all;
+  Matrix                    b_pos;
+  Matrix                    b_neg;
+  Vector                    f_arr;
+  Matrix                    s_poly_coeffs;
+  std::vector<disort::BDRF> BDRF_Fourier_modes{disort::BDRF{[](auto c, auto&, auto&) { c = 0.3; }}};
+  Numeric                   mu0  = 0.6;
+  Numeric                   I0   = Constant::pi / 0.6;
+  Numeric                   phi0 = 0.9 * Constant::pi;
+
+  setup()
+      : omega_arr(NLayers),
+        Leg_coeffs_all(NLayers, NLeg),
+        b_pos(NFourier, NQuad / 2, 0.0),
+        b_neg(NFourier, NQuad / 2, 0.0),
+        f_arr(NLayers),
+        s_poly_coeffs(NLayers, 2) {
+    Vector taus(NLayers);
+    for (Index l = 0; l < NLayers; l++) {
+      taus[l]      = 20.0 * static_cast<Numeric>(l + 1) / NLayers;
+      omega_arr[l] = 0.05 + 0.9 * static_cast<Numeric>(l % 7) / 7.0;
+      for (Index i = 0; i < NLeg; i++) Leg_coeffs_all[l, i] = std::pow(0.75, i);
+      f_arr[l]         = Leg_coeffs_all[l, NLeg - 1];
+      s_poly_coeffs[l] = std::array{172311.79936609, -102511.4417051};
+    }
+    tau_arr = AscendingGrid{taus};
+
+    // Only the first row reaches the fluxes
+    b_pos    = 0.5;
+    b_neg    = 0.2;
+    b_neg[0] = 1.0;
+  }
+
+  [[nodiscard]] disort::main_data full() const {
+    return disort::main_data(NQuad,
+                             NLeg,
+                             NFourier,
+                             tau_arr,
+                             omega_arr,
+                             Leg_coeffs_all,
+                             b_pos,
+                             b_neg,
+                             f_arr,
+                             s_poly_coeffs,
+                             BDRF_Fourier_modes,
+                             mu0,
+                             I0,
+                             phi0);
+  }
+
+  [[nodiscard]] disort::main_data flux() const {
+    auto dis = disort::main_data::flux_model(NLayers,
+                                             NQuad,
+                                             NLeg,
+                                             s_poly_coeffs.ncols(),
+                                             Leg_coeffs_all.ncols(),
+                                             static_cast<Index>(BDRF_Fourier_modes.size()));
+
+    dis.tau(tau_arr);
+    dis.omega()               = omega_arr;
+    dis.f()                   = f_arr;
+    dis.all_legendre_coeffs() = Leg_coeffs_all;
+    dis.source_poly()         = s_poly_coeffs;
+    dis.upward_boundary()     = b_pos[Range(0, 1)];
+    dis.downward_boundary()   = b_neg[Range(0, 1)];
+    dis.brdf_modes()[0]       = BDRF_Fourier_modes[0];
+    dis.solar_zenith()        = mu0;
+    dis.beam_azimuth()        = phi0;
+    dis.update_all(I0);
+    return dis;
+  }
+};
+
+//! The best time of n updates followed by a flux computation
+Numeric best_time(disort::main_data& dis, const Index n) {
+  Vector up(NLayers), down(NLayers), direct(NLayers);
+
+  // Measure the full work of every update
+  dis.diagonalization_reuse_tolerance() = -1.0;
+
+  auto best = std::chrono::steady_clock::duration::max();
+  for (Index i = 0; i < n; i++) {
+    const auto start = std::chrono::steady_clock::now();
+    dis.update_all();
+    dis.gridded_flux(up, down, direct);
+    best = std::min(best, std::chrono::steady_clock::now() - start);
+  }
+
+  return std::chrono::duration<Numeric>(best).count();
+}
+
+void bench_flux(const Index n) try {
+  const setup s;
+
+  disort::main_data full = s.full();
+  disort::main_data flux = s.flux();
+
+  ARTS_USER_ERROR_IF(full.only_fluxes() or not flux.only_fluxes(), "Bad flux mode flags")
+
+  const Vector taus{0.1, 1.0, 7.5, s.tau_arr[NLayers - 1]};
+  const auto [up, dd, dr]             = compute_flux(flux, taus);
+  const auto [up_ref, dd_ref, dr_ref] = compute_flux(full, taus);
+  ARTS_USER_ERROR_IF(not is_good(up, up_ref), "Failed flux_up")
+  ARTS_USER_ERROR_IF(not is_good(dd, dd_ref), "Failed flux_down_diffuse")
+  ARTS_USER_ERROR_IF(not is_good(dr, dr_ref), "Failed flux_down_direct")
+
+  Vector gu(NLayers), gd(NLayers), gb(NLayers), gu_ref(NLayers), gd_ref(NLayers), gb_ref(NLayers);
+  flux.gridded_flux(gu, gd, gb);
+  full.gridded_flux(gu_ref, gd_ref, gb_ref);
+  ARTS_USER_ERROR_IF(not is_good(gu, gu_ref), "Failed gridded flux_up")
+  ARTS_USER_ERROR_IF(not is_good(gd, gd_ref), "Failed gridded flux_down_diffuse")
+  ARTS_USER_ERROR_IF(not is_good(gb, gb_ref), "Failed gridded flux_down_direct")
+
+  ARTS_USER_ERROR_IF(not is_good(compute_u0(flux, taus), compute_u0(full, taus)), "Failed u0")
+
+  const Numeric t_full = best_time(full, n);
+  const Numeric t_flux = best_time(flux, n);
+  std::print("{} layers, {} streams, {} Fourier modes, best of {}:\n", NLayers, NQuad, NFourier, n);
+  std::print("  full model: {:.3e} s\n", t_full);
+  std::print("  flux model: {:.3e} s ({:.1f}x)\n", t_flux, t_full / t_flux);
+} catch (std::exception& e) {
+  throw std::runtime_error(std::format("Error in bench-flux:\n{}", e.what()));
+}
+}  // namespace
+
+int main(int argc, char** argv) try {
+  std::cout << std::setprecision(16);
+  bench_flux(argc > 1 ? std::stoi(argv[1]) : 3);
+} catch (std::exception& e) {
+  std::cerr << "Error in main:\n" << e.what() << '\n';
+  return EXIT_FAILURE;
+}
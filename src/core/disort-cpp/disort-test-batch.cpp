@@ -0,0 +1,95 @@
+#include <disort-test.h>
+
+namespace {
+constexpr Index NQuad = 16;
+
+struct model {
+  Vector  tau_arr;
+  Vector  omega_arr;
+  Matrix  Leg_coeffs_all;
+  Numeric mu0;
+  Numeric I0;
+
+  model(Numeric scl, Numeric g, Numeric mu0_, Numeric I0_)
+      : tau_arr{0.5 * scl, 1.2 * scl, 2.0 * scl, 3.5 * scl},
+        omega_arr{0.3, 0.5 * g, 0.9, 0.7 * g},
+        Leg_coeffs_all(4, 32),
+        mu0(mu0_),
+        I0(I0_) {
+    for (Index l = 0; l < Leg_coeffs_all.nrows(); l++) {
+      for (Index i = 0; i < Leg_coeffs_all.ncols(); i++) Leg_coeffs_all[l, i] = std::pow(g, i);
+    }
+  }
+
+  [[nodiscard]] disort::main_data make() const {
+    return disort::main_data(NQuad,
+                             NQuad,
+                             NQuad,
+                             AscendingGrid{tau_arr},
+                             omega_arr,
+                             Leg_coeffs_all,
+                             Matrix(NQuad, NQuad / 2, 0.0),
+                             Matrix(NQuad, NQuad / 2, 0.0),
+                             Vector(tau_arr.size(), 0.0),
+                             Matrix(tau_arr.size(), 0),
+                             {},
+                             mu0,
+                             I0,
+                             0.0);
+  }
+
+  void set(disort::main_data& dis) const {
+    dis.tau(tau_arr);
+    dis.omega()               = omega_arr;
+    dis.all_legendre_coeffs() = Leg_coeffs_all;
+    dis.solar_zenith()        = mu0;
+  }
+};
+
+void test_batch() try {
+  const std::vector<model> models{
+      {1.0, 0.75, 0.6, 2.0},
+      {0.3, 0.2, 0.45, 1.0},
+      {4.0, 0.9, 0.8, 0.0},
+  };
+
+  const Index nm = static_cast<Index>(models.size());
+
+  // One more model than needed, to also test partial batches
+  disort::batch dis(models.front().make(), nm + 1);
+
+  Vector I0(nm);
+  for (Index k = 0; k < nm; k++) {
+    models[k].set(dis[k]);
+    I0[k] = models[k].I0;
+  }
+  dis.update_all(I0);
+
+  const Vector phis{0.0, 1.0, 3.0};
+  for (Index k = 0; k < nm; k++) {
+    const disort::main_data ref = models[k].make();
+
+    const Vector taus{0.1, 1.0, models[k].tau_arr[models[k].tau_arr.size() - 1]};
+
+    ARTS_USER_ERROR_IF(not is_good(compute_u(dis[k], taus, phis, false), compute_u(ref, taus, phis, false)),
+                       "Failed u of model {}",
+                       k);
+
+    const auto [up, dd, dr]             = compute_flux(dis[k], taus);
+    const auto [up_ref, dd_ref, dr_ref] = compute_flux(ref, taus);
+    ARTS_USER_ERROR_IF(not is_good(up, up_ref), "Failed flux_up of model {}", k);
+    ARTS_USER_ERROR_IF(not is_good(dd, dd_ref), "Failed flux_down_diffuse of model {}", k);
+    ARTS_USER_ERROR_IF(not is_good(dr, dr_ref), "Failed flux_down_direct of model {}", k);
+  }
+} catch (std::exception& e) {
+  throw std::runtime_error(std::format("Error in test-batch:\n{}", e.what()));
+}
+}  // namespace
+
+int main() try {
+  std::cout << std::setprecision(16);
+  test_batch();
+} catch (std::exception& e) {
+  std::cerr << "Error in main:\n" << e.what() << '\n';
+  return EXIT_FAILURE;
+}
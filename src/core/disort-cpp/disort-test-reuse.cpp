@@ -0,0 +1,125 @@
+#include <disort-test.h>
+
+namespace {
+struct setup {
+  Vector  tau_arr{0.5, 1.2, 2.0, 3.5, 5.0};
+  Vector  omega_arr{0.3, 0.5, 0.9, 0.7, 0.1};
+  Matrix  Leg_coeffs_all;
+  Numeric mu0 = 0.6;
+  Numeric I0  = Constant::pi;
+
+  static constexpr Index NQuad = 16;
+
+  setup() : Leg_coeffs_all(5, 32) {
+    for (Index l = 0; l < Leg_coeffs_all.nrows(); l++) {
+      const Numeric g = 0.1 + 0.15 * static_cast<Numeric>(l);
+      for (Index i = 0; i < Leg_coeffs_all.ncols(); i++) Leg_coeffs_all[l, i] = std::pow(g, i);
+    }
+  }
+
+  [[nodiscard]] disort::main_data make() const {
+    return disort::main_data(NQuad,
+                             NQuad,
+                             NQuad,
+                             AscendingGrid{tau_arr},
+                             omega_arr,
+                             Leg_coeffs_all,
+                             Matrix(NQuad, NQuad / 2, 0.0),
+                             Matrix(NQuad, NQuad / 2, 0.0),
+                             Vector(tau_arr.size(), 0.0),
+                             Matrix(tau_arr.size(), 0),
+                             {},
+                             mu0,
+                             I0,
+                             0.0);
+  }
+
+  void set(disort::main_data& dis) const {
+    dis.tau(tau_arr);
+    dis.omega()               = omega_arr;
+    dis.all_legendre_coeffs() = Leg_coeffs_all;
+    dis.solar_zenith()        = mu0;
+    dis.update_all(I0);
+  }
+};
+
+//! The updated solver must give the same result as a solver set up from scratch
+void check_same(const std::string_view name, const disort::main_data& dis, const setup& s) {
+  const disort::main_data ref = s.make();
+
+  const Vector taus{0.1, 1.0, 2.5, s.tau_arr[s.tau_arr.size() - 1]};
+  const Vector phis{0.0, 1.0, 3.0};
+
+  ARTS_USER_ERROR_IF(not is_good(compute_u(dis, taus, phis, false), compute_u(ref, taus, phis, false)),
+                     "Failed u in test {}",
+                     name);
+
+  const auto [up, dd, dr]             = compute_flux(dis, taus);
+  const auto [up_ref, dd_ref, dr_ref] = compute_flux(ref, taus);
+  ARTS_USER_ERROR_IF(not is_good(up, up_ref), "Failed flux_up in test {}", name);
+  ARTS_USER_ERROR_IF(not is_good(dd, dd_ref), "Failed flux_down_diffuse in test {}", name);
+  ARTS_USER_ERROR_IF(not is_good(dr, dr_ref), "Failed flux_down_direct in test {}", name);
+}
+
+void check_reused(const std::string_view name, const disort::main_data& dis, const Index expected) {
+  ARTS_USER_ERROR_IF(dis.reused_layer_count() != expected,
+                     "Reused {} layers in test {}, expected {}",
+                     dis.reused_layer_count(),
+                     name,
+                     expected);
+}
+
+void test_reuse() try {
+  setup             s;
+  disort::main_data dis = s.make();
+  check_reused("initial", dis, 0);
+
+  // Only the optical thicknesses change, all layers are reused
+  s.tau_arr *= 1.7;
+  s.set(dis);
+  check_reused("tau", dis, 5);
+  check_same("tau", dis, s);
+
+  // The beam changes, all eigenpairs are still reused but the particular solutions are not
+  s.I0  = 2.0;
+  s.mu0 = 0.45;
+  s.set(dis);
+  check_reused("beam", dis, 5);
+  check_same("beam", dis, s);
+
+  // Two layers change their scattering properties
+  s.omega_arr[1]         = 0.55;
+  s.Leg_coeffs_all[3, 2] = 0.5;
+  s.set(dis);
+  check_reused("scattering", dis, 3);
+  check_same("scattering", dis, s);
+
+  // Turning reuse off diagonalizes everything
+  dis.diagonalization_reuse_tolerance() = -1.0;
+  s.set(dis);
+  check_reused("off", dis, 0);
+  check_same("off", dis, s);
+
+  // A tolerance reuses layers with nearly the same scattering properties
+  dis.diagonalization_reuse_tolerance() = 1e-6;
+  s.set(dis);
+  s.omega_arr[2] *= 1.0 + 1e-9;
+  s.set(dis);
+  check_reused("tolerance", dis, 5);
+
+  s.omega_arr[2] *= 1.0 + 1e-3;
+  s.set(dis);
+  check_reused("outside tolerance", dis, 4);
+  check_same("outside tolerance", dis, s);
+} catch (std::exception& e) {
+  throw std::runtime_error(std::format("Error in test-reuse:\n{}", e.what()));
+}
+}  // namespace
+
+int main() try {
+  std::cout << std::setprecision(16);
+  test_reuse();
+} catch (std::exception& e) {
+  std::cerr << "Error in main:\n" << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <functional>
 #include <numeric>
 #include <ranges>
 #include <vector>
@@ -394,113 +395,121 @@ void source_terms(MatrixView              SRC0,
 }
 }  // namespace
 
-void main_data::solve_for_coefs() {
-  ARTS_TIME_REPORT
-
+void main_data::assemble_coefs_system(const Index m) {
   const Index ln = NLayers - 1;
 
   //! FIXME: Original code is transposed, but I suspect it is a bug
   auto RHS_middle = RHS[Range{N, n - NQuad}].view_as(NLayers - 1, NQuad);
 
-  for (Index m = 0; m < NFourier; m++) {
-    const bool m_equals_0_bool = m == 0;
-    const bool BDRF_bool       = m < NBDRF;
-    const auto G_collect_m     = G_collect[m];
-    const auto B_collect_m     = B_collect[m];
+  const bool m_equals_0_bool = m == 0;
+  const bool BDRF_bool       = m < NBDRF;
+  const auto G_collect_m     = G_collect[m];
+  const auto B_collect_m     = B_collect[m];
 
-    if (BDRF_bool) {
-      brdf_fourier_modes[m](mathscr_D_neg, mu_arr[rf(N)], mu_arr[rb(N)]),
-          einsum<"ij", "", "ij", "j", "j">(R, 1 + m_equals_0_bool, mathscr_D_neg, mu_arr[rf(N)], W);
-      if (has_beam_source) {
-        brdf_fourier_modes[m](mathscr_X_pos.view_as(N, 1), mu_arr[rf(N)], ConstVectorView{-mu0});
-        mathscr_X_pos *= mu0 * I0 / Constant::pi;
-      }
+  if (BDRF_bool) {
+    brdf_fourier_modes[m](mathscr_D_neg, mu_arr[rf(N)], mu_arr[rb(N)]),
+        einsum<"ij", "", "ij", "j", "j">(R, 1 + m_equals_0_bool, mathscr_D_neg, mu_arr[rf(N)], W);
+    if (has_beam_source) {
+      brdf_fourier_modes[m](mathscr_X_pos.view_as(N, 1), mu_arr[rf(N)], ConstVectorView{-mu0});
+      mathscr_X_pos *= mu0 * I0 / Constant::pi;
     }
+  }
 
-    const auto boundary_up_m   = boundary_up[m];
-    const auto boundary_down_m = boundary_down[m];
+  const auto boundary_up_m   = boundary_up[m];
+  const auto boundary_down_m = boundary_down[m];
 
-    // Fill RHS
-    {
-      ARTS_NAMED_TIME_REPORT("disort::rhs"s);
+  // Fill RHS
+  {
+    ARTS_NAMED_TIME_REPORT("disort::rhs"s);
 
-      if (has_source_poly and m_equals_0_bool) {
-        for (Index i = 0; i < N; i++) RHS[i] = -SRCB[i];
-        for (Index i = 0; i < N; i++) RHS[n - N + i] = -SRCB[i + N];
-        std::transform(
-            SRC1.elem_begin(), SRC1.elem_end() - NQuad, SRC0.elem_begin(), RHS_middle.elem_begin(), std::minus{});
+    if (has_source_poly and m_equals_0_bool) {
+      for (Index i = 0; i < N; i++) RHS[i] = -SRCB[i];
+      for (Index i = 0; i < N; i++) RHS[n - N + i] = -SRCB[i + N];
+      std::transform(
+          SRC1.elem_begin(), SRC1.elem_end() - NQuad, SRC0.elem_begin(), RHS_middle.elem_begin(), std::minus{});
 
-        if (NBDRF > 0) {
-          source_update_um(comp_data, jvec[rf(N)], G_collect_m[ln], N);
-          mult(RHS[Range{n - N, N}], R, jvec[rf(N)], 1.0, 1.0);
-        }
-      } else {
-        RHS = 0.0;
+      if (NBDRF > 0) {
+        source_update_um(comp_data, jvec[rf(N)], G_collect_m[ln], N);
+        mult(RHS[Range{n - N, N}], R, jvec[rf(N)], 1.0, 1.0);
       }
+    } else {
+      RHS = 0.0;
+    }
 
-      if (has_beam_source) {
-        if (BDRF_bool) {
-          stdr::copy(mathscr_X_pos, BDRF_RHS_contribution.begin());
-          mult(BDRF_RHS_contribution, R, B_collect_m[ln, rf(N)], 1.0, 1.0);
-        } else {
-          BDRF_RHS_contribution = 0.0;
-        }
+    if (has_beam_source) {
+      if (BDRF_bool) {
+        stdr::copy(mathscr_X_pos, BDRF_RHS_contribution.begin());
+        mult(BDRF_RHS_contribution, R, B_collect_m[ln, rf(N)], 1.0, 1.0);
+      } else {
+        BDRF_RHS_contribution = 0.0;
+      }
 
-        for (Index l = 0; l < ln; l++) {
-          const Numeric scl = std::exp(-mu0 * scaled_tau_arr_with_0[l + 1]);
-          for (Index j = 0; j < NQuad; j++) { RHS_middle[l, j] += (B_collect_m[l + 1, j] - B_collect_m[l, j]) * scl; }
-        }
+      for (Index l = 0; l < ln; l++) {
+        const Numeric scl = std::exp(-mu0 * scaled_tau_arr_with_0[l + 1]);
+        for (Index j = 0; j < NQuad; j++) { RHS_middle[l, j] += (B_collect_m[l + 1, j] - B_collect_m[l, j]) * scl; }
+      }
 
-        for (Index i = 0; i < N; i++) {
-          RHS[i]         += boundary_down_m[i] - B_collect_m[0, N + i];
-          RHS[n - N + i] += boundary_up_m[i] + (BDRF_RHS_contribution[i] - B_collect_m[ln, i]) *
-                                                   std::exp(-scaled_tau_arr_with_0.back() / mu0);
-        }
-      } else {
-        RHS[rf(N)]           += boundary_down_m;
-        RHS[Range{n - N, N}] += boundary_up_m;
+      for (Index i = 0; i < N; i++) {
+        RHS[i]         += boundary_down_m[i] - B_collect_m[0, N + i];
+        RHS[n - N + i] += boundary_up_m[i] + (BDRF_RHS_contribution[i] - B_collect_m[ln, i]) *
+                                                 std::exp(-scaled_tau_arr_with_0.back() / mu0);
       }
+    } else {
+      RHS[rf(N)]           += boundary_down_m;
+      RHS[Range{n - N, N}] += boundary_up_m;
     }
+  }
 
-    // Fill LHS
-    {
-      ARTS_NAMED_TIME_REPORT("disort::lhs"s);
+  // Fill LHS
+  {
+    ARTS_NAMED_TIME_REPORT("disort::lhs"s);
 
-      if (BDRF_bool) {
-        mult(BDRF_LHS, R, G_collect_m[ln, rb(N)]);
-      } else if (m == NBDRF) {  // only once
-        BDRF_LHS = 0;
+    if (BDRF_bool) {
+      mult(BDRF_LHS, R, G_collect_m[ln, rb(N)]);
+    } else if (m == NBDRF) {  // only once
+      BDRF_LHS = 0;
+    }
+
+    for (Index j = 0; j < N; j++) {
+      for (Index i = 0; i < N; i++) {
+        LHSB[i, j]                     = G_collect_m[0, i + N, j];
+        LHSB[i, N + j]                 = G_collect_m[0, i + N, j + N] * expK_collect[m, 0, j];
+        LHSB[n - N + i, n - 2 * N + j] = (G_collect_m[ln, i, j] - BDRF_LHS[i, j]) * expK_collect[m, ln, j];
+        LHSB[n - N + i, n - N + j]     = G_collect_m[ln, i, j + N] - BDRF_LHS[i, j + N];
       }
+    }
 
+    for (Index l = 0; l < ln; l++) {
       for (Index j = 0; j < N; j++) {
+        const Numeric e1 = 1.0 / expK_collect[m, l, j + N];
+        const Numeric e2 = 1.0 / expK_collect[m, l + 1, j + N];
         for (Index i = 0; i < N; i++) {
-          LHSB[i, j]                     = G_collect_m[0, i + N, j];
-          LHSB[i, N + j]                 = G_collect_m[0, i + N, j + N] * expK_collect[m, 0, j];
-          LHSB[n - N + i, n - 2 * N + j] = (G_collect_m[ln, i, j] - BDRF_LHS[i, j]) * expK_collect[m, ln, j];
-          LHSB[n - N + i, n - N + j]     = G_collect_m[ln, i, j + N] - BDRF_LHS[i, j + N];
+          LHSB[N + l * NQuad + i, l * NQuad + j]                     = G_collect_m[l, i, j] * e1;
+          LHSB[2 * N + l * NQuad + i, l * NQuad + j]                 = G_collect_m[l, N + i, j] * e1;
+          LHSB[N + l * NQuad + i, l * NQuad + 2 * NQuad - N + j]     = -G_collect_m[l + 1, i, N + j] * e2;
+          LHSB[2 * N + l * NQuad + i, l * NQuad + 2 * NQuad - N + j] = -G_collect_m[l + 1, N + i, N + j] * e2;
         }
       }
 
-      for (Index l = 0; l < ln; l++) {
+      for (Index i = 0; i < NQuad; i++) {
         for (Index j = 0; j < N; j++) {
-          const Numeric e1 = 1.0 / expK_collect[m, l, j + N];
-          const Numeric e2 = 1.0 / expK_collect[m, l + 1, j + N];
-          for (Index i = 0; i < N; i++) {
-            LHSB[N + l * NQuad + i, l * NQuad + j]                     = G_collect_m[l, i, j] * e1;
-            LHSB[2 * N + l * NQuad + i, l * NQuad + j]                 = G_collect_m[l, N + i, j] * e1;
-            LHSB[N + l * NQuad + i, l * NQuad + 2 * NQuad - N + j]     = -G_collect_m[l + 1, i, N + j] * e2;
-            LHSB[2 * N + l * NQuad + i, l * NQuad + 2 * NQuad - N + j] = -G_collect_m[l + 1, N + i, N + j] * e2;
-          }
-        }
-
-        for (Index i = 0; i < NQuad; i++) {
-          for (Index j = 0; j < N; j++) {
-            LHSB[N + l * NQuad + i, l * NQuad + N + j]     = G_collect_m[l, i, N + j];
-            LHSB[N + l * NQuad + i, l * NQuad + 2 * N + j] = -G_collect_m[l + 1, i, j];
-          }
+          LHSB[N + l * NQuad + i, l * NQuad + N + j]     = G_collect_m[l, i, N + j];
+          LHSB[N + l * NQuad + i, l * NQuad + 2 * N + j] = -G_collect_m[l + 1, i, j];
         }
       }
     }
+  }
+}
+
+void main_data::set_coefs(const Index m) {
+  einsum<"ijm", "ijm", "im">(GC_collect[m], G_collect[m], RHS.view_as(NLayers, NQuad));
+}
+
+void main_data::solve_for_coefs() {
+  ARTS_TIME_REPORT
+
+  for (Index m = 0; m < NFourier; m++) {
+    assemble_coefs_system(m);
 
     {
       ARTS_NAMED_TIME_REPORT("disort::solve-band"s);
@@ -508,19 +517,42 @@ void main_data::solve_for_coefs() {
       if (LHSB.solve(RHS)) {
         throw std::runtime_error(std::format("Disort failed to converge for Fourier mode {}.", m));
       }
-
-      einsum<"ijm", "ijm", "im">(GC_collect[m], G_collect_m, RHS.view_as(NLayers, NQuad));
     }
+
+    set_coefs(m);
   }
 }
 
 namespace {
 Numeric poch(Index x, Index n) { return Legendre::tgamma_ratio(static_cast<Numeric>(x + n), static_cast<Numeric>(x)); }
+
+bool nearly_equal(const Numeric a, const Numeric b, const Numeric tol) {
+  return a == b or std::abs(a - b) <= tol * std::max(std::abs(a), std::abs(b));
+}
 }  // namespace
 
+Index main_data::reused_layer_count() const { return stdr::count(diag_reused, true); }
+
 void main_data::diagonalize() {
   ARTS_TIME_REPORT
 
+  // Find the layers with the same scattering properties as at the previous call
+  const bool same_size = static_cast<Index>(diag_scaled_omega.size()) == NLayers and
+                         diag_Leg_coeffs.shape() == weighted_scaled_Leg_coeffs.shape();
+  const bool same_beam =
+      diag_beam == has_beam_source and (not has_beam_source or (diag_mu0 == mu0 and diag_I0 == I0));
+
+  diag_reused.assign(NLayers, false);
+  if (reuse_tolerance >= 0.0 and same_size) {
+    const auto eq = [tol = reuse_tolerance](Numeric a, Numeric b) { return nearly_equal(a, b, tol); };
+    for (Index l = 0; l < NLayers; l++) {
+      diag_reused[l] = eq(scaled_omega_arr[l], diag_scaled_omega[l]) and
+                       stdr::equal(weighted_scaled_Leg_coeffs[l], diag_Leg_coeffs[l], eq);
+    }
+  }
+
+  if (same_beam and stdr::all_of(diag_reused, std::identity{})) return;
+
   for (Index m = 0; m < NFourier; m++) {
     auto Km = K_collect[m];
     auto Gm = G_collect[m];
@@ -552,6 +584,9 @@ void main_data::diagonalize() {
         stdr::all_of(asso_leg_term_pos | by_elem, [](auto& x) { return std::isfinite(x); });
 
     for (Index l = 0; l < NLayers; l++) {
+      const bool reuse_eigen = diag_reused[l];
+      if (reuse_eigen and same_beam) continue;
+
       VectorView K = Km[l];
       MatrixView G = Gm[l];
 
@@ -563,42 +598,44 @@ void main_data::diagonalize() {
 
       if (scaled_omega_l != 0.0 or
           (all_asso_leg_term_pos_finite and stdr::any_of(weighted_asso_Leg_coeffs_l, Cmp::gt(0)))) {
-        einsum<"ij", "j", "ji">(D_temp, weighted_asso_Leg_coeffs_l, asso_leg_term_pos);
-        mult(D_pos, D_temp, asso_leg_term_pos, 0.5 * scaled_omega_l);
-        mult(D_neg, D_temp, asso_leg_term_neg, 0.5 * scaled_omega_l);
+        if (not reuse_eigen) {
+          einsum<"ij", "j", "ji">(D_temp, weighted_asso_Leg_coeffs_l, asso_leg_term_pos);
+          mult(D_pos, D_temp, asso_leg_term_pos, 0.5 * scaled_omega_l);
+          mult(D_neg, D_temp, asso_leg_term_neg, 0.5 * scaled_omega_l);
 
-        einsum<"ij", "i", "ij", "j">(sqr, inv_mu_arr[rf(N)], D_neg, W);
-        einsum<"ij", "i", "ij", "j">(apb, inv_mu_arr[rf(N)], D_pos, W);
-        diagonal(apb) -= inv_mu_arr[rf(N)];
+          einsum<"ij", "i", "ij", "j">(sqr, inv_mu_arr[rf(N)], D_neg, W);
+          einsum<"ij", "i", "ij", "j">(apb, inv_mu_arr[rf(N)], D_pos, W);
+          diagonal(apb) -= inv_mu_arr[rf(N)];
 
-        amb  = apb;  // still just alpha
-        apb += sqr;  // sqr is beta
-        amb -= sqr;
+          amb  = apb;  // still just alpha
+          apb += sqr;  // sqr is beta
+          amb -= sqr;
 
-        VectorView eval = K[rf(N)];
-        MatrixView evec = amb;
-        MatrixView AB   = apb;
+          VectorView eval = K[rf(N)];
+          MatrixView evec = amb;
+          MatrixView AB   = apb;
 
-        mult(sqr, evec, AB);
+          mult(sqr, evec, AB);
 
-        diagonalize_inplace(evec, eval, sqr, diag_work);
+          diagonalize_inplace(evec, eval, sqr, diag_work);
 
-        for (Index i = 0; i < N; i++) {
-          const Numeric sqrt_x = std::sqrt(std::abs(eval[i]));
-          K[i]                 = -sqrt_x;
-          K[i + N]             = sqrt_x;
-        }
+          for (Index i = 0; i < N; i++) {
+            const Numeric sqrt_x = std::sqrt(std::abs(eval[i]));
+            K[i]                 = -sqrt_x;
+            K[i + N]             = sqrt_x;
+          }
 
-        mult(sqr, AB, evec);
+          mult(sqr, AB, evec);
 
-        for (Index i = 0; i < N; i++) {
-          for (Index j = 0; j < N; j++) {
-            const Numeric a = evec[i, j];
-            const Numeric b = sqr[i, j] / K[j];
-            G[i, j]         = 0.5 * (a - b);
-            G[i, j + N]     = 0.5 * (a + b);
-            G[i + N, j]     = G[i, j + N];
-            G[i + N, j + N] = G[i, j];
+          for (Index i = 0; i < N; i++) {
+            for (Index j = 0; j < N; j++) {
+              const Numeric a = evec[i, j];
+              const Numeric b = sqr[i, j] / K[j];
+              G[i, j]         = 0.5 * (a - b);
+              G[i, j + N]     = 0.5 * (a + b);
+              G[i + N, j]     = G[i, j + N];
+              G[i + N, j + N] = G[i, j];
+            }
           }
         }
 
@@ -621,7 +658,7 @@ void main_data::diagonalize() {
 
           mult(Bm[l], G, jvec, -1);
         }
-      } else {
+      } else if (not reuse_eigen) {
         G[rf(N), rf(N)]           = 0.0;
         G[rb(N), rb(N)]           = 0.0;
         G[rb(N), rf(N)]           = 0.0;
@@ -635,6 +672,18 @@ void main_data::diagonalize() {
       }
     }
   }
+
+  // Reused layers keep their reference, so that slow drifts do not accumulate past the tolerance
+  diag_scaled_omega.resize(NLayers);
+  diag_Leg_coeffs.resize(NLayers, NLeg);
+  for (Index l = 0; l < NLayers; l++) {
+    if (diag_reused[l]) continue;
+    diag_scaled_omega[l] = scaled_omega_arr[l];
+    diag_Leg_coeffs[l]   = weighted_scaled_Leg_coeffs[l];
+  }
+  diag_mu0  = mu0;
+  diag_I0   = I0;
+  diag_beam = has_beam_source;
 }
 
 /** Computes the IMS factors
@@ -838,18 +887,22 @@ void main_data::source_function() {
                NLayers);
 }
 
-void main_data::update_all(const Numeric I0_) {
-  ARTS_TIME_REPORT
-
+void main_data::update_all_but_coefs(const Numeric I0_) {
   check_input_value();
 
-  set_weighted_Leg_coeffs_all();
+  if (not flux_only) set_weighted_Leg_coeffs_all();
   if (I0_ >= 0 or has_beam_source) { set_beam_source(I0_ >= 0 ? I0_ : I0 * I0_orig); }
   set_scales();
-  set_ims_factors();
+  if (not flux_only) set_ims_factors();
   diagonalize();
   transmission();
   source_function();
+}
+
+void main_data::update_all(const Numeric I0_) {
+  ARTS_TIME_REPORT
+
+  update_all_but_coefs(I0_);
   solve_for_coefs();
   rad_field();
 }
@@ -1032,6 +1085,65 @@ main_data::main_data(const Index       NQuad_,
   update_all(I0_);
 }
 
+main_data main_data::flux_model(const Index NLayers_,
+                                const Index NQuad_,
+                                const Index NLeg_,
+                                const Index Nscoeffs_,
+                                const Index NLeg_all_,
+                                const Index NBDRF_) {
+  main_data out(NLayers_, NQuad_, NLeg_, 1, Nscoeffs_, NLeg_all_, std::min<Index>(NBDRF_, 1));
+
+  // Only used by the intensity corrections
+  out.Leg_coeffs_residue_avg  = Vector{};
+  out.weighted_Leg_coeffs_all = Matrix{};
+
+  out.flux_only = true;
+  return out;
+}
+
+batch::batch(main_data model, const Index size)
+    : LHSB(3 * model.N - 1, 3 * model.N - 1, model.n, size), RHS(model.n, size) {
+  ARTS_USER_ERROR_IF(size < 1, "A batch must hold at least one model, got {}", size)
+
+  models.reserve(size);
+  for (Index k = 1; k < size; k++) models.push_back(model);
+  models.push_back(std::move(model));
+}
+
+void batch::update_all(const ConstVectorView& I0) {
+  ARTS_TIME_REPORT
+
+  const Index nk = I0.size();
+  ARTS_USER_ERROR_IF(nk > size(), "Cannot update {} models in a batch of size {}", nk, size())
+  if (nk == 0) return;
+
+  for (Index k = 0; k < nk; k++) models[k].update_all_but_coefs(I0[k]);
+
+  for (Index m = 0; m < models.front().NFourier; m++) {
+    for (Index k = 0; k < nk; k++) {
+      models[k].assemble_coefs_system(m);
+      LHSB.set(k, models[k].LHSB);
+      RHS[joker, k] = models[k].RHS;
+    }
+
+    {
+      ARTS_NAMED_TIME_REPORT("disort::solve-band-batch"s);
+
+      if (const Index k = LHSB.solve(RHS, nk); k != 0) {
+        throw std::runtime_error(
+            std::format("Disort failed to converge for Fourier mode {} of model {} in the batch.", m, k - 1));
+      }
+    }
+
+    for (Index k = 0; k < nk; k++) {
+      models[k].RHS = RHS[joker, k];
+      models[k].set_coefs(m);
+    }
+  }
+
+  for (Index k = 0; k < nk; k++) models[k].rad_field();
+}
+
 [[nodiscard]] Index main_data::tau_index(const Numeric tau) const {
   ARTS_TIME_REPORT
 
@@ -1155,6 +1267,8 @@ void calculate_nu(Vector& nu, const ConstVectorView& mu, const Numeric phi, cons
 void main_data::TMS(tms_data& data, const Numeric tau, const Numeric phi) const {
   ARTS_TIME_REPORT
 
+  ARTS_USER_ERROR_IF(flux_only, "The TMS correction is not available for a flux-only model")
+
   ARTS_USER_ERROR_IF(tau < 0, "tau ({}) must be positive", tau);
 
   const Index l = tau_index(tau);
@@ -1221,6 +1335,8 @@ void main_data::TMS(tms_data& data, const Numeric tau, const Numeric phi) const
 void main_data::IMS(Vector& ims, const Numeric tau, const Numeric phi) const {
   ARTS_TIME_REPORT
 
+  ARTS_USER_ERROR_IF(flux_only, "The IMS correction is not available for a flux-only model")
+
   ARTS_USER_ERROR_IF(tau < 0, "tau ({}) must be positive", tau);
 
   ims.resize(N);
@@ -1699,29 +1815,56 @@ disort::main_data DisortSettings::init() const {
                            bidirectional_reflectance_distribution_functions.ncols());
 }
 
-disort::main_data& DisortSettings::set(disort::main_data& dis, Index iv) const {
+disort::main_data DisortSettings::init_flux() const {
+  check();
+  return disort::main_data::flux_model(alt_grid.size() - 1,
+                                       quadrature_dimension,
+                                       legendre_coefficients.ncols(),
+                                       source_polynomial.ncols(),
+                                       legendre_polynomial_dimension,
+                                       bidirectional_reflectance_distribution_functions.ncols());
+}
+
+namespace {
+// A flux model has fewer Fourier modes and BDRF modes than the settings
+void set_inputs(const DisortSettings& x, disort::main_data& dis, Index iv) {
   using Conversion::cosd;
   using Conversion::deg2rad;
 
-  for (Index i = 0; i < bidirectional_reflectance_distribution_functions.ncols(); i++) {
-    dis.brdf_modes()[i] = bidirectional_reflectance_distribution_functions[iv, i];
+  for (Index i = 0; i < static_cast<Index>(dis.brdf_modes().size()); i++) {
+    dis.brdf_modes()[i] = x.bidirectional_reflectance_distribution_functions[iv, i];
   }
 
-  dis.tau(optical_thicknesses[iv]);
-  dis.solar_zenith()        = cosd(solar_zenith_angle[iv]);
-  dis.beam_azimuth()        = deg2rad(solar_azimuth_angle[iv]);
-  dis.omega()               = single_scattering_albedo[iv];
-  dis.f()                   = fractional_scattering[iv];
-  dis.all_legendre_coeffs() = legendre_coefficients[iv];
-  dis.upward_boundary()     = upward_boundary_condition[iv];
-  dis.downward_boundary()   = downward_boundary_condition[iv];
-  dis.source_poly()         = source_polynomial[iv];
+  const Range fourier_modes(0, dis.upward_boundary().nrows());
+
+  dis.tau(x.optical_thicknesses[iv]);
+  dis.solar_zenith()        = cosd(x.solar_zenith_angle[iv]);
+  dis.beam_azimuth()        = deg2rad(x.solar_azimuth_angle[iv]);
+  dis.omega()               = x.single_scattering_albedo[iv];
+  dis.f()                   = x.fractional_scattering[iv];
+  dis.all_legendre_coeffs() = x.legendre_coefficients[iv];
+  dis.upward_boundary()     = x.upward_boundary_condition[iv][fourier_modes];
+  dis.downward_boundary()   = x.downward_boundary_condition[iv][fourier_modes];
+  dis.source_poly()         = x.source_polynomial[iv];
+}
+}  // namespace
+
+disort::main_data& DisortSettings::set(disort::main_data& dis, Index iv) const {
+  set_inputs(*this, dis, iv);
 
   dis.update_all(solar_source[iv]);
 
   return dis;
 }
 
+void DisortSettings::set(disort::batch& dis, Index iv, Index n) const {
+  ARTS_USER_ERROR_IF(n > dis.size(), "Batch of size {} cannot hold {} frequencies", dis.size(), n)
+
+  for (Index k = 0; k < n; k++) set_inputs(*this, dis[k], iv + k);
+
+  dis.update_all(solar_source[Range(iv, n)]);
+}
+
 #ifdef ENABLE_CDISORT
 disort::main_data& DisortSettings::set_cdisort(disort::main_data& dis, Index iv) const {
   using Conversion::cosd;
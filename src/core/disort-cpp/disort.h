@@ -125,6 +125,7 @@ class main_data {
   Index NBDRF{0};
   bool  has_source_poly{false};
   bool  has_beam_source{false};
+  bool  flux_only{false};
 
   //! User inputs
   AscendingGrid     tau_arr{};             // [NLayers]
@@ -202,8 +203,27 @@ class main_data {
   //! [NQuad, Nscoeffs] + [NQuad, NQuad] + 3 * [Nquad] + [Nscoeffs]
   mathscr_v_data comp_data{};
 
+  //! Reuse of the diagonalization, see diagonalize
+  Numeric           reuse_tolerance{0.0};
+  Vector            diag_scaled_omega{};  // [NLayers]
+  Matrix            diag_Leg_coeffs{};    // [NLayers, NLeg]
+  Numeric           diag_mu0{-1};
+  Numeric           diag_I0{-1};
+  bool              diag_beam{false};
+  std::vector<bool> diag_reused{};  // [NLayers]
+
+  //! Fills LHSB and RHS for Fourier mode m, see solve_for_coefs
+  void assemble_coefs_system(const Index m);
+
+  //! Sets GC_collect[m] from the solution in RHS
+  void set_coefs(const Index m);
+
+  //! All of update_all before solve_for_coefs
+  void update_all_but_coefs(const Numeric I0);
+
  public:
   friend struct std::formatter<main_data>;
+  friend class batch;
 
   main_data()                            = default;
   main_data(const main_data&)            = default;
@@ -234,6 +254,28 @@ class main_data {
             Numeric           I0,
             Numeric           phi0);
 
+  /** A model that only computes fluxes
+    *
+    * Only the azimuth-independent Fourier mode is allocated and solved, and
+    * the factors of the intensity corrections are neither allocated nor
+    * computed.  The fluxes are the same as those of the full model.  The
+    * intensities are their azimuthal averages, and TMS and IMS throw.
+    *
+    * Only the first row of the boundary conditions and the first BDRF mode
+    * are used, so the model has at most one of each.
+    *
+    * The inputs must be set and update_all called before use.
+    */
+  [[nodiscard]] static main_data flux_model(const Index NLayers,
+                                            const Index NQuad,
+                                            const Index NLeg,
+                                            const Index Nscoeffs,
+                                            const Index NLeg_all,
+                                            const Index NBDRF);
+
+  //! Whether this is a flux_model
+  [[nodiscard]] bool only_fluxes() const { return flux_only; }
+
   /** Get the index of the tau value closest to the given tau
     *
     * Throws if tau is out-of-bounds
@@ -403,6 +445,12 @@ class main_data {
     * this method, as it will update all values correctly.
     *
     * Not safe for parallel use.
+    *
+    * The eigenpairs of a layer only depend on its scattering properties.
+    * A layer whose weighted_scaled_Leg_coeffs and scaled_omega_arr are
+    * the same as at the previous call, to within the relative reuse
+    * tolerance, keeps its G_collect and K_collect.  Its B_collect is also
+    * kept if mu0 and I0 are unchanged.
     * 
     * Depends on:
     * - weighted_scaled_Leg_coeffs 
@@ -619,6 +667,55 @@ class main_data {
 
   //! Get weights on a grid
   [[nodiscard]] ZenGriddedField1 gridded_weights() const;
+
+  /** The relative tolerance for reusing the diagonalization of a layer, see diagonalize
+    *
+    * The default, 0, only reuses layers with identical scattering properties.
+    * A negative tolerance diagonalizes all layers on every update.
+    */
+  [[nodiscard]] Numeric& diagonalization_reuse_tolerance() { return reuse_tolerance; }
+
+  //! The number of layers that kept their diagonalization in the last update
+  [[nodiscard]] Index reused_layer_count() const;
+};
+
+/** Several models of the same size that are updated together
+  *
+  * The banded systems of equations of all models are solved together
+  * for each Fourier mode by matpack::batched_band_matrix, whose loops run
+  * over the models innermost.  Everything else is done model by model,
+  * exactly as by main_data::update_all.
+  *
+  * Not safe for parallel use, give each thread its own batch.
+  */
+class batch {
+  std::vector<main_data>       models{};
+  matpack::batched_band_matrix LHSB{};
+  Matrix                       RHS{};  // [n, size]
+
+ public:
+  batch() = default;
+
+  /** Fills the batch with a model
+    *
+    * The model is moved into the last slot and copied into the others.
+    *
+    * @param model The model, only its sizes matter
+    * @param size The number of models
+    */
+  batch(main_data model, const Index size);
+
+  [[nodiscard]] Index size() const { return static_cast<Index>(models.size()); }
+
+  template <typename Self> [[nodiscard]] auto& operator[](this Self&& self, const Index k) { return self.models[k]; }
+
+  /** Updates the first I0.size() models
+    *
+    * The inputs of the models must be set before calling this.
+    *
+    * @param I0 The new beam intensity of each model, or -1 to keep it, see main_data::update_all
+    */
+  void update_all(const ConstVectorView& I0);
 };
 
 /** Iteratively exchange interface boundary conditions between two DISORT models
@@ -701,7 +798,19 @@ struct DisortSettings {
   [[nodiscard]] Index layer_count() const { return alt_grid.size() - 1; }
 
   [[nodiscard]] disort::main_data init() const;
-  disort::main_data&              set(disort::main_data&, Index iv) const;
+
+  //! A model for set that only computes fluxes, see disort::main_data::flux_model
+  [[nodiscard]] disort::main_data init_flux() const;
+
+  disort::main_data& set(disort::main_data&, Index iv) const;
+
+  /** Sets and updates the models of the batch to frequencies iv to iv + n - 1
+    *
+    * @param dis The batch, at least n large
+    * @param iv The first frequency
+    * @param n The number of frequencies
+    */
+  void set(disort::batch& dis, Index iv, Index n) const;
 #ifdef ENABLE_CDISORT
   disort::main_data& set_cdisort(disort::main_data&, Index iv) const;
 #endif
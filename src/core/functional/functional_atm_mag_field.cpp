@@ -9,10 +9,16 @@
 #include <planet_data.h>
 
 namespace Atm {
-Numeric IGRF13::operator()(Numeric a, Numeric la, Numeric lo) const {
+Vector3 IGRF13::field(Numeric a, Numeric la, Numeric lo) const {
   constexpr Vector2 ell{Body::Earth::a, Body::Earth::b};
 
-  const Vector3 mag = IGRF::igrf({a, la, lo}, ell, time);
+  return IGRF::igrf({a, la, lo}, ell, time);
+}
+
+bool IGRF13::same_field(const IGRF13& other) const { return time == other.time; }
+
+Numeric IGRF13::operator()(Numeric a, Numeric la, Numeric lo) const {
+  const Vector3 mag = field(a, la, lo);
 
   switch (component) {
     case FieldComponent::u: return mag[0];
@@ -38,7 +44,7 @@ SchmidthLegendre from(const IGRF13& x) {
   return result;
 }
 
-Numeric SchmidthLegendre::operator()(Numeric a, Numeric la, Numeric lo) const {
+Vector3 SchmidthLegendre::field(Numeric a, Numeric la, Numeric lo) const {
   using Conversion::cosd, Conversion::sind;
 
   const Vector3 geoc = geodetic2geocentric({a, la, lo}, ell);
@@ -48,10 +54,21 @@ Numeric SchmidthLegendre::operator()(Numeric a, Numeric la, Numeric lo) const {
   const Numeric ca  = std::cos(ang);
   const Numeric sa  = std::sin(ang);
 
+  return {mag[2], -ca * mag[1] - sa * mag[0], -sa * mag[1] + ca * mag[0]};
+}
+
+bool SchmidthLegendre::same_field(const SchmidthLegendre& other) const {
+  return N == other.N and r0 == other.r0 and ell == other.ell and gh.shape() == other.gh.shape() and
+         gh == other.gh;
+}
+
+Numeric SchmidthLegendre::operator()(Numeric a, Numeric la, Numeric lo) const {
+  const Vector3 mag = field(a, la, lo);
+
   switch (component) {
-    case FieldComponent::u: return mag[2];
-    case FieldComponent::v: return -ca * mag[1] - sa * mag[0];
-    case FieldComponent::w: return -sa * mag[1] + ca * mag[0];
+    case FieldComponent::u: return mag[0];
+    case FieldComponent::v: return mag[1];
+    case FieldComponent::w: return mag[2];
   }
 
   return NAN;  // Should never happen
@@ -11,6 +11,12 @@ struct IGRF13 {
   FieldComponent component{};
 
   Numeric operator()(Numeric, Numeric, Numeric) const;
+
+  //! All components [u, v, w] of the field from a single evaluation
+  [[nodiscard]] Vector3 field(Numeric, Numeric, Numeric) const;
+
+  //! True if other is a component of the same field
+  [[nodiscard]] bool same_field(const IGRF13& other) const;
 };
 
 struct SchmidthLegendre {
@@ -22,6 +28,12 @@ struct SchmidthLegendre {
 
   Numeric operator()(Numeric, Numeric, Numeric) const;
 
+  //! All components [u, v, w] of the field from a single evaluation
+  [[nodiscard]] Vector3 field(Numeric, Numeric, Numeric) const;
+
+  //! True if other is a component of the same field
+  [[nodiscard]] bool same_field(const SchmidthLegendre& other) const;
+
   [[nodiscard]] ConstVectorView                        x() const;
   [[nodiscard]] VectorView                             x();
   [[nodiscard]] std::vector<std::pair<Index, Numeric>> w(Numeric alt, Numeric lat, Numeric lon) const;
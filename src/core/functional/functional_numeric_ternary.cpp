@@ -62,11 +62,78 @@ template <Size I = 0> std::vector<std::pair<Index, Numeric>> get_w_tmpl(const Nu
   }
 }
 
+template <typename T>
+concept vector_component = requires(const T a) {
+  { a.component } -> std::convertible_to<FieldComponent>;
+  { a.field(Numeric{}, Numeric{}, Numeric{}) } -> std::same_as<Vector3>;
+  { a.same_field(a) } -> std::same_as<bool>;
+};
+
+template <Size I = 0> std::optional<Vector3> get_uvw_tmpl(const NumericTernary& u,
+                                                          const NumericTernary& v,
+                                                          const NumericTernary& w,
+                                                          Numeric               alt [[maybe_unused]],
+                                                          Numeric               lat [[maybe_unused]],
+                                                          Numeric               lon [[maybe_unused]]) {
+  if constexpr (I < std::variant_size_v<var_t>) {
+    using T = std::variant_alternative_t<I, var_t>;
+
+    if constexpr (vector_component<T>) {
+      if (const T* pu = u.template target<T>(); pu != nullptr) {
+        const T* pv = v.template target<T>();
+        const T* pw = w.template target<T>();
+
+        if (pv == nullptr or pw == nullptr) return std::nullopt;
+        if (pu->component != FieldComponent::u or pv->component != FieldComponent::v or
+            pw->component != FieldComponent::w)
+          return std::nullopt;
+        if (not pu->same_field(*pv) or not pu->same_field(*pw)) return std::nullopt;
+
+        return pu->field(alt, lat, lon);
+      }
+    }
+
+    return get_uvw_tmpl<I + 1>(u, v, w, alt, lat, lon);
+  } else {
+    return std::nullopt;
+  }
+}
+
+static_assert(vector_component<Atm::IGRF13>);
+static_assert(vector_component<Atm::SchmidthLegendre>);
 static_assert(jacable<Atm::SchmidthLegendre>);
 static_assert(jacable<Atm::MagnitudeField>);
 static_assert(jacable<Atm::External>);
 }  // namespace
 
+Numeric Batched::operator()(Numeric alt, Numeric lat, Numeric lon) const {
+  Numeric out{};
+  f(VectorView{out}, ConstVectorView{alt}, ConstVectorView{lat}, ConstVectorView{lon});
+  return out;
+}
+
+bool is_batched(const NumericTernary& f) { return f.target<Batched>() != nullptr; }
+
+void get_batch(VectorView             out,
+               const NumericTernary&  f,
+               const ConstVectorView& alt,
+               const ConstVectorView& lat,
+               const ConstVectorView& lon) {
+  ARTS_USER_ERROR_IF(alt.size() != out.size() or lat.size() != out.size() or lon.size() != out.size(),
+                     "Mismatching sizes: out {}, alt {}, lat {}, lon {}",
+                     out.size(),
+                     alt.size(),
+                     lat.size(),
+                     lon.size())
+
+  if (const Batched* ptr = f.target<Batched>(); ptr != nullptr) {
+    ptr->f(out, alt, lat, lon);
+    return;
+  }
+
+  for (Size i = 0; i < out.size(); i++) out[i] = f(alt[i], lat[i], lon[i]);
+}
+
 ConstVectorView get_xc(const NumericTernary& f) { return get_x_tmpl(f); }
 
 VectorView get_xm(NumericTernary& f) { return get_x_tmpl(f); }
@@ -75,6 +142,15 @@ std::vector<std::pair<Index, Numeric>> get_w(const NumericTernary& f, Numeric al
   return get_w_tmpl(f, alt, lat, lon);
 }
 
+std::optional<Vector3> get_uvw(const NumericTernary& u,
+                               const NumericTernary& v,
+                               const NumericTernary& w,
+                               Numeric               alt,
+                               Numeric               lat,
+                               Numeric               lon) {
+  return get_uvw_tmpl(u, v, w, alt, lat, lon);
+}
+
 bool is_field_function(const NumericTernary& f) {
   if (const auto& ptr = f.target<Atm::External>(); ptr != nullptr) return ptr->is_field_function;
 
@@ -2,6 +2,8 @@
 
 #include <xml.h>
 
+#include <optional>
+
 #include "functional_atm.h"
 #include "functional_atm_field.h"
 #include "functional_gravity.h"
@@ -9,6 +11,31 @@
 using NumericTernary = std::function<Numeric(Numeric, Numeric, Numeric)>;
 
 namespace ternary {
+//! Sets out[i] to the value at (alt[i], lat[i], lon[i])
+using NumericTernaryBatch =
+    std::function<void(VectorView out, const ConstVectorView& alt, const ConstVectorView& lat, const ConstVectorView& lon)>;
+
+/** A NumericTernary that can evaluate many positions in one call
+ *
+ * Meant for functions with a large cost per call, such as Python callbacks
+ * that must hold the GIL.  A single position is a batch of one.
+ */
+struct Batched {
+  NumericTernaryBatch f;
+
+  Numeric operator()(Numeric alt, Numeric lat, Numeric lon) const;
+};
+
+//! Method checks that the NumericTernary is Batched
+bool is_batched(const NumericTernary& f);
+
+//! Method that evaluates the NumericTernary at all positions, in one call if it is Batched
+void get_batch(VectorView             out,
+               const NumericTernary&  f,
+               const ConstVectorView& alt,
+               const ConstVectorView& lat,
+               const ConstVectorView& lon);
+
 //! Method that returns the x-value for retrieval from a NumericTernary
 ConstVectorView get_xc(const NumericTernary& f);
 
@@ -20,6 +47,14 @@ std::vector<std::pair<Index, Numeric>> get_w(const NumericTernary& f, Numeric al
 
 //! Method checks that the NumericTernary is a field function (i.e., requires multiple derivatives)
 bool is_field_function(const NumericTernary& f);
+
+//! Method that evaluates a vector-valued functional once if u, v, and w are its three components, otherwise nothing
+std::optional<Vector3> get_uvw(const NumericTernary& u,
+                               const NumericTernary& v,
+                               const NumericTernary& w,
+                               Numeric               alt,
+                               Numeric               lat,
+                               Numeric               lon);
 }  // namespace ternary
 
 template <> struct xml_io_stream_name<NumericTernary> {
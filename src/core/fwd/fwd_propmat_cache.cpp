@@ -0,0 +1,136 @@
+#include "fwd_propmat_cache.h"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+
+namespace fwd {
+namespace {
+std::array<Numeric, 5> observer(const Vector3& pos, const Vector2& los) {
+  return {pos[0], pos[1], pos[2], los[0], los[1]};
+}
+
+//! As a == b but ignoring the volume mixing ratios in ignore, except for that of species
+bool same_vmrs(const AtmPoint::SpeciesMap&            a,
+               const AtmPoint::SpeciesMap&            b,
+               const std::unordered_set<SpeciesEnum>& ignore,
+               const SpeciesEnum                      species) {
+  auto subset = [&](const AtmPoint::SpeciesMap& x, const AtmPoint::SpeciesMap& y) {
+    return stdr::all_of(x, [&](auto& kv) {
+      if (kv.first != species and ignore.contains(kv.first)) return true;
+      auto it = y.find(kv.first);
+      return it != y.end() and it->second == kv.second;
+    });
+  };
+
+  return subset(a, b) and subset(b, a);
+}
+
+//! The memory held by the grids of a result, the atmospheric point is small in comparison
+Size memory_of(const AscendingGrid& freq_grid, const propmat_species_cache::result& res) {
+  return sizeof(Numeric) * freq_grid.size() + sizeof(Propmat) * (res.pm.size() + res.dpm.size()) +
+         sizeof(Stokvec) * (res.sv.size() + res.dsv.size());
+}
+}  // namespace
+
+propmat_species_cache::propmat_species_cache(std::unordered_set<SpeciesEnum> vmrs,
+                                             std::unordered_set<SpeciesEnum> lines,
+                                             Size                            max_bytes)
+    : retrieved_vmrs(std::move(vmrs)),
+      retrieved_lines(std::move(lines)),
+      max_shard_bytes(std::max<Size>(max_bytes / nshards, 1)) {}
+
+propmat_species_cache::shard& propmat_species_cache::shard_of(const key& k) {
+  Size h = std::hash<SpeciesEnum>{}(k.first);
+  for (Numeric x : k.second) h = h * 31 + std::hash<Numeric>{}(x);
+  return shards[h % nshards];
+}
+
+std::shared_ptr<const propmat_species_cache::result> propmat_species_cache::find(const SpeciesEnum    species,
+                                                                                 const AscendingGrid& freq_grid,
+                                                                                 const Vector3&       pos,
+                                                                                 const Vector2&       los,
+                                                                                 const AtmPoint&      atm) {
+  auto miss = [this]() -> std::shared_ptr<const result> {
+    nmisses.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  };
+
+  if (retrieved_lines.contains(species)) return miss();
+
+  const key k{species, observer(pos, los)};
+  shard&    s = shard_of(k);
+
+  std::shared_ptr<const entry> e;
+  {
+    std::shared_lock lock(s.mtx);
+    auto             it = s.entries.find(k);
+    if (it == s.entries.end()) return miss();
+    e = it->second;
+  }
+
+  if (not stdr::equal(e->freq_grid, freq_grid)) return miss();
+  if (e->atm.pressure != atm.pressure or e->atm.temperature != atm.temperature) return miss();
+  if (not stdr::equal(e->atm.wind, atm.wind) or not stdr::equal(e->atm.mag, atm.mag)) return miss();
+  if (e->atm.isots() != atm.isots() or e->atm.nlte() != atm.nlte() or e->atm.ssprops != atm.ssprops) return miss();
+
+  // The species own volume mixing ratio always matters
+  if (not same_vmrs(e->atm.specs(), atm.specs(), retrieved_vmrs, species)) return miss();
+
+  nhits.fetch_add(1, std::memory_order_relaxed);
+  return {e, &e->res};
+}
+
+void propmat_species_cache::insert(const SpeciesEnum    species,
+                                   const AscendingGrid& freq_grid,
+                                   const Vector3&       pos,
+                                   const Vector2&       los,
+                                   const AtmPoint&      atm,
+                                   result               res) {
+  if (retrieved_lines.contains(species)) return;
+
+  const key k{species, observer(pos, los)};
+  shard&    s = shard_of(k);
+
+  const Size n = memory_of(freq_grid, res);
+  auto       e = std::make_shared<const entry>(entry{.freq_grid = freq_grid, .atm = atm, .res = std::move(res)});
+
+  std::unique_lock lock(s.mtx);
+
+  if (auto it = s.entries.find(k); it == s.entries.end()) {
+    s.entries.emplace(k, std::move(e));
+  } else {
+    s.bytes    -= memory_of(it->second->freq_grid, it->second->res);
+    it->second  = std::move(e);
+    s.order.erase(stdr::find(s.order, k));
+  }
+  s.order.push_back(k);
+  s.bytes += n;
+
+  // The newest entry is kept even if it alone is too large
+  while (s.bytes > max_shard_bytes and s.order.size() > 1) {
+    auto it  = s.entries.find(s.order.front());
+    s.bytes -= memory_of(it->second->freq_grid, it->second->res);
+    s.entries.erase(it);
+    s.order.pop_front();
+  }
+}
+
+Size propmat_species_cache::size() const {
+  Size n = 0;
+  for (auto& s : shards) {
+    std::shared_lock lock(s.mtx);
+    n += s.entries.size();
+  }
+  return n;
+}
+
+Size propmat_species_cache::bytes() const {
+  Size n = 0;
+  for (auto& s : shards) {
+    std::shared_lock lock(s.mtx);
+    n += s.bytes;
+  }
+  return n;
+}
+}  // namespace fwd
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atm.h>
+#include <matpack.h>
+#include <rtepack.h>
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_set>
+#include <utility>
+
+namespace fwd {
+/** Propagation matrices of single species along paths, for reuse between iterations
+
+  A species is reused at a path point if the frequency grid and the
+  atmospheric point are unchanged, with one exception: differences in the
+  volume mixing ratios of the retrieved species are ignored for the other
+  species.  The cross-species effects of the retrieved species, e.g., as
+  broadening species or in continua, are thus assumed to be negligible.
+
+  Species whose line parameters are retrieved are never reused, as the
+  bands are not part of the comparison.
+
+  The entries are spread over shards by their key.  find() only holds a
+  shared lock of one shard while it looks up the entry, the comparison
+  and the copying out of the result happen without any lock.  Each shard
+  drops its least recently inserted entries once it holds more than its
+  part of the size limit.
+*/
+class propmat_species_cache {
+ public:
+  //! The output of spectral_propmat_agenda for a species at a path point
+  struct result {
+    PropmatVector pm;
+    StokvecVector sv;
+    PropmatMatrix dpm;
+    StokvecMatrix dsv;
+  };
+
+ private:
+  using key = std::pair<SpeciesEnum, std::array<Numeric, 5>>;
+
+  struct entry {
+    AscendingGrid freq_grid;
+    AtmPoint      atm;
+    result        res;
+  };
+
+  static constexpr Size nshards = 64;
+
+  struct shard {
+    mutable std::shared_mutex                   mtx;
+    std::map<key, std::shared_ptr<const entry>> entries;
+    std::deque<key>                             order;
+    Size                                        bytes{0};
+  };
+
+  std::unordered_set<SpeciesEnum> retrieved_vmrs;
+  std::unordered_set<SpeciesEnum> retrieved_lines;
+
+  Size                       max_shard_bytes;
+  std::array<shard, nshards> shards;
+  std::atomic<Size>          nhits{0};
+  std::atomic<Size>          nmisses{0};
+
+  [[nodiscard]] shard& shard_of(const key& k);
+
+ public:
+  /** Sets the retrieved species and the size limit
+
+    @param vmrs The species whose volume mixing ratios are retrieved
+    @param lines The species whose line parameters are retrieved
+    @param max_bytes The approximate limit of the memory held by the results
+  */
+  propmat_species_cache(std::unordered_set<SpeciesEnum> vmrs,
+                        std::unordered_set<SpeciesEnum> lines,
+                        Size                            max_bytes = Size{1} << 30);
+
+  /** The cached result, or nullptr if it is not present or not reusable
+
+    The result is shared with the cache and stays valid after the entry
+    is replaced or dropped.
+  */
+  [[nodiscard]] std::shared_ptr<const result> find(const SpeciesEnum    species,
+                                                   const AscendingGrid& freq_grid,
+                                                   const Vector3&       pos,
+                                                   const Vector2&       los,
+                                                   const AtmPoint&      atm);
+
+  //! Caches a result, replacing any old result with the same key
+  void insert(const SpeciesEnum    species,
+              const AscendingGrid& freq_grid,
+              const Vector3&       pos,
+              const Vector2&       los,
+              const AtmPoint&      atm,
+              result               res);
+
+  //! The number of cached results
+  [[nodiscard]] Size size() const;
+
+  //! The approximate memory held by the cached results
+  [[nodiscard]] Size bytes() const;
+
+  //! The number of find() calls that found a reusable result
+  [[nodiscard]] Size hits() const { return nhits.load(std::memory_order_relaxed); }
+
+  //! The number of find() calls that found no reusable result
+  [[nodiscard]] Size misses() const { return nmisses.load(std::memory_order_relaxed); }
+};
+}  // namespace fwd
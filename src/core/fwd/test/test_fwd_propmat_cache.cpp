@@ -0,0 +1,157 @@
+#include <fwd_propmat_cache.h>
+
+#include <print>
+
+namespace {
+using result = fwd::propmat_species_cache::result;
+
+constexpr Size NJAC = 2;
+
+/* A stand-in for spectral_propmat_agenda
+
+  The result depends on the frequency grid, the temperature, and the
+  volume mixing ratios of both the species itself and of water vapour,
+  the latter as a broadening species.
+*/
+result compute(SpeciesEnum species, const AscendingGrid& freq_grid, const AtmPoint& atm) {
+  const Size    nf    = freq_grid.size();
+  const Numeric vmr   = atm[species];
+  const Numeric broad = 1.0 + atm["H2O"_spec];
+
+  result res{.pm  = PropmatVector(nf),
+             .sv  = StokvecVector(nf),
+             .dpm = PropmatMatrix(NJAC, nf),
+             .dsv = StokvecMatrix(NJAC, nf)};
+
+  for (Size i = 0; i < nf; i++) {
+    const Numeric x = vmr * broad * freq_grid[i] / atm.temperature;
+    res.pm[i]       = Propmat{x, 0.5 * x, 0.0, 0.0, 0.1 * x, 0.0, 0.0};
+    res.sv[i]       = Stokvec{0.01 * x, 0.0, 0.0, 0.0};
+    for (Size j = 0; j < NJAC; j++) {
+      res.dpm[j, i] = Propmat{static_cast<Numeric>(j + 1) * x, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+      res.dsv[j, i] = Stokvec{static_cast<Numeric>(j + 1) * 0.01 * x, 0.0, 0.0, 0.0};
+    }
+  }
+
+  return res;
+}
+
+template <typename T> bool same_elems(const T& a, const T& b) {
+  if (a.shape() != b.shape()) return false;
+
+  auto ai = a.elem_begin();
+  for (auto bi = b.elem_begin(); bi != b.elem_end(); ++ai, ++bi) {
+    if (ai->data != bi->data) return false;
+  }
+  return true;
+}
+
+bool same(const result& a, const result& b) {
+  return same_elems(a.pm, b.pm) and same_elems(a.sv, b.sv) and same_elems(a.dpm, b.dpm) and
+         same_elems(a.dsv, b.dsv);
+}
+
+int failures = 0;
+
+void check(bool ok, const char* what) {
+  if (ok) return;
+  std::println("Failed: {}", what);
+  failures++;
+}
+
+AtmPoint atmosphere() {
+  AtmPoint atm{1e4, 250.0};
+  atm["O2"_spec]  = 0.21;
+  atm["H2O"_spec] = 1e-3;
+  atm["O3"_spec]  = 5e-6;
+  return atm;
+}
+
+void test_reuse() {
+  const AscendingGrid freq_grid{1e9, 2e9, 3e9};
+  const Vector3       pos{1e4, 10.0, 20.0};
+  const Vector2       los{120.0, 30.0};
+
+  // Water vapour and ozone are retrieved, the lines of ozone too
+  fwd::propmat_species_cache cache({"H2O"_spec, "O3"_spec}, {"O3"_spec});
+
+  AtmPoint atm = atmosphere();
+  check(cache.find("O2"_spec, freq_grid, pos, los, atm) == nullptr, "empty cache misses");
+
+  for (auto spec : {"O2"_spec, "H2O"_spec, "O3"_spec}) {
+    cache.insert(spec, freq_grid, pos, los, atm, compute(spec, freq_grid, atm));
+  }
+  check(cache.size() == 2, "species with retrieved lines are not cached");
+
+  for (auto spec : {"O2"_spec, "H2O"_spec}) {
+    auto res = cache.find(spec, freq_grid, pos, los, atm);
+    check(res != nullptr, "unchanged point hits");
+    if (res) check(same(*res, compute(spec, freq_grid, atm)), "reused result equals fresh computation");
+  }
+  check(cache.find("O3"_spec, freq_grid, pos, los, atm) == nullptr, "species with retrieved lines always miss");
+
+  // The result stays valid after its entry is replaced
+  auto held = cache.find("O2"_spec, freq_grid, pos, los, atm);
+
+  AtmPoint warmer    = atm;
+  warmer.temperature = 260.0;
+  check(cache.find("O2"_spec, freq_grid, pos, los, warmer) == nullptr, "changed temperature misses");
+  cache.insert("O2"_spec, freq_grid, pos, los, warmer, compute("O2"_spec, freq_grid, warmer));
+  check(held != nullptr and same(*held, compute("O2"_spec, freq_grid, atm)), "held result survives replacement");
+
+  auto res = cache.find("O2"_spec, freq_grid, pos, los, warmer);
+  check(res != nullptr and same(*res, compute("O2"_spec, freq_grid, warmer)), "replaced result is reused");
+
+  const AscendingGrid other_grid{1e9, 2e9, 4e9};
+  check(cache.find("O2"_spec, other_grid, pos, los, warmer) == nullptr, "changed frequency grid misses");
+  check(cache.find("O2"_spec, freq_grid, pos, Vector2{121.0, 30.0}, warmer) == nullptr, "other observer misses");
+
+  // The own volume mixing ratio always matters, the other retrieved ones do not
+  AtmPoint wetter     = atm;
+  wetter["H2O"_spec] *= 2;
+  check(cache.find("H2O"_spec, freq_grid, pos, los, wetter) == nullptr, "changed own VMR misses");
+
+  AtmPoint moist_warm     = warmer;
+  moist_warm["H2O"_spec] *= 2;
+  check(cache.find("O2"_spec, freq_grid, pos, los, moist_warm) != nullptr, "changed other retrieved VMR hits");
+
+  AtmPoint less_oxygen    = atm;
+  less_oxygen["O2"_spec] *= 0.5;
+  check(cache.find("H2O"_spec, freq_grid, pos, los, less_oxygen) == nullptr, "changed unretrieved VMR misses");
+
+  check(cache.hits() == 5, "hits are counted");
+  check(cache.misses() == 7, "misses are counted");
+}
+
+void test_bound() {
+  const AscendingGrid freq_grid{1e9, 2e9, 3e9};
+  const Vector2       los{120.0, 30.0};
+  const AtmPoint      atm = atmosphere();
+
+  const result one   = compute("O2"_spec, freq_grid, atm);
+  const Size   bytes = sizeof(Numeric) * freq_grid.size() + sizeof(Propmat) * (one.pm.size() + one.dpm.size()) +
+                     sizeof(Stokvec) * (one.sv.size() + one.dsv.size());
+
+  // Room for about 4 results per shard
+  constexpr Size NPOS = 10'000;
+  fwd::propmat_species_cache cache({}, {}, 64 * 4 * bytes);
+  for (Size i = 0; i < NPOS; i++) {
+    const Vector3 pos{1e4, static_cast<Numeric>(i), 0.0};
+    cache.insert("O2"_spec, freq_grid, pos, los, atm, one);
+  }
+
+  check(cache.size() < NPOS, "the size limit drops results");
+  check(cache.bytes() <= 64 * 4 * bytes, "the size limit holds");
+
+  // The last inserted result is always kept
+  const Vector3 last{1e4, static_cast<Numeric>(NPOS - 1), 0.0};
+  auto          res = cache.find("O2"_spec, freq_grid, last, los, atm);
+  check(res != nullptr and same(*res, one), "newest result is kept");
+}
+}  // namespace
+
+int main() {
+  test_reuse();
+  test_bound();
+  return failures == 0 ? 0 : 1;
+}
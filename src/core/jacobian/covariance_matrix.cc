@@ -8,9 +8,13 @@
 
 #include "covariance_matrix.h"
 
+#include <arts_omp.h>
+#include <debug.h>
 #include <lin_alg.h>
 #include <xml.h>
 
+#include <algorithm>
+#include <cmath>
 #include <ostream>
 #include <queue>
 #include <tuple>
@@ -35,6 +39,216 @@ CovarianceMatrix &CovarianceMatrix::operator=(const CovarianceMatrix &)     = de
 CovarianceMatrix &CovarianceMatrix::operator=(CovarianceMatrix &&) noexcept = default;
 CovarianceMatrix::~CovarianceMatrix()                                       = default;
 
+//------------------------------------------------------------------------------
+// Kronecker covariance
+//------------------------------------------------------------------------------
+namespace {
+//! The lower Cholesky factor of a symmetric positive definite matrix
+Matrix cholesky(ConstMatrixView A) {
+  const Index n = A.nrows();
+  ARTS_USER_ERROR_IF(A.ncols() != n, "Correlation matrix must be square, has shape {:B,}", A.shape())
+
+  Matrix L(n, n, 0.0);
+  for (Index j = 0; j < n; j++) {
+    Numeric d = A[j, j];
+    for (Index k = 0; k < j; k++) d -= L[j, k] * L[j, k];
+    ARTS_USER_ERROR_IF(d <= 0.0, "Correlation matrix is not positive definite (pivot {} is {})", j, d)
+    L[j, j] = std::sqrt(d);
+
+    for (Index i = j + 1; i < n; i++) {
+      Numeric x = A[i, j];
+      for (Index k = 0; k < j; k++) x -= L[i, k] * L[j, k];
+      L[i, j] = x / L[j, j];
+    }
+  }
+  return L;
+}
+
+enum class triangular { mult, mult_transpose, solve, solve_transpose };
+
+//! v = op(L) v for a lower triangular L
+void triangular_fibre(VectorView v, ConstMatrixView L, const triangular op) {
+  const Index n = v.size();
+  switch (op) {
+    case triangular::mult:
+      for (Index i = n - 1; i >= 0; i--) {
+        Numeric x = 0.0;
+        for (Index j = 0; j <= i; j++) x += L[i, j] * v[j];
+        v[i] = x;
+      }
+      break;
+    case triangular::mult_transpose:
+      for (Index i = 0; i < n; i++) {
+        Numeric x = 0.0;
+        for (Index j = i; j < n; j++) x += L[j, i] * v[j];
+        v[i] = x;
+      }
+      break;
+    case triangular::solve:
+      for (Index i = 0; i < n; i++) {
+        Numeric x = v[i];
+        for (Index j = 0; j < i; j++) x -= L[i, j] * v[j];
+        v[i] = x / L[i, i];
+      }
+      break;
+    case triangular::solve_transpose:
+      for (Index i = n - 1; i >= 0; i--) {
+        Numeric x = v[i];
+        for (Index j = i + 1; j < n; j++) x -= L[j, i] * v[j];
+        v[i] = x / L[i, i];
+      }
+      break;
+  }
+}
+
+//! x = (op(L_0) x op(L_1) x ...) x, with the last dimension varying fastest
+void kronecker_apply(VectorView x, const ArrayOfMatrix &Ls, const triangular op) {
+  Index outer = 1;
+  Index inner = x.size();
+  for (const Matrix &L : Ls) {
+    const Index n = L.nrows();
+    inner        /= n;
+
+    Vector fibre(n);
+    for (Index o = 0; o < outer; o++) {
+      for (Index r = 0; r < inner; r++) {
+        for (Index i = 0; i < n; i++) fibre[i] = x[(o * n + i) * inner + r];
+        triangular_fibre(fibre, L, op);
+        for (Index i = 0; i < n; i++) x[(o * n + i) * inner + r] = fibre[i];
+      }
+    }
+
+    outer *= n;
+  }
+}
+}  // namespace
+
+KroneckerCovariance KroneckerCovariance::from_correlations(Vector std_dev, const ArrayOfMatrix &correlations) {
+  Index n = 1;
+  for (auto &R : correlations) n *= R.nrows();
+  ARTS_USER_ERROR_IF(correlations.empty() or n != std_dev.size(),
+                     "The correlations span {} elements but there are {} standard deviations",
+                     correlations.empty() ? 0 : n,
+                     std_dev.size())
+  ARTS_USER_ERROR_IF(std::ranges::any_of(std_dev, [](Numeric x) { return x <= 0.0; }),
+                     "The standard deviations must be positive")
+
+  KroneckerCovariance out{.std_dev = std::move(std_dev), .cholesky = {}, .inverse = false};
+  out.cholesky.reserve(correlations.size());
+  for (auto &R : correlations) out.cholesky.push_back(cholesky(R));
+  return out;
+}
+
+KroneckerCovariance KroneckerCovariance::exponential(Vector               std_dev,
+                                                     const ArrayOfVector &grids,
+                                                     const Vector        &lengths) {
+  ARTS_USER_ERROR_IF(grids.size() != lengths.size(),
+                     "Need one correlation length per grid, got {} grids and {} lengths",
+                     grids.size(),
+                     lengths.size())
+
+  ArrayOfMatrix correlations;
+  correlations.reserve(grids.size());
+  for (Size k = 0; k < grids.size(); k++) {
+    const Vector &z = grids[k];
+    const Numeric l = lengths[k];
+    ARTS_USER_ERROR_IF(l < 0.0, "Correlation lengths must be non-negative, got {}", l)
+
+    Matrix R(z.size(), z.size(), 0.0);
+    for (Index i = 0; i < z.size(); i++) {
+      for (Index j = 0; j < z.size(); j++) {
+        R[i, j] = i == j ? 1.0 : (l == 0.0 ? 0.0 : std::exp(-std::abs(z[i] - z[j]) / l));
+      }
+    }
+    correlations.push_back(std::move(R));
+  }
+
+  return from_correlations(std::move(std_dev), correlations);
+}
+
+Index KroneckerCovariance::size() const { return std_dev.size(); }
+
+KroneckerCovariance KroneckerCovariance::inverted() const {
+  KroneckerCovariance out = *this;
+  out.inverse             = not inverse;
+  return out;
+}
+
+Vector KroneckerCovariance::diagonal() const {
+  // The diagonal of each correlation, or of its inverse
+  ArrayOfVector diags;
+  diags.reserve(cholesky.size());
+  for (const Matrix &L : cholesky) {
+    const Index n = L.nrows();
+    Vector      d(n, 0.0);
+    if (inverse) {
+      Vector e(n);
+      for (Index i = 0; i < n; i++) {
+        e    = 0.0;
+        e[i] = 1.0;
+        triangular_fibre(e, L, triangular::solve);
+        for (Index j = 0; j < n; j++) d[i] += e[j] * e[j];
+      }
+    } else {
+      for (Index i = 0; i < n; i++) {
+        for (Index j = 0; j <= i; j++) d[i] += L[i, j] * L[i, j];
+      }
+    }
+    diags.push_back(std::move(d));
+  }
+
+  Vector out(size());
+  for (Index i = 0; i < size(); i++) {
+    Numeric x   = inverse ? 1.0 / (std_dev[i] * std_dev[i]) : std_dev[i] * std_dev[i];
+    Index   rem = i;
+    for (Size k = diags.size(); k-- > 0;) {
+      const Index n  = diags[k].size();
+      x             *= diags[k][rem % n];
+      rem           /= n;
+    }
+    out[i] = x;
+  }
+  return out;
+}
+
+Matrix KroneckerCovariance::dense() const {
+  const Index n = size();
+  Matrix      out(n, n);
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Index j = 0; j < n; j++) {
+    Vector e(n, 0.0);
+    e[j] = 1.0;
+    mult(out[joker, j], e);
+  }
+  return out;
+}
+
+void KroneckerCovariance::mult(StridedVectorView y, StridedConstVectorView x) const {
+  ARTS_USER_ERROR_IF(x.size() != size() or y.size() != size(),
+                     "Bad sizes. x.size(): {}, y.size(): {}, matrix size: {}",
+                     x.size(),
+                     y.size(),
+                     size())
+
+  Vector t(x);
+  if (inverse) {
+    for (Index i = 0; i < size(); i++) t[i] /= std_dev[i];
+    kronecker_apply(t, cholesky, triangular::solve);
+    kronecker_apply(t, cholesky, triangular::solve_transpose);
+    for (Index i = 0; i < size(); i++) t[i] /= std_dev[i];
+  } else {
+    for (Index i = 0; i < size(); i++) t[i] *= std_dev[i];
+    kronecker_apply(t, cholesky, triangular::mult_transpose);
+    kronecker_apply(t, cholesky, triangular::mult);
+    for (Index i = 0; i < size(); i++) t[i] *= std_dev[i];
+  }
+  y = t;
+}
+
+//------------------------------------------------------------------------------
+// Blocks
+//------------------------------------------------------------------------------
 Block::Block(Range row_range, Range column_range, IndexPair indices, BlockMatrix matrix)
     : row_range_(row_range), column_range_(column_range), indices_(std::move(indices)), matrix_(std::move(matrix)) {
   // Nothing to do here.
@@ -48,6 +262,11 @@ BlockMatrix::BlockMatrix(const Matrix &dense) : data(std::make_shared<Matrix>(de
 
 BlockMatrix::BlockMatrix(const Sparse &sparse) : data(std::make_shared<Sparse>(sparse)) {}
 
+BlockMatrix::BlockMatrix(std::shared_ptr<KroneckerCovariance> kronecker) : data(std::move(kronecker)) {}
+
+BlockMatrix::BlockMatrix(const KroneckerCovariance &kronecker)
+    : data(std::make_shared<KroneckerCovariance>(kronecker)) {}
+
 BlockMatrix &BlockMatrix::operator=(std::shared_ptr<Matrix> dense) {
   data = std::move(dense);
   return *this;
@@ -58,6 +277,16 @@ BlockMatrix &BlockMatrix::operator=(std::shared_ptr<Sparse> sparse) {
   return *this;
 }
 
+BlockMatrix &BlockMatrix::operator=(std::shared_ptr<KroneckerCovariance> kronecker) {
+  data = std::move(kronecker);
+  return *this;
+}
+
+BlockMatrix &BlockMatrix::operator=(const KroneckerCovariance &kronecker) {
+  data = std::make_shared<KroneckerCovariance>(kronecker);
+  return *this;
+}
+
 BlockMatrix &BlockMatrix::operator=(const Matrix &dense) {
   data = std::make_shared<Matrix>(dense);
   return *this;
@@ -69,13 +298,16 @@ BlockMatrix &BlockMatrix::operator=(const Sparse &sparse) {
 }
 
 bool BlockMatrix::not_null() const {
-  if (is_dense()) return std::get<std::shared_ptr<Matrix>>(data) != nullptr;
-  return std::get<std::shared_ptr<Sparse>>(data) != nullptr;
+  return std::visit([](auto &ptr) { return ptr != nullptr; }, data);
 }
 
 bool BlockMatrix::is_dense() const { return std::holds_alternative<std::shared_ptr<Matrix>>(data); }
 
-bool BlockMatrix::is_sparse() const { return not is_dense(); }
+bool BlockMatrix::is_sparse() const { return std::holds_alternative<std::shared_ptr<Sparse>>(data); }
+
+bool BlockMatrix::is_kronecker() const {
+  return std::holds_alternative<std::shared_ptr<KroneckerCovariance>>(data);
+}
 
 Matrix &BlockMatrix::dense() {
   assert(is_dense());
@@ -97,28 +329,44 @@ const Sparse &BlockMatrix::sparse() const {
   return *std::get<std::shared_ptr<Sparse>>(data);
 }
 
+KroneckerCovariance &BlockMatrix::kronecker() {
+  assert(is_kronecker());
+  return *std::get<std::shared_ptr<KroneckerCovariance>>(data);
+}
+
+const KroneckerCovariance &BlockMatrix::kronecker() const {
+  assert(is_kronecker());
+  return *std::get<std::shared_ptr<KroneckerCovariance>>(data);
+}
+
+Matrix BlockMatrix::as_dense() const {
+  if (is_dense()) return dense();
+  if (is_kronecker()) return kronecker().dense();
+  return static_cast<Matrix>(sparse());
+}
+
 Vector BlockMatrix::diagonal() const {
   if (is_dense()) return Vector{matpack::diagonal(*std::get<std::shared_ptr<Matrix>>(data))};
+  if (is_kronecker()) return kronecker().diagonal();
   return std::get<std::shared_ptr<Sparse>>(data)->diagonal();
 }
 
 Index BlockMatrix::ncols() const {
   if (is_dense()) return dense().ncols();
+  if (is_kronecker()) return kronecker().size();
   return sparse().ncols();
 }
 
 Index BlockMatrix::nrows() const {
   if (is_dense()) return dense().nrows();
+  if (is_kronecker()) return kronecker().size();
   return sparse().nrows();
 }
 
 void Block::set_matrix(std::shared_ptr<Sparse> sparse) { matrix_ = std::move(sparse); }
 void Block::set_matrix(std::shared_ptr<Matrix> dense) { matrix_ = std::move(dense); }
 
-std::array<Index, 2> BlockMatrix::shape() const {
-  if (is_dense()) { return dense().shape(); }
-  return {sparse().nrows(), sparse().ncols()};
-}
+std::array<Index, 2> BlockMatrix::shape() const { return {nrows(), ncols()}; }
 
 //------------------------------------------------------------------------------
 // Correlations
@@ -134,6 +382,14 @@ void mult(StridedMatrixView C, StridedConstMatrixView A, const Block &B) {
   Index i, j;
   std::tie(i, j) = B.get_indices();
 
+  if (B.is_kronecker()) {
+    // Symmetric, so each row of C is the matrix times the row of A
+    ARTS_USER_ERROR_IF(i != j, "Kronecker covariance blocks must be diagonal blocks")
+#pragma omp parallel for if (not arts_omp_in_parallel())
+    for (Index r = 0; r < CView.nrows(); r++) B.get_kronecker().mult(CView[r], AView[r]);
+    return;
+  }
+
   if (B.is_dense()) {
     mult(CView, AView, B.get_dense());
   } else {
@@ -161,6 +417,14 @@ void mult(StridedMatrixView C, const Block &A, StridedConstMatrixView B) {
   StridedConstMatrixView BView(B[A.get_column_range(), joker]);
   StridedConstMatrixView BTView(B[A.get_row_range(), joker]);
 
+  if (A.is_kronecker()) {
+    ARTS_USER_ERROR_IF(A.get_indices().first != A.get_indices().second,
+                       "Kronecker covariance blocks must be diagonal blocks")
+#pragma omp parallel for if (not arts_omp_in_parallel())
+    for (Index c = 0; c < CView.ncols(); c++) A.get_kronecker().mult(CView[joker, c], BView[joker, c]);
+    return;
+  }
+
   if (A.is_dense()) {
     mult(CView, A.get_dense(), BView);
   } else {
@@ -187,6 +451,13 @@ void mult(StridedVectorView w, const Block &A, StridedConstVectorView v) {
   StridedVectorView      wview(w[A.get_row_range()]), wtview(w[A.get_column_range()]);
   StridedConstVectorView vview(v[A.get_column_range()]), vtview(v[A.get_row_range()]);
 
+  if (A.is_kronecker()) {
+    ARTS_USER_ERROR_IF(A.get_indices().first != A.get_indices().second,
+                       "Kronecker covariance blocks must be diagonal blocks")
+    A.get_kronecker().mult(wview, vview);
+    return;
+  }
+
   if (A.is_dense()) {
     mult(wview, A.get_dense(), vview);
   } else {
@@ -211,7 +482,7 @@ StridedMatrixView operator+=(StridedMatrixView A, const Block &B) {
   if (B.is_dense()) {
     Aview += B.get_dense();
   } else {
-    Aview += static_cast<const Matrix>(B.get_sparse());
+    Aview += B.as_dense();
   }
 
   Index i, j;
@@ -221,7 +492,7 @@ StridedMatrixView operator+=(StridedMatrixView A, const Block &B) {
     if (B.is_dense()) {
       ATview += transpose(B.get_dense());
     } else {
-      ATview += transpose(static_cast<const Matrix>(B.get_sparse()));
+      ATview += transpose(B.as_dense());
     }
   }
   return A;
@@ -240,7 +511,7 @@ CovarianceMatrix::operator Matrix() const {
     if (c.is_dense()) {
       Aview = c.get_dense();
     } else {
-      Aview = static_cast<const Matrix>(c.get_sparse());
+      Aview = c.as_dense();
     }
 
     Index ci, cj;
@@ -250,7 +521,7 @@ CovarianceMatrix::operator Matrix() const {
       if (c.is_dense()) {
         ATview = transpose(c.get_dense());
       } else {
-        ATview = transpose(static_cast<const Matrix>(c.get_sparse()));
+        ATview = transpose(c.as_dense());
       }
     }
   }
@@ -267,7 +538,7 @@ Matrix CovarianceMatrix::get_inverse() const {
     if (c.is_dense()) {
       Aview = c.get_dense();
     } else {
-      Aview = static_cast<const Matrix>(c.get_sparse());
+      Aview = c.as_dense();
     }
 
     Index ci, cj;
@@ -277,7 +548,7 @@ Matrix CovarianceMatrix::get_inverse() const {
       if (c.is_dense()) {
         ATview = transpose(c.get_dense());
       } else {
-        ATview = transpose(static_cast<const Matrix>(c.get_sparse()));
+        ATview = transpose(c.as_dense());
       }
     }
   }
@@ -466,6 +737,34 @@ void CovarianceMatrix::invert_correlation_block(std::vector<Block>         &inve
   auto block_has_inverse = [this](const Block *a) { return has_inverse(a->get_indices()); };
   if (std::all_of(blocks.begin(), blocks.end(), block_has_inverse)) return;
 
+  // Uncorrelated blocks with a known structure have inverses of the same structure
+  if (blocks.size() == 1) {
+    const Block &b = *blocks.front();
+
+    if (b.is_kronecker()) {
+      inverses.emplace_back(
+          b.get_row_range(), b.get_column_range(), b.get_indices(), b.get_kronecker().inverted());
+      return;
+    }
+
+    if (b.is_sparse()) {
+      const Sparse &sp   = b.get_sparse();
+      const Vector  diag = sp.diagonal();
+      if (sp.nnz() == diag.size() and std::ranges::none_of(diag, [](Numeric x) { return x == 0.0; })) {
+        Vector inv_diag(diag.size());
+        for (Index i = 0; i < diag.size(); i++) inv_diag[i] = 1.0 / diag[i];
+        inverses.emplace_back(b.get_row_range(),
+                              b.get_column_range(),
+                              b.get_indices(),
+                              std::make_shared<Sparse>(Sparse::diagonal(inv_diag)));
+        return;
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(std::ranges::any_of(blocks, [](const Block *b) { return b->is_kronecker(); }),
+                     "Kronecker covariance blocks cannot be correlated with other blocks")
+
   // Otherwise go on to precompute the inverse of a block consisting
   // of correlations between multiple retrieval quantities.
 
@@ -511,7 +810,7 @@ void CovarianceMatrix::invert_correlation_block(std::vector<Block>         &inve
     if (blocks[i]->is_dense()) {
       A_view = blocks[i]->get_dense();
     } else {
-      A_view = static_cast<const Matrix>(blocks[i]->get_sparse());
+      A_view = blocks[i]->as_dense();
     }
   }
 
@@ -31,9 +31,59 @@ class CovarianceMatrix;
 
 using IndexPair = std::pair<Index, Index>;
 
+//------------------------------------------------------------------------------
+// Kronecker covariance
+//------------------------------------------------------------------------------
+/*! A covariance matrix given as a Kronecker product of correlations.
+ *
+ * The matrix is diag(std_dev) (R_0 x R_1 x ... ) diag(std_dev), where each
+ * correlation matrix R_k describes one dimension of the retrieval grid, with
+ * the last dimension varying fastest.  Only the lower Cholesky factors
+ * R_k = L_k L_k^T are stored, so neither the matrix nor its inverse is
+ * ever formed.  Products with the inverse are triangular solves along each
+ * dimension.
+ *
+ * If inverse is true, the object represents the inverse of the covariance
+ * matrix instead.
+ */
+struct KroneckerCovariance {
+  Vector        std_dev{};
+  ArrayOfMatrix cholesky{};
+  bool          inverse{false};
+
+  /*! Factorize the correlation matrices.
+   *
+   * @param std_dev The standard deviations of all elements
+   * @param correlations The symmetric positive definite correlation matrix of each dimension
+   */
+  static KroneckerCovariance from_correlations(Vector std_dev, const ArrayOfMatrix &correlations);
+
+  /*! Exponential correlations, exp(-|z_i - z_j| / l), along each dimension.
+   *
+   * @param std_dev The standard deviations of all elements
+   * @param grids The grid of each dimension
+   * @param lengths The correlation length of each dimension, 0 for no correlation
+   */
+  static KroneckerCovariance exponential(Vector std_dev, const ArrayOfVector &grids, const Vector &lengths);
+
+  [[nodiscard]] Index size() const;
+
+  /*! The same matrix with the inverse flag flipped. */
+  [[nodiscard]] KroneckerCovariance inverted() const;
+
+  [[nodiscard]] Vector diagonal() const;
+
+  /*! The full matrix, only meant for small sizes. */
+  [[nodiscard]] Matrix dense() const;
+
+  /*! y = C x, or y = C^-1 x if inverse */
+  void mult(StridedVectorView y, StridedConstVectorView x) const;
+};
+
 class BlockMatrix {
  public:
-  using variant_t = std::variant<std::shared_ptr<Matrix>, std::shared_ptr<Sparse>>;
+  using variant_t =
+      std::variant<std::shared_ptr<Matrix>, std::shared_ptr<Sparse>, std::shared_ptr<KroneckerCovariance>>;
 
   variant_t data;
 
@@ -47,21 +97,29 @@ class BlockMatrix {
   BlockMatrix(std::shared_ptr<Sparse> sparse);
   BlockMatrix(const Matrix &dense);
   BlockMatrix(const Sparse &sparse);
+  BlockMatrix(std::shared_ptr<KroneckerCovariance> kronecker);
+  BlockMatrix(const KroneckerCovariance &kronecker);
 
   BlockMatrix &operator=(std::shared_ptr<Matrix> dense);
 
   BlockMatrix &operator=(std::shared_ptr<Sparse> sparse);
 
+  BlockMatrix &operator=(std::shared_ptr<KroneckerCovariance> kronecker);
+
   BlockMatrix &operator=(const Matrix &dense);
 
   BlockMatrix &operator=(const Sparse &sparse);
 
+  BlockMatrix &operator=(const KroneckerCovariance &kronecker);
+
   [[nodiscard]] bool not_null() const;
 
   [[nodiscard]] bool is_dense() const;
 
   [[nodiscard]] bool is_sparse() const;
 
+  [[nodiscard]] bool is_kronecker() const;
+
   [[nodiscard]] Matrix &dense();
 
   [[nodiscard]] const Matrix &dense() const;
@@ -70,6 +128,13 @@ class BlockMatrix {
 
   [[nodiscard]] const Sparse &sparse() const;
 
+  [[nodiscard]] KroneckerCovariance &kronecker();
+
+  [[nodiscard]] const KroneckerCovariance &kronecker() const;
+
+  /*! The matrix as a dense matrix, whatever its storage */
+  [[nodiscard]] Matrix as_dense() const;
+
   [[nodiscard]] Vector diagonal() const;
 
   [[nodiscard]] Index ncols() const;
@@ -144,6 +209,7 @@ class Block {
   [[nodiscard]] bool not_null() const { return matrix_.not_null(); }
   [[nodiscard]] bool is_dense() const { return matrix_.is_dense(); }
   [[nodiscard]] bool is_sparse() const { return matrix_.is_sparse(); }
+  [[nodiscard]] bool is_kronecker() const { return matrix_.is_kronecker(); }
 
   [[nodiscard]] const Matrix &get_dense() const { return matrix_.dense(); }
   Matrix                     &get_dense() { return matrix_.dense(); }
@@ -151,6 +217,12 @@ class Block {
   [[nodiscard]] const Sparse &get_sparse() const { return matrix_.sparse(); }
   Sparse                     &get_sparse() { return matrix_.sparse(); }
 
+  [[nodiscard]] const KroneckerCovariance &get_kronecker() const { return matrix_.kronecker(); }
+  KroneckerCovariance                     &get_kronecker() { return matrix_.kronecker(); }
+
+  /*! The block as a dense matrix, whatever its storage */
+  [[nodiscard]] Matrix as_dense() const { return matrix_.as_dense(); }
+
   Range     row_range_, column_range_;
   IndexPair indices_;
 
@@ -380,7 +452,12 @@ template <> struct std::formatter<BlockMatrix> {
   }
 
   template <class FmtContext> FmtContext::iterator format(const BlockMatrix &v, FmtContext &ctx) const {
-    if (v.not_null()) { return v.is_dense() ? tags.format(ctx, v.dense()) : tags.format(ctx, v.sparse()); }
+    if (v.not_null()) {
+      if (v.is_kronecker()) {
+        return tags.format(ctx, v.kronecker().std_dev, tags.sep(), v.kronecker().cholesky);
+      }
+      return v.is_dense() ? tags.format(ctx, v.dense()) : tags.format(ctx, v.sparse());
+    }
 
     tags.add_if_bracket(ctx, "[]"sv);
     return ctx.out();
@@ -408,6 +485,14 @@ template <> struct std::formatter<CovarianceMatrix> {
   }
 };
 
+template <> struct xml_io_stream_name<KroneckerCovariance> {
+  static constexpr std::string_view name = "KroneckerCovariance"sv;
+};
+
+template <> struct xml_io_stream_aggregate<KroneckerCovariance> {
+  static constexpr bool value = true;
+};
+
 template <> struct xml_io_stream<BlockMatrix> {
   static constexpr std::string_view type_name = "BlockMatrix"sv;
 
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "lbl_data.h"
+#include "lbl_faddeeva.h"
 #include "lbl_fwd.h"
 #include "lbl_hitran.h"
+#include "lbl_indexed.h"
 #include "lbl_jpl.h"
 #include "lbl_lineshape.h"
+#include "lbl_lineshape_compiled.h"
 #include "lbl_lineshape_model.h"
 #include "lbl_lineshape_voigt_ecs.h"
 #include "lbl_lineshape_voigt_lte.h"
@@ -16,8 +16,10 @@
 #include <quantum.h>
 #include <xml.h>
 
+#include <atomic>
 #include <format>
 #include <limits>
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
@@ -176,6 +178,33 @@ struct LineByLineCutoff {
   constexpr bool operator!=(const LineByLineCutoff& other) const { return not(*this == other); }
 };
 
+namespace line_shape {
+struct compiled_band;
+}  // namespace line_shape
+
+/** Data derived from the lines of a band, kept with the band
+
+  The lines are public, so derived data cannot know when they change.  It
+  is instead checked against the lines on use and recomputed if it no
+  longer matches them.  Copies of a band start with the data of the
+  original.
+*/
+class band_cache {
+  std::atomic<std::shared_ptr<const line_shape::compiled_band>> ls{};
+
+ public:
+  band_cache() = default;
+  band_cache(const band_cache& x) : ls(x.line_shape()) {}
+  band_cache& operator=(const band_cache& x) {
+    ls = x.line_shape();
+    return *this;
+  }
+
+  //! The compiled line shape models, see line_shape::compiled
+  [[nodiscard]] std::shared_ptr<const line_shape::compiled_band> line_shape() const { return ls.load(); }
+  void line_shape(std::shared_ptr<const line_shape::compiled_band> x) { ls = std::move(x); }
+};
+
 struct band_data {
   std::vector<line> lines{};
 
@@ -183,6 +212,9 @@ struct band_data {
 
   LineByLineCutoff cutoff{};
 
+  //! Derived data of the lines
+  mutable band_cache cache{};
+
   template <typename T> [[nodiscard]] auto& operator[](this T&& self, const std::integral auto& i) {
     return std::forward<T>(self).lines[i];
   }
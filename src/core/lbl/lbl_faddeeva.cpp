@@ -0,0 +1,172 @@
+#include "lbl_faddeeva.h"
+
+#include <arts_constants.h>
+
+#include <Faddeeva/Faddeeva.hh>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) and defined(__ELF__) and (defined(__GNUC__) or defined(__clang__))
+#define ARTS_FADDEEVA_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#define ARTS_FADDEEVA_HAS_CLONES 1
+#else
+#define ARTS_FADDEEVA_CLONES
+#define ARTS_FADDEEVA_HAS_CLONES 0
+#endif
+
+namespace lbl::faddeeva {
+namespace {
+//! Number of arguments that share a continued-fraction loop (one AVX-512 register of doubles)
+constexpr Size block_size = 8;
+
+//! Number of arguments sorted into fast and slow paths at a time
+constexpr Size chunk_size = 256;
+
+/*! True if the MIT Faddeeva package would use its continued-fraction
+ * expansion for the argument, the argument is in the upper half-plane,
+ * and the squared modulus of the argument cannot overflow.
+ *
+ * The region test is copied from Faddeeva::w, so that the results here
+ * use the same expansion with the same number of terms.
+ */
+bool use_continued_fraction(const Numeric x_, const Numeric y) {
+  const Numeric x = std::abs(x_);
+  return x != 0.0 and y > 0.0 and x + y < 1e150 and
+         (y > 7 or (x > 6 and (y > 0.1 or (x > 8 and y > 1e-10) or x > 28)));
+}
+
+//! The number of continued-fraction terms as estimated by Faddeeva::w (x is |Re z|)
+Numeric continued_fraction_terms(const Numeric x, const Numeric y) {
+  if (x + y > 1e7) return 1.0;
+  if (x + y > 4000) return 2.0;
+  return std::floor(3.9 + 11.398 / (0.08254 * x + 0.1421 * y + 0.2023));
+}
+
+/*! Computes w(x + iy) for arguments that all pass use_continued_fraction
+ *
+ * The arguments are processed in blocks of block_size.  Each block runs
+ * as many iterations as its most demanding argument, but each argument
+ * is only updated for as many iterations as Faddeeva::w would use for it.
+ * The loops have no data-dependent branches so that they vectorize for
+ * whichever instruction set the clone is compiled for.
+ */
+ARTS_FADDEEVA_CLONES
+void continued_fraction(Numeric* __restrict__ wr,
+                        Numeric* __restrict__ wi,
+                        const Numeric* __restrict__ x,
+                        const Numeric* __restrict__ y,
+                        const Size n) {
+  constexpr Numeric ispi = Constant::inv_sqrt_pi;
+
+  for (Size i0 = 0; i0 < n; i0 += block_size) {
+    const Size m = std::min(block_size, n - i0);
+
+    // Padding is an argument that uses no iterations
+    std::array<Numeric, block_size> xs, ya, nu, ar, ai;
+    xs.fill(1e8);
+    ya.fill(1.0);
+    std::copy_n(x + i0, m, xs.begin());
+    std::copy_n(y + i0, m, ya.begin());
+
+    Numeric nu_max = 0.0;
+#pragma omp simd reduction(max : nu_max)
+    for (Size i = 0; i < block_size; i++) {
+      nu[i]  = 0.5 * (continued_fraction_terms(std::abs(xs[i]), ya[i]) - 1.0);
+      nu_max = std::max(nu_max, nu[i]);
+      ar[i]  = xs[i];
+      ai[i]  = ya[i];
+    }
+
+    // w <- z - nu / w
+    for (Numeric c = nu_max; c > 0.4; c -= 0.5) {
+#pragma omp simd
+      for (Size i = 0; i < block_size; i++) {
+        const Numeric d = c / (ar[i] * ar[i] + ai[i] * ai[i]);
+        const Numeric r = xs[i] - ar[i] * d;
+        const Numeric j = ya[i] + ai[i] * d;
+        ar[i]           = c <= nu[i] ? r : ar[i];
+        ai[i]           = c <= nu[i] ? j : ai[i];
+      }
+    }
+
+    // w(z) = i / sqrt(pi) / w
+#pragma omp simd
+    for (Size i = 0; i < block_size; i++) {
+      const Numeric d = ispi / (ar[i] * ar[i] + ai[i] * ai[i]);
+      xs[i]           = d * ai[i];
+      ya[i]           = d * ar[i];
+    }
+
+    std::copy_n(xs.begin(), m, wr + i0);
+    std::copy_n(ya.begin(), m, wi + i0);
+  }
+}
+
+/*! Sorts the arguments into the vectorized and the scalar path
+ *
+ * @param F The output
+ * @param z A callable that returns the argument for index i
+ */
+void batched(ComplexVectorView F, const auto& z) {
+  const Size n = F.size();
+
+  std::array<Numeric, chunk_size> x, y, wr, wi;
+  std::array<Size, chunk_size>    pos;
+
+  for (Size i0 = 0; i0 < n; i0 += chunk_size) {
+    const Size m = std::min(chunk_size, n - i0);
+
+    Size k = 0;
+    for (Size i = i0; i < i0 + m; i++) {
+      const Complex zi = z(i);
+      if (use_continued_fraction(zi.real(), zi.imag())) {
+        x[k]     = zi.real();
+        y[k]     = zi.imag();
+        pos[k++] = i;
+      } else {
+        F[i] = Faddeeva::w(zi);
+      }
+    }
+
+    continued_fraction(wr.data(), wi.data(), x.data(), y.data(), k);
+
+    for (Size j = 0; j < k; j++) F[pos[j]] = Complex{wr[j], wi[j]};
+  }
+}
+}  // namespace
+
+std::string_view simd_name() {
+#if ARTS_FADDEEVA_HAS_CLONES
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return "avx512f";
+  if (__builtin_cpu_supports("avx2")) return "avx2";
+#endif
+  return "scalar";
+}
+
+void w(ComplexVectorView F, const ConstComplexVectorView& z) {
+  assert(F.size() == z.size());
+
+  batched(F, [&z](Size i) { return z[i]; });
+}
+
+void w(ComplexVectorView      F,
+       const ConstVectorView& f,
+       const Numeric          f0,
+       const Numeric          inv_gd,
+       const Numeric          z_imag) {
+  assert(F.size() == f.size());
+
+  batched(F, [&f, f0, inv_gd, z_imag](Size i) { return Complex{inv_gd * (f[i] - f0), z_imag}; });
+}
+
+Range frequency_window(const ConstVectorView& f, const Numeric f0, const Numeric cutoff) {
+  if (not(cutoff < std::numeric_limits<Numeric>::infinity())) return Range{0, f.size()};
+
+  const auto low = stdr::lower_bound(f, f0 - cutoff);
+  const auto upp = stdr::upper_bound(f, f0 + cutoff);
+  return Range{std::distance(f.begin(), low), std::distance(low, upp)};
+}
+}  // namespace lbl::faddeeva
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <matpack.h>
+
+#include <string_view>
+
+namespace lbl::faddeeva {
+/** The instruction set the batched kernels dispatch to on this machine
+ *
+ * @return One of "avx512f", "avx2", or "scalar"
+ */
+std::string_view simd_name();
+
+/** Computes the Faddeeva function for many arguments at once
+ *
+ * Arguments in the upper half-plane that are far enough from the
+ * real axis for the continued-fraction expansion of the MIT Faddeeva
+ * package are evaluated together in blocks that vectorize.  The
+ * instruction set (AVX-512, AVX2 or scalar) is chosen at runtime.
+ * All other arguments fall back to Faddeeva::w, so the result
+ * matches the scalar function everywhere.
+ *
+ * @param[out] F The Faddeeva function, same size as z
+ * @param[in] z The complex arguments
+ */
+void w(ComplexVectorView F, const ConstComplexVectorView& z);
+
+/** Computes the Faddeeva function of a single line for many frequencies
+ *
+ * As w(F, z) but for z = Complex{inv_gd * (f - f0), z_imag}, which is
+ * how the Voigt line shapes set up their arguments.
+ *
+ * @param[out] F The Faddeeva function, same size as f
+ * @param[in] f The frequency grid
+ * @param[in] f0 The line center
+ * @param[in] inv_gd The inverse Doppler width
+ * @param[in] z_imag The imaginary part of the argument
+ */
+void w(ComplexVectorView      F,
+       const ConstVectorView& f,
+       const Numeric          f0,
+       const Numeric          inv_gd,
+       const Numeric          z_imag);
+
+/** Finds the part of a sorted frequency grid that is within the cutoff of a line
+ *
+ * This is the same selection that the per-frequency line shape
+ * sums do on the lines, but turned around to work per line.
+ *
+ * @param f The sorted frequency grid
+ * @param f0 The line center
+ * @param cutoff The cutoff frequency (may be infinite)
+ * @return The range of f within [f0 - cutoff, f0 + cutoff]
+ */
+Range frequency_window(const ConstVectorView& f, const Numeric f0, const Numeric cutoff);
+}  // namespace lbl::faddeeva
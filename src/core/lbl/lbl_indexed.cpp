@@ -0,0 +1,400 @@
+#include "lbl_indexed.h"
+
+#include <debug.h>
+#include <isotopologues.h>
+#include <quantum.h>
+#include <rational.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lbl {
+namespace {
+constexpr std::array<char, 8> file_magic{'A', 'R', 'T', 'S', 'L', 'B', 'L', '\0'};
+constexpr std::uint64_t       file_version    = 2;
+constexpr std::uint64_t       file_byte_order = 0x0102030405060708;
+
+struct file_header {
+  std::array<char, 8>  magic;
+  std::uint64_t        version;
+  std::uint64_t        byte_order;
+  std::uint64_t        nbands;
+  std::uint64_t        enums;
+  std::array<char, 32> isotopologue;
+};
+static_assert(sizeof(file_header) == 72);
+
+struct file_entry {
+  //! The lowest and highest line frequency, [inf, -inf] for bands without lines
+  Numeric fmin;
+  Numeric fmax;
+
+  //! The position and size of the band record
+  std::uint64_t offset;
+  std::uint64_t bytes;
+};
+static_assert(sizeof(file_entry) == 32);
+
+//! Adds the names and values of all options of an enumeration to an FNV-1a hash
+template <typename T> void hash_enum(std::uint64_t& h, const auto& types) {
+  const auto add = [&h](const auto& bytes) {
+    for (auto c : bytes) {
+      h ^= static_cast<std::uint8_t>(c);
+      h *= 0x100000001b3;
+    }
+  };
+
+  for (const T x : types) {
+    add(toString<0>(x));
+    add(std::bit_cast<std::array<char, 4>>(static_cast<std::int32_t>(std::to_underlying(x))));
+  }
+}
+
+/*! A hash of the enumerations that are stored by value
+
+  Files written by an ARTS with other enumerations would decode to other
+  species, variables, etc., so they are rejected instead.
+*/
+std::uint64_t enums_hash() {
+  static const std::uint64_t h = [] {
+    std::uint64_t out = 0xcbf29ce484222325;
+    hash_enum<SpeciesEnum>(out, enumtyps::SpeciesEnumTypes);
+    hash_enum<QuantumNumberType>(out, enumtyps::QuantumNumberTypeTypes);
+    hash_enum<LineShapeModelVariable>(out, enumtyps::LineShapeModelVariableTypes);
+    hash_enum<LineShapeModelType>(out, enumtyps::LineShapeModelTypeTypes);
+    hash_enum<LineByLineLineshape>(out, enumtyps::LineByLineLineshapeTypes);
+    hash_enum<LineByLineCutoffType>(out, enumtyps::LineByLineCutoffTypeTypes);
+    return out;
+  }();
+  return h;
+}
+
+//! Appends the binary record of a band
+struct encoder {
+  std::string buf{};
+
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  void put(const T x) {
+    buf.append(reinterpret_cast<const char*>(&x), sizeof(T));
+  }
+
+  template <typename T>
+    requires std::is_enum_v<T>
+  void put(const T x) {
+    put(static_cast<std::int32_t>(std::to_underlying(x)));
+  }
+
+  void put(const std::string_view s) {
+    put(static_cast<std::uint64_t>(s.size()));
+    buf.append(s);
+  }
+
+  void put(const Quantum::Value& v) {
+    if (const auto* r = std::get_if<Rational>(&v.value)) {
+      put(std::uint8_t{0});
+      put(r->numer);
+      put(r->denom);
+    } else {
+      put(std::uint8_t{1});
+      put(std::string_view{std::get<String>(v.value)});
+    }
+  }
+
+  void put(const QuantumState& qn) {
+    put(static_cast<std::uint64_t>(qn.size()));
+    for (auto& [type, ul] : qn) {
+      put(type);
+      put(ul.upper);
+      put(ul.lower);
+    }
+  }
+
+  void put(const line_shape::model& ls) {
+    put(ls.T0);
+    put(static_cast<std::uint64_t>(ls.single_models.size()));
+    for (auto& [spec, model] : ls.single_models) {
+      put(spec);
+      put(static_cast<std::uint64_t>(model.data.size()));
+      for (auto& [var, data] : model.data) {
+        put(var);
+        put(data.Type());
+        put(static_cast<std::uint64_t>(data.X().size()));
+        for (Numeric x : data.X()) put(x);
+      }
+    }
+  }
+
+  void put(const line& l) {
+    put(l.f0);
+    put(l.a);
+    put(l.e0);
+    put(l.gu);
+    put(l.gl);
+    put(static_cast<std::uint8_t>(l.z.on));
+    put(l.z.gu());
+    put(l.z.gl());
+    put(l.ls);
+    put(l.qn);
+  }
+};
+
+//! Reads the binary record of a band, throwing if it is too short or has bad values
+struct decoder {
+  std::string_view buf;
+
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  T get() {
+    ARTS_USER_ERROR_IF(buf.size() < sizeof(T), "Unexpected end of band record")
+    T x;
+    std::memcpy(&x, buf.data(), sizeof(T));
+    buf.remove_prefix(sizeof(T));
+    return x;
+  }
+
+  template <typename T>
+    requires std::is_enum_v<T>
+  T get() {
+    const auto x = static_cast<T>(get<std::int32_t>());
+    ARTS_USER_ERROR_IF(not good_enum(x), "Bad enumeration value {} in band record", static_cast<std::int32_t>(x))
+    return x;
+  }
+
+  String get_string() {
+    const auto n = get<std::uint64_t>();
+    ARTS_USER_ERROR_IF(buf.size() < n, "Unexpected end of band record")
+    String s{buf.substr(0, n)};
+    buf.remove_prefix(n);
+    return s;
+  }
+
+  Quantum::Value get_value() {
+    Quantum::Value v;
+    if (get<std::uint8_t>() == 0) {
+      const auto n = get<Index>();
+      const auto d = get<Index>();
+      v.value      = Rational{n, d};
+    } else {
+      v.value = get_string();
+    }
+    return v;
+  }
+
+  QuantumState get_state() {
+    QuantumState qn;
+    const auto   n = get<std::uint64_t>();
+    qn.reserve(n);
+    for (std::uint64_t i = 0; i < n; i++) {
+      const auto type = get<QuantumNumberType>();
+      auto&      ul   = qn[type];
+      ul.upper        = get_value();
+      ul.lower        = get_value();
+    }
+    return qn;
+  }
+
+  line_shape::model get_line_shape() {
+    line_shape::model ls;
+    ls.T0            = get<Numeric>();
+    const auto nspec = get<std::uint64_t>();
+    ls.single_models.reserve(nspec);
+    for (std::uint64_t i = 0; i < nspec; i++) {
+      auto&      model = ls.single_models[get<SpeciesEnum>()];
+      const auto nvar  = get<std::uint64_t>();
+      model.data.reserve(nvar);
+      for (std::uint64_t j = 0; j < nvar; j++) {
+        const auto var  = get<LineShapeModelVariable>();
+        const auto type = get<LineShapeModelType>();
+        Vector     x(get<std::uint64_t>());
+        for (auto& v : x) v = get<Numeric>();
+        model.data[var] = temperature::data{type, std::move(x)};
+      }
+    }
+    return ls;
+  }
+
+  line get_line() {
+    line l;
+    l.f0   = get<Numeric>();
+    l.a    = get<Numeric>();
+    l.e0   = get<Numeric>();
+    l.gu   = get<Numeric>();
+    l.gl   = get<Numeric>();
+    l.z.on = get<std::uint8_t>() != 0;
+    l.z.gu(get<Numeric>());
+    l.z.gl(get<Numeric>());
+    l.ls = get_line_shape();
+    l.qn = get_state();
+    return l;
+  }
+};
+
+std::string encode(const QuantumIdentifier& key, const band_data& band) {
+  encoder enc;
+  enc.put(key.state);
+  enc.put(band.lineshape);
+  enc.put(band.cutoff.type);
+  enc.put(band.cutoff.value);
+  enc.put(static_cast<std::uint64_t>(band.lines.size()));
+
+  std::vector<Size> order(band.lines.size());
+  std::iota(order.begin(), order.end(), Size{0});
+  stdr::stable_sort(order, {}, [&band](Size i) { return band.lines[i].f0; });
+  for (Size i : order) enc.put(band.lines[i]);
+
+  return std::move(enc.buf);
+}
+
+std::pair<QuantumIdentifier, band_data> decode(const std::string_view record, const SpeciesIsotope& isot) {
+  decoder dec{record};
+
+  std::pair<QuantumIdentifier, band_data> out;
+  out.first.isot          = isot;
+  out.first.state         = dec.get_state();
+  out.second.lineshape    = dec.get<LineByLineLineshape>();
+  out.second.cutoff.type  = dec.get<LineByLineCutoffType>();
+  out.second.cutoff.value = dec.get<Numeric>();
+  const auto n            = dec.get<std::uint64_t>();
+  out.second.lines.reserve(n);
+  for (std::uint64_t i = 0; i < n; i++) out.second.lines.push_back(dec.get_line());
+
+  ARTS_USER_ERROR_IF(not dec.buf.empty(), "Band record is {} bytes too long", dec.buf.size())
+  return out;
+}
+}  // namespace
+
+void save_indexed(const std::filesystem::path& file, const AbsorptionBands& bands) try {
+  ARTS_USER_ERROR_IF(bands.empty(), "No bands to save to {}", file.string())
+
+  const SpeciesIsotope isot = bands.begin()->first.isot;
+  const std::string    name = isot.FullName();
+  ARTS_USER_ERROR_IF(name.size() >= sizeof(file_header::isotopologue), "Isotopologue name too long: {}", name)
+
+  std::vector<std::string> records;
+  std::vector<file_entry>  entries;
+  records.reserve(bands.size());
+  entries.reserve(bands.size());
+  for (auto& [key, band] : bands) {
+    ARTS_USER_ERROR_IF(key.isot != isot, "Bands of both {} and {} in one file", isot, key.isot)
+
+    records.push_back(encode(key, band));
+
+    file_entry& e = entries.emplace_back(std::numeric_limits<Numeric>::infinity(),
+                                         -std::numeric_limits<Numeric>::infinity(),
+                                         records.size() - 1,
+                                         records.back().size());
+    for (auto& l : band.lines) {
+      e.fmin = std::min(e.fmin, l.f0);
+      e.fmax = std::max(e.fmax, l.f0);
+    }
+  }
+
+  // The offset holds the record number until the order is known
+  stdr::stable_sort(entries, {}, &file_entry::fmin);
+
+  file_header header{.magic        = file_magic,
+                     .version      = file_version,
+                     .byte_order   = file_byte_order,
+                     .nbands       = entries.size(),
+                     .enums        = enums_hash(),
+                     .isotopologue = {}};
+  stdr::copy(name, header.isotopologue.begin());
+
+  std::vector<std::uint64_t> record_order(entries.size());
+  std::uint64_t              pos = sizeof(file_header) + sizeof(file_entry) * entries.size();
+  for (Size i = 0; i < entries.size(); i++) {
+    record_order[i]    = entries[i].offset;
+    entries[i].offset  = pos;
+    pos               += entries[i].bytes;
+  }
+
+  std::ofstream os(file, std::ios::binary | std::ios::trunc);
+  ARTS_USER_ERROR_IF(not os, "Cannot open {} for writing", file.string())
+
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  os.write(reinterpret_cast<const char*>(entries.data()),
+           static_cast<std::streamsize>(sizeof(file_entry) * entries.size()));
+  for (auto i : record_order) os.write(records[i].data(), static_cast<std::streamsize>(records[i].size()));
+
+  ARTS_USER_ERROR_IF(not os, "Error writing {}", file.string())
+}
+ARTS_METHOD_ERROR_CATCH
+
+AbsorptionBands read_indexed(const std::filesystem::path& file, const Numeric fmin, const Numeric fmax) try {
+  std::ifstream is(file, std::ios::binary);
+  ARTS_USER_ERROR_IF(not is, "Cannot open {}", file.string())
+
+  const auto file_size = static_cast<std::uint64_t>(std::filesystem::file_size(file));
+
+  file_header header;
+  is.read(reinterpret_cast<char*>(&header), sizeof(header));
+  ARTS_USER_ERROR_IF(not is or header.magic != file_magic, "{} is not an indexed line catalogue file", file.string())
+  ARTS_USER_ERROR_IF(header.version != file_version,
+                     "{} has version {}, only version {} is supported",
+                     file.string(),
+                     header.version,
+                     file_version)
+  ARTS_USER_ERROR_IF(header.byte_order != file_byte_order,
+                     "{} was written on a system with a different byte order",
+                     file.string())
+  ARTS_USER_ERROR_IF(header.enums != enums_hash(),
+                     "{} was written with other enumerations, recreate it from the XML catalogue",
+                     file.string())
+  ARTS_USER_ERROR_IF(header.isotopologue.back() != '\0', "Bad isotopologue name in {}", file.string())
+  const SpeciesIsotope isot = Species::select(std::string_view{header.isotopologue.data()});
+
+  std::vector<file_entry> entries(header.nbands);
+  is.read(reinterpret_cast<char*>(entries.data()),
+          static_cast<std::streamsize>(sizeof(file_entry) * entries.size()));
+  ARTS_USER_ERROR_IF(not is, "Cannot read the band index of {}", file.string())
+
+  const bool everything = fmin == -std::numeric_limits<Numeric>::infinity() and
+                          fmax == std::numeric_limits<Numeric>::infinity();
+
+  // The index is sorted by the lowest frequency, so no later band can overlap the window
+  const auto last = everything ? entries.end() : stdr::upper_bound(entries, fmax, {}, &file_entry::fmin);
+
+  std::vector<file_entry> selected;
+  std::copy_if(entries.begin(), last, std::back_inserter(selected), [everything, fmin](const file_entry& e) {
+    return everything or e.fmax >= fmin;
+  });
+  stdr::sort(selected, {}, &file_entry::offset);
+
+  AbsorptionBands out;
+  out.reserve(selected.size());
+
+  std::string record;
+  for (auto& e : selected) {
+    ARTS_USER_ERROR_IF(e.offset + e.bytes > file_size, "A band record is outside of {}", file.string())
+
+    record.resize(e.bytes);
+    is.seekg(static_cast<std::streamoff>(e.offset));
+    is.read(record.data(), static_cast<std::streamsize>(e.bytes));
+    ARTS_USER_ERROR_IF(not is, "Cannot read a band record of {}", file.string())
+
+    auto [key, band] = decode(record, isot);
+
+    if (not everything) {
+      auto& lines = band.lines;
+      lines.erase(stdr::upper_bound(lines, fmax, {}, &line::f0), lines.end());
+      lines.erase(lines.begin(), stdr::lower_bound(lines, fmin, {}, &line::f0));
+      if (lines.empty()) continue;
+    }
+
+    out[std::move(key)] = std::move(band);
+  }
+
+  return out;
+}
+ARTS_METHOD_ERROR_CATCH
+}  // namespace lbl
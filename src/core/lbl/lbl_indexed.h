@@ -0,0 +1,43 @@
+#pragma once
+
+#include <filesystem>
+#include <limits>
+
+#include "lbl_data.h"
+
+namespace lbl {
+/** Saves the bands of one isotopologue in the indexed binary format
+
+  The file starts with a 72-byte header, followed by a 32-byte index
+  entry per band holding the frequency range of its lines and the
+  position of the band in the file.  The index is sorted by the lowest
+  line frequency.  The bands follow the index, each as a self-contained
+  binary record with its lines sorted by frequency.  All numbers are
+  stored in the native byte order.
+
+  Enumerations are stored by value.  The header holds a hash of the
+  names and values of these enumerations, and files written when ARTS
+  had other enumerations are rejected on reading.  They must then be
+  recreated from the XML catalogue.
+
+  @param file The file to write
+  @param bands The bands to save, all of the same isotopologue
+*/
+void save_indexed(const std::filesystem::path& file, const AbsorptionBands& bands);
+
+/** Reads the bands saved by save_indexed that have lines in [fmin, fmax]
+
+  Only the index and the selected bands are read.  Lines outside of the
+  window are removed from the bands and bands without lines in the window
+  are not read at all, as by abs_bandsSelectFrequencyByLine.  An unbounded
+  window reads everything, including bands without lines.
+
+  @param file The file to read
+  @param fmin The lowest line frequency to keep
+  @param fmax The highest line frequency to keep
+  @return The bands
+*/
+AbsorptionBands read_indexed(const std::filesystem::path& file,
+                             Numeric                      fmin = -std::numeric_limits<Numeric>::infinity(),
+                             Numeric                      fmax = std::numeric_limits<Numeric>::infinity());
+}  // namespace lbl
@@ -4,6 +4,7 @@
 #include <quantum.h>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <ranges>
 
@@ -17,37 +18,40 @@
 namespace lbl {
 namespace {
 std::unique_ptr<voigt::lte::ComputeData> init_voigt_lte_data(const ConstVectorView& f_grid,
-                                                             const AbsorptionBands& bnds,
+                                                             const auto&            bnds,
                                                              const AtmPoint&        atm,
                                                              const Vector2          los) {
-  if (stdr::any_of(bnds | stdv::values, [](auto& bnd) { return bnd.lineshape == LineByLineLineshape::VP_LTE; }))
+  if (stdr::any_of(bnds | stdv::values,
+                   [](const band_data& bnd) { return bnd.lineshape == LineByLineLineshape::VP_LTE; }))
     return std::make_unique<voigt::lte::ComputeData>(f_grid, atm, los, ZeemanPolarization::no);
   return nullptr;
 }
 
 std::unique_ptr<voigt::lte_mirror::ComputeData> init_voigt_lte_mirrored_data(const ConstVectorView& f_grid,
-                                                                             const AbsorptionBands& bnds,
+                                                                             const auto&            bnds,
                                                                              const AtmPoint&        atm,
                                                                              const Vector2          los) {
-  if (stdr::any_of(bnds | stdv::values, [](auto& bnd) { return bnd.lineshape == LineByLineLineshape::VP_LTE_MIRROR; }))
+  if (stdr::any_of(bnds | stdv::values,
+                   [](const band_data& bnd) { return bnd.lineshape == LineByLineLineshape::VP_LTE_MIRROR; }))
     return std::make_unique<voigt::lte_mirror::ComputeData>(f_grid, atm, los, ZeemanPolarization::no);
   return nullptr;
 }
 
 std::unique_ptr<voigt::nlte::ComputeData> init_voigt_line_nlte_data(const ConstVectorView& f_grid,
-                                                                    const AbsorptionBands& bnds,
+                                                                    const auto&            bnds,
                                                                     const AtmPoint&        atm,
                                                                     const Vector2          los) {
-  if (stdr::any_of(bnds | stdv::values, [](auto& bnd) { return bnd.lineshape == LineByLineLineshape::VP_LINE_NLTE; }))
+  if (stdr::any_of(bnds | stdv::values,
+                   [](const band_data& bnd) { return bnd.lineshape == LineByLineLineshape::VP_LINE_NLTE; }))
     return std::make_unique<voigt::nlte::ComputeData>(f_grid, atm, los, ZeemanPolarization::no);
   return nullptr;
 }
 
 std::unique_ptr<voigt::ecs::ComputeData> init_voigt_abs_ecs_data(const ConstVectorView& f_grid,
-                                                                 const AbsorptionBands& bnds,
+                                                                 const auto&            bnds,
                                                                  const AtmPoint&        atm,
                                                                  const Vector2          los) {
-  if (stdr::any_of(bnds | stdv::values, [](auto& bnd) {
+  if (stdr::any_of(bnds | stdv::values, [](const band_data& bnd) {
         return bnd.lineshape == LineByLineLineshape::VP_ECS_MAKAROV or
                bnd.lineshape == LineByLineLineshape::VP_ECS_HARTMANN or
                bnd.lineshape == LineByLineLineshape::VP_ECS_STOTOP or
@@ -56,21 +60,20 @@ std::unique_ptr<voigt::ecs::ComputeData> init_voigt_abs_ecs_data(const ConstVect
     return std::make_unique<voigt::ecs::ComputeData>(f_grid, atm, los, ZeemanPolarization::no);
   return nullptr;
 }
-}  // namespace
 
-void calculate(PropmatVectorView        pm,
-               StokvecVectorView        sv,
-               PropmatMatrixView        dpm,
-               StokvecMatrixView        dsv,
-               const ConstVectorView    f_grid,
-               const Range&             f_range,
-               const Jacobian::Targets& jac_targets,
-               const SpeciesEnum        species,
-               const AbsorptionBands&   bnds,
-               const LinemixingEcsData& abs_ecs_data,
-               const AtmPoint&          atm,
-               const Vector2            los,
-               const bool               no_negative_absorption) {
+void calculate_bands(PropmatVectorView        pm,
+                     StokvecVectorView        sv,
+                     PropmatMatrixView        dpm,
+                     StokvecMatrixView        dsv,
+                     const ConstVectorView    f_grid,
+                     const Range&             f_range,
+                     const Jacobian::Targets& jac_targets,
+                     const SpeciesEnum        species,
+                     const auto&              bnds,
+                     const LinemixingEcsData& abs_ecs_data,
+                     const AtmPoint&          atm,
+                     const Vector2            los,
+                     const bool               no_negative_absorption) {
   auto voigt_lte_data        = init_voigt_lte_data(f_grid[f_range], bnds, atm, los);
   auto voigt_lte_mirror_data = init_voigt_lte_mirrored_data(f_grid[f_range], bnds, atm, los);
   auto voigt_line_nlte_data  = init_voigt_line_nlte_data(f_grid[f_range], bnds, atm, los);
@@ -137,7 +140,7 @@ void calculate(PropmatVectorView        pm,
     }
   };
 
-  for (auto& [bnd_key, bnd] : bnds) {
+  for (auto&& [bnd_key, bnd] : bnds) {
     if (species == bnd_key.isot.spec or species == SpeciesEnum::Bath) {
       calc_switch(bnd_key, bnd, ZeemanPolarization::no);
     }
@@ -148,9 +151,155 @@ void calculate(PropmatVectorView        pm,
     if (voigt_lte_mirror_data) voigt_lte_mirror_data->update_zeeman(los, atm.mag, pol);
     if (voigt_line_nlte_data) voigt_line_nlte_data->update_zeeman(los, atm.mag, pol);
 
-    for (auto& [bnd_key, bnd] : bnds) {
+    for (auto&& [bnd_key, bnd] : bnds) {
       if (species == bnd_key.isot.spec or species == SpeciesEnum::Bath) { calc_switch(bnd_key, bnd, pol); }
     }
   }
 }
+
+//! The lines of a band can only reach frequencies within the cutoff of a line
+bool has_finite_window(const band_data& bnd) {
+  switch (bnd.lineshape) {
+    case LineByLineLineshape::VP_LTE:          [[fallthrough]];
+    case LineByLineLineshape::VP_LTE_MIRROR:   [[fallthrough]];
+    case LineByLineLineshape::VP_LINE_NLTE:    return bnd.cutoff.type == LineByLineCutoffType::ByLine;
+    case LineByLineLineshape::VP_ECS_MAKAROV:  [[fallthrough]];
+    case LineByLineLineshape::VP_ECS_HARTMANN: [[fallthrough]];
+    case LineByLineLineshape::VP_ECS_STOTOP:   [[fallthrough]];
+    case LineByLineLineshape::VP_ECS_SPHTOP:   return false;
+  }
+  return false;
+}
+}  // namespace
+
+void calculate(PropmatVectorView        pm,
+               StokvecVectorView        sv,
+               PropmatMatrixView        dpm,
+               StokvecMatrixView        dsv,
+               const ConstVectorView    f_grid,
+               const Range&             f_range,
+               const Jacobian::Targets& jac_targets,
+               const SpeciesEnum        species,
+               const AbsorptionBands&   bnds,
+               const LinemixingEcsData& abs_ecs_data,
+               const AtmPoint&          atm,
+               const Vector2            los,
+               const bool               no_negative_absorption) {
+  calculate_bands(
+      pm, sv, dpm, dsv, f_grid, f_range, jac_targets, species, bnds, abs_ecs_data, atm, los, no_negative_absorption);
+}
+
+void calculate(PropmatVectorView                  pm,
+               StokvecVectorView                  sv,
+               PropmatMatrixView                  dpm,
+               StokvecMatrixView                  dsv,
+               const ConstVectorView              f_grid,
+               const Range&                       f_range,
+               const Jacobian::Targets&           jac_targets,
+               const SpeciesEnum                  species,
+               const std::span<const band_window> bnds,
+               const LinemixingEcsData&           abs_ecs_data,
+               const AtmPoint&                    atm,
+               const Vector2                      los,
+               const bool                         no_negative_absorption) {
+  if (f_range.nelem == 0) return;
+
+  const auto [fmin, fmax] = stdr::minmax(f_grid[f_range]);
+
+  std::vector<band_window> overlapping;
+  overlapping.reserve(bnds.size());
+  for (auto& w : bnds) {
+    if (w.fmin > fmax) break;
+    if (w.fmax >= fmin) overlapping.push_back(w);
+  }
+  if (overlapping.empty()) return;
+
+  calculate_bands(pm,
+                  sv,
+                  dpm,
+                  dsv,
+                  f_grid,
+                  f_range,
+                  jac_targets,
+                  species,
+                  overlapping | stdv::transform([](const band_window& w) {
+                    return std::pair<const QuantumIdentifier&, const band_data&>{*w.key, *w.band};
+                  }),
+                  abs_ecs_data,
+                  atm,
+                  los,
+                  no_negative_absorption);
+}
+
+std::vector<band_window> band_windows(const AbsorptionBands& bnds, const SpeciesEnum species) {
+  std::vector<band_window> out;
+  out.reserve(bnds.size());
+
+  for (auto& [key, bnd] : bnds) {
+    if (bnd.lines.empty()) continue;
+    if (species != key.isot.spec and species != SpeciesEnum::Bath) continue;
+
+    band_window& w = out.emplace_back(&key,
+                                      &bnd,
+                                      -std::numeric_limits<Numeric>::infinity(),
+                                      std::numeric_limits<Numeric>::infinity(),
+                                      bnd.lines.size());
+
+    if (has_finite_window(bnd)) {
+      const auto [lo, hi] = stdr::minmax(bnd.lines | stdv::transform(&line::f0));
+      w.fmin              = lo - bnd.get_cutoff_frequency();
+      w.fmax              = hi + bnd.get_cutoff_frequency();
+    }
+  }
+
+  stdr::sort(out, {}, &band_window::fmin);
+  return out;
+}
+
+Size frequency_tile_size(const Size njac) {
+  // The output with its derivatives, and the line shape, its derivatives, and the Zeeman scaling of the work buffers
+  constexpr Size min_size = 64;
+  const Size     bytes    = (1 + njac) * (sizeof(Propmat) + sizeof(Stokvec) + sizeof(Complex)) + 2 * sizeof(Complex);
+  return std::max(min_size, tile_bytes / bytes);
+}
+
+std::vector<Range> frequency_tiles(const ConstVectorView              f_grid,
+                                   const std::span<const band_window> bnds,
+                                   const Size                         nthreads,
+                                   const Size                         tile_size) {
+  const Size nf = f_grid.size();
+  if (nf == 0) return {};
+
+  // Small enough for the work of a tile to stay in cache, many enough for the threads to balance
+  const Size n = std::min(nf, std::max((nf + tile_size - 1) / tile_size, tiles_per_thread * nthreads));
+
+  std::vector<Range> tiles;
+  tiles.reserve(n);
+  for (Size i = 0; i < n; i++) {
+    const Size i0 = i * nf / n;
+    const Size i1 = (i + 1) * nf / n;
+    tiles.emplace_back(i0, i1 - i0);
+  }
+
+  std::vector<std::pair<Size, Range>> work;
+  work.reserve(tiles.size());
+  for (auto& tile : tiles) {
+    const auto [fmin, fmax] = stdr::minmax(f_grid[tile]);
+
+    Size nlines = 0;
+    for (auto& w : bnds) {
+      if (w.fmin > fmax) break;
+      if (w.fmax >= fmin) nlines += w.nlines;
+    }
+
+    work.emplace_back(nlines * static_cast<Size>(tile.nelem), tile);
+  }
+
+  // The most expensive tiles first, so that the cheap ones fill in at the end
+  stdr::stable_sort(work, stdr::greater{}, [](auto& x) { return x.first; });
+
+  tiles.clear();
+  for (auto& [cost, tile] : work) tiles.push_back(tile);
+  return tiles;
+}
 }  // namespace lbl
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
 
@@ -22,4 +25,84 @@ void calculate(PropmatVectorView        pm,
                const AtmPoint&          atm,
                const Vector2            los,
                const bool               no_negative_absorption);
+
+//! A band of a species and the frequencies its lines may reach
+struct band_window {
+  const QuantumIdentifier* key;
+  const band_data*         band;
+
+  //! The lowest frequency reached, minus infinity if there is no cutoff
+  Numeric fmin;
+
+  //! The highest frequency reached, infinity if there is no cutoff
+  Numeric fmax;
+
+  //! The number of lines of the band
+  Size nlines;
+};
+
+/** The windows of the bands of a species, sorted by their lowest frequency
+
+  Bands without lines are left out.  Only bands that are computed line by
+  line with a cutoff get a finite window; the line mixing of ECS bands
+  reaches all frequencies.
+
+  The windows point into bnds, which must outlive them.
+
+  @param bnds The bands
+  @param species The species to compute, Bath for all of them
+  @return The windows
+*/
+std::vector<band_window> band_windows(const AbsorptionBands& bnds, const SpeciesEnum species);
+
+//! The minimum number of frequency tiles per thread of frequency_tiles
+inline constexpr Size tiles_per_thread = 4;
+
+//! The bytes a frequency tile should at most touch, about the size of a private L2 cache
+inline constexpr Size tile_bytes = 1 << 18;
+
+/** The number of frequencies of a tile whose output and work buffers fit in tile_bytes
+
+  @param njac The number of Jacobian targets
+  @return The preferred number of frequencies per tile
+*/
+Size frequency_tile_size(const Size njac);
+
+/** Splits a frequency grid into tiles for the threads to share
+
+  The tiles are about tile_size frequencies large and at least
+  tiles_per_thread per thread.  They are ordered by the number of lines
+  whose windows overlap them times their size, most expensive first, so
+  that threads taking tiles in order finish at about the same time.
+
+  @param f_grid The frequency grid
+  @param bnds The band windows, as from band_windows()
+  @param nthreads The number of threads
+  @param tile_size The preferred number of frequencies per tile
+  @return The tiles as ranges of f_grid
+*/
+std::vector<Range> frequency_tiles(const ConstVectorView              f_grid,
+                                   const std::span<const band_window> bnds,
+                                   const Size                         nthreads,
+                                   const Size                         tile_size);
+
+/** As the other calculate() but only for the bands overlapping f_grid[f_range]
+
+  Only the bands whose windows overlap the frequency range are considered.
+
+  @param bnds The band windows, as from band_windows()
+*/
+void calculate(PropmatVectorView                  pm,
+               StokvecVectorView                  sv,
+               PropmatMatrixView                  dpm,
+               StokvecMatrixView                  dsv,
+               const ConstVectorView              f_grid,
+               const Range&                       f_range,
+               const Jacobian::Targets&           jac_targets,
+               const SpeciesEnum                  species,
+               const std::span<const band_window> bnds,
+               const LinemixingEcsData&           abs_ecs_data,
+               const AtmPoint&                    atm,
+               const Vector2                      los,
+               const bool                         no_negative_absorption);
 }  // namespace lbl
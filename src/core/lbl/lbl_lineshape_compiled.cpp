@@ -0,0 +1,223 @@
+#include "lbl_lineshape_compiled.h"
+
+#include <debug.h>
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+#include "lbl_temperature_model.h"
+
+namespace lbl::line_shape {
+namespace {
+constexpr Size nvar = enumsize::LineShapeModelVariableSize;
+
+//! The pressure factor of the variable, see the VARIABLE macro in lbl_lineshape_model.cpp
+Numeric pressure_factor(const LineShapeModelVariable var, const Numeric P) {
+  switch (var) {
+    using enum LineShapeModelVariable;
+    case ETA: return 1.0;
+    case G:
+    case DV:  return P * P;
+    default:  return P;
+  }
+}
+
+/*! Adds scl * model(x, ref_T[line], T) to out[line] for rows j0 to j1 of the group
+
+  The switch on the model type is outside the loop over the lines.
+*/
+void add_group(VectorView                  out,
+               const compiled_band::group& g,
+               const ConstVectorView&      ref_T,
+               const Numeric               T,
+               const Numeric               scl,
+               const Size                  j0,
+               const Size                  j1) {
+  const auto loop = [&](auto&& f) {
+    for (Size j = j0; j < j1; j++) {
+      const Size i  = g.line[j];
+      out[i]       += scl * f(g.x[j], ref_T[i]);
+    }
+  };
+
+  namespace tm = temperature::model;
+  switch (g.type) {
+    using enum LineShapeModelType;
+    case T0:   loop([](const auto& x, Numeric) { return tm::T0(x[0]); }); break;
+    case T1:   loop([T](const auto& x, Numeric t0) { return tm::T1(x[0], x[1], t0, T); }); break;
+    case T2:   loop([T](const auto& x, Numeric t0) { return tm::T2(x[0], x[1], x[2], t0, T); }); break;
+    case T3:   loop([T](const auto& x, Numeric t0) { return tm::T3(x[0], x[1], t0, T); }); break;
+    case T4:   loop([T](const auto& x, Numeric t0) { return tm::T4(x[0], x[1], x[2], t0, T); }); break;
+    case T5:   loop([T](const auto& x, Numeric t0) { return tm::T5(x[0], x[1], t0, T); }); break;
+    case AER:  loop([T](const auto& x, Numeric) { return tm::AER(x[0], x[1], x[2], x[3], T); }); break;
+    case DPL:  loop([T](const auto& x, Numeric t0) { return tm::DPL(x[0], x[1], x[2], x[3], t0, T); }); break;
+    case POLY: loop([T](const auto& x, Numeric) { return tm::POLY(x, T); }); break;
+  }
+}
+}  // namespace
+
+compiled_band::compiled_band(const band_data& bnd) {
+  const Size n = bnd.size();
+
+  for (auto& line : bnd) {
+    for (auto& s : line.ls.single_models | stdv::keys) {
+      if (stdr::find(species, s) == species.end()) species.push_back(s);
+    }
+  }
+
+  broadens = Matrix(n, species.size(), 0.0);
+  T0       = Vector(n);
+
+  std::map<std::tuple<Size, LineShapeModelVariable, LineShapeModelType>, Size> group_pos;
+  std::vector<Size>                                                             ncoeff;
+
+  entry_offsets.reserve(n + 1);
+  entry_offsets.push_back(0);
+  for (Size i = 0; i < n; i++) {
+    const auto& ls = bnd.lines[i].ls;
+    T0[i]          = ls.T0;
+
+    for (auto& [s, m] : ls.single_models) {
+      const auto ispec = static_cast<Size>(std::distance(species.begin(), stdr::find(species, s)));
+      broadens[i, ispec] = 1.0;
+
+      for (auto& [var, data] : m.data) {
+        auto [ptr, is_new] = group_pos.try_emplace({ispec, var, data.Type()}, groups.size());
+        if (is_new) {
+          groups.push_back({.ispec = ispec, .var = var, .type = data.Type()});
+          ncoeff.push_back(0);
+        }
+
+        const Size ig = ptr->second;
+        entries.emplace_back(ig, groups[ig].line.size());
+        groups[ig].line.push_back(i);
+        ncoeff[ig] = std::max(ncoeff[ig], static_cast<Size>(data.X().size()));
+      }
+    }
+
+    entry_offsets.push_back(entries.size());
+  }
+
+  for (Size ig = 0; ig < groups.size(); ig++) groups[ig].x = Matrix(groups[ig].line.size(), ncoeff[ig], 0.0);
+
+  Size e = 0;
+  for (auto& line : bnd) {
+    for (auto& m : line.ls.single_models | stdv::values) {
+      for (auto& data : m.data | stdv::values) {
+        const auto [ig, row]                         = entries[e++];
+        groups[ig].x[row][Range(0, data.X().size())] = data.X();
+      }
+    }
+  }
+}
+
+bool compiled_band::matches(const band_data& bnd) const {
+  if (bnd.size() != size()) return false;
+
+  for (Size i = 0; i < size(); i++) {
+    const auto& ls = bnd.lines[i].ls;
+    if (ls.T0 != T0[i]) return false;
+
+    const auto nspec = static_cast<Size>(stdr::count(broadens[i], 1.0));
+    if (ls.single_models.size() != nspec) return false;
+
+    Size e = entry_offsets[i];
+    for (auto& [s, m] : ls.single_models) {
+      const auto ptr = stdr::find(species, s);
+      if (ptr == species.end()) return false;
+
+      const auto ispec = static_cast<Size>(std::distance(species.begin(), ptr));
+      if (broadens[i, ispec] == 0.0) return false;
+
+      for (auto& [var, data] : m.data) {
+        if (e == entry_offsets[i + 1]) return false;
+
+        const auto [ig, row] = entries[e++];
+        const group& g       = groups[ig];
+        if (g.ispec != ispec or g.var != var or g.type != data.Type()) return false;
+
+        const auto& X = data.X();
+        const auto  x = g.x[row];
+        if (X.size() > x.size()) return false;
+        if (not stdr::equal(X, x[Range(0, X.size())])) return false;
+        if (not stdr::all_of(x[Range(X.size(), x.size() - X.size())], [](Numeric v) { return v == 0.0; }))
+          return false;
+      }
+    }
+
+    if (e != entry_offsets[i + 1]) return false;
+  }
+
+  return true;
+}
+
+void compiled_band::evaluate(values& v, const AtmPoint& atm, const Range& lines) const {
+  const Size n    = size();
+  const Size ns   = species.size();
+  const auto l0   = static_cast<Size>(lines.offset);
+  const auto l1   = l0 + static_cast<Size>(lines.nelem);
+  const auto cols = Range(l0, l1 - l0);
+  assert(l1 <= n);
+
+  if (static_cast<Size>(v.value.ncols()) != n) {
+    v.value = Matrix(nvar, n, 0.0);
+    v.bath  = Matrix(nvar, n, 0.0);
+    v.vmr   = Vector(n, 0.0);
+  }
+  v.species_vmr.resize(ns);
+
+  v.value[joker, cols] = 0.0;
+  v.bath[joker, cols]  = 0.0;
+
+  // Only species that broaden a line in the range need to be in the atmosphere
+  const auto bath = static_cast<Size>(std::distance(species.begin(), stdr::find(species, SpeciesEnum::Bath)));
+  for (Size k = 0; k < ns; k++) {
+    const bool used = k != bath and stdr::any_of(broadens[joker, k][cols], [](Numeric x) { return x != 0.0; });
+    v.species_vmr[k] = used ? atm[species[k]] : 0.0;
+  }
+
+  for (Size i = l0; i < l1; i++) {
+    const auto b = broadens[i];
+    Numeric    x = 0.0;
+    for (Size k = 0; k < ns; k++) x += b[k] * v.species_vmr[k];
+    v.vmr[i] = x;
+  }
+
+  for (auto& g : groups) {
+    const auto j0 = static_cast<Size>(std::distance(g.line.begin(), stdr::lower_bound(g.line, l0)));
+    const auto j1 = static_cast<Size>(std::distance(g.line.begin(), stdr::lower_bound(g.line, l1)));
+    if (j0 == j1) continue;
+
+    const bool is_bath = g.ispec == bath;
+    add_group((is_bath ? v.bath : v.value)[static_cast<Size>(g.var)],
+              g,
+              T0,
+              atm.temperature,
+              is_bath ? 1.0 : v.species_vmr[g.ispec],
+              j0,
+              j1);
+  }
+
+  // Same as the reduction over species in model::G0 etc.
+  for (Size ivar = 0; ivar < nvar; ivar++) {
+    const Numeric scl = pressure_factor(static_cast<LineShapeModelVariable>(ivar), atm.pressure);
+    auto          res = v.value[ivar];
+    const auto    bth = v.bath[ivar];
+    for (Size i = l0; i < l1; i++) {
+      const bool    has_bath = bath != ns and broadens[i, bath] != 0.0;
+      const Numeric vmr      = v.vmr[i];
+      res[i] = scl * (has_bath ? res[i] + (1.0 - vmr) * bth[i] : (vmr != 0.0 ? res[i] / vmr : 0.0));
+    }
+  }
+}
+
+std::shared_ptr<const compiled_band> compiled(const band_data& bnd) {
+  if (auto out = bnd.cache.line_shape(); out and out->matches(bnd)) return out;
+
+  // Threads that miss at the same time compile the same band, the last one is kept
+  auto out = std::make_shared<const compiled_band>(bnd);
+  bnd.cache.line_shape(out);
+  return out;
+}
+}  // namespace lbl::line_shape
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atm.h>
+#include <enumsLineShapeModelType.h>
+#include <enumsLineShapeModelVariable.h>
+#include <enumsSpeciesEnum.h>
+#include <matpack.h>
+
+#include <memory>
+#include <vector>
+
+#include "lbl_data.h"
+
+namespace lbl::line_shape {
+/** The line shape models of all lines of a band, flattened for evaluation
+
+  The temperature models of the band are grouped by broadening species,
+  line shape variable, and model type.  Each group stores the coefficients
+  of its lines in one contiguous matrix, so that a variable is evaluated
+  for all lines by a few tight loops without map lookups or switches per
+  line.
+
+  The result for each line is the same as calling the corresponding
+  model method, e.g., line.ls.G0(atm), but the terms of the sum over
+  broadening species may be added in a different order.
+*/
+struct compiled_band {
+  //! All temperature models of one species, variable, and model type
+  struct group {
+    //! Position of the broadening species in species
+    Size ispec{};
+
+    LineShapeModelVariable var{};
+
+    LineShapeModelType type{};
+
+    //! The lines of the group in ascending order
+    std::vector<Size> line{};
+
+    //! The coefficients, one row per line.  POLY rows are padded with zeroes.
+    Matrix x{};
+  };
+
+  //! The evaluated variables of all lines, see evaluate
+  struct values {
+    //! One row per LineShapeModelVariable, one column per line
+    Matrix value{};
+
+    //! The bath values, same layout as value
+    Matrix bath{};
+
+    //! The sum of the VMR of the broadening species of each line, excluding Bath
+    Vector vmr{};
+
+    //! The VMR of each broadening species
+    Vector species_vmr{};
+
+    template <typename Self> [[nodiscard]] auto operator[](this Self&& self, LineShapeModelVariable var) {
+      return self.value[static_cast<Size>(var)];
+    }
+  };
+
+  //! All broadening species of the band
+  std::vector<SpeciesEnum> species{};
+
+  //! 1 if the species broadens the line, 0 otherwise.  Lines x species
+  Matrix broadens{};
+
+  //! The reference temperature of each line
+  Vector T0{};
+
+  std::vector<group> groups{};
+
+  //! The group and row of each model of a line, in the iteration order of the line's maps
+  std::vector<std::pair<Size, Size>> entries{};
+
+  //! Where the entries of each line start, one more than there are lines
+  std::vector<Size> entry_offsets{};
+
+  compiled_band() = default;
+
+  explicit compiled_band(const band_data& bnd);
+
+  [[nodiscard]] Size size() const { return T0.size(); }
+
+  //! True if the line shape models of the band are still those that were compiled
+  [[nodiscard]] bool matches(const band_data& bnd) const;
+
+  /** Evaluates all variables of the lines in the range
+
+    Only columns in lines are set in v.value, the rest are undefined.
+
+    @param[out] v The values, resized to fit all lines of the band
+    @param[in] atm The atmospheric point
+    @param[in] lines The lines to evaluate
+  */
+  void evaluate(values& v, const AtmPoint& atm, const Range& lines) const;
+};
+
+/** The compiled line shape models of a band
+
+  The compiled band is kept in the band's cache and shared between all
+  callers, across threads and calls.  It is rebuilt if the band's line
+  shape models no longer match it, and freed with the band.  The check
+  is a single pass over the coefficients, which is far cheaper than the
+  compilation and of the same order as one call to evaluate.
+
+  @param bnd The band
+  @return The compiled line shape models of bnd
+*/
+std::shared_ptr<const compiled_band> compiled(const band_data& bnd);
+}  // namespace lbl::line_shape
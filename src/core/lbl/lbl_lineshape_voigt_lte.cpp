@@ -15,14 +15,20 @@
 #include <numeric>
 
 #include "lbl_data.h"
+#include "lbl_faddeeva.h"
+#include "lbl_lineshape_compiled.h"
 #include "lbl_zeeman.h"
 
 namespace lbl::voigt::lte {
 namespace {
-Complex line_strength_calc(const Numeric inv_gd, const SpeciesIsotope& spec, const line& line, const AtmPoint& atm) {
-  const auto    s = line.s(atm.temperature, PartitionFunctions::Q(atm.temperature, spec));
-  const Numeric G = line.ls.G(atm);
-  const Numeric Y = line.ls.Y(atm);
+Complex line_strength_calc(const Numeric        inv_gd,
+                           const SpeciesIsotope& spec,
+                           const line&           line,
+                           const AtmPoint&       atm,
+                           const Numeric         Q,
+                           const Numeric         G,
+                           const Numeric         Y) {
+  const auto s = line.s(atm.temperature, Q);
 
   const Complex lm{1 + G, -Y};
   const Numeric r = atm[spec];
@@ -31,6 +37,11 @@ Complex line_strength_calc(const Numeric inv_gd, const SpeciesIsotope& spec, con
   return Constant::inv_sqrt_pi * inv_gd * r * x * lm * s;
 }
 
+Complex line_strength_calc(const Numeric inv_gd, const SpeciesIsotope& spec, const line& line, const AtmPoint& atm) {
+  return line_strength_calc(
+      inv_gd, spec, line, atm, PartitionFunctions::Q(atm.temperature, spec), line.ls.G(atm), line.ls.Y(atm));
+}
+
 Complex dline_strength_calc_dY(
     const Numeric dY, const Numeric inv_gd, const SpeciesIsotope& spec, const line& line, const AtmPoint& atm) {
   const auto s = line.s(atm.temperature, PartitionFunctions::Q(atm.temperature, spec));
@@ -141,21 +152,33 @@ struct single_shape_builder {
   Numeric               f0;
   Numeric               scaled_gd_part;
   Numeric               G0;
-
-  single_shape_builder(const SpeciesIsotope& s, const line& l, const AtmPoint& a)
+  Numeric               Q;
+  Numeric               G;
+  Numeric               Y;
+
+  //! Takes the line shape variables of line iline from the compiled band
+  single_shape_builder(const SpeciesIsotope&                    s,
+                       const line&                              l,
+                       const AtmPoint&                          a,
+                       const line_shape::compiled_band::values& v,
+                       const Size                               iline,
+                       const Numeric                            q)
       : spec(s),
         ln(l),
         atm(a),
-        f0(line_center_calc(l, atm)),
+        f0(l.f0 + v[LineShapeModelVariable::D0][iline] + v[LineShapeModelVariable::DV][iline]),
         scaled_gd_part(std::sqrt(Constant::doppler_broadening_const_squared * atm.temperature / s.mass)),
-        G0(l.ls.G0(atm)) {}
+        G0(v[LineShapeModelVariable::G0][iline]),
+        Q(q),
+        G(v[LineShapeModelVariable::G][iline]),
+        Y(v[LineShapeModelVariable::Y][iline]) {}
 
   [[nodiscard]] single_shape as_zeeman(const Numeric H, const ZeemanPolarization pol, const Size iz) const {
     single_shape s;
     s.f0     = f0 + H * ln.z.Splitting(ln.qn, pol, iz);
     s.inv_gd = 1.0 / (scaled_gd_part * f0);
     s.z_imag = G0 * s.inv_gd;
-    s.s      = ln.z.Strength(ln.qn, pol, iz) * line_strength_calc(s.inv_gd, spec, ln, atm);
+    s.s      = ln.z.Strength(ln.qn, pol, iz) * line_strength_calc(s.inv_gd, spec, ln, atm, Q, G, Y);
     return s;
   }
 
@@ -164,7 +187,7 @@ struct single_shape_builder {
     s.f0     = f0;
     s.inv_gd = 1.0 / (scaled_gd_part * f0);
     s.z_imag = G0 * s.inv_gd;
-    s.s      = line_strength_calc(s.inv_gd, spec, ln, atm);
+    s.s      = line_strength_calc(s.inv_gd, spec, ln, atm, Q, G, Y);
     return s;
   }
 };
@@ -302,15 +325,21 @@ void zeeman_push_back(std::vector<single_shape>&  lines,
   }
 }
 
-void lines_push_back(std::vector<single_shape>& lines,
-                     std::vector<line_pos>&     pos,
-                     const SpeciesIsotope&      spec,
-                     const line&                line,
-                     const AtmPoint&            atm,
-                     const ZeemanPolarization   pol,
-                     const Size                 iline) {
-  if ((line.z.on and pol != ZeemanPolarization::no) or (not line.z.on and pol == ZeemanPolarization::no)) {
-    zeeman_push_back(lines, pos, single_shape_builder{spec, line, atm}, line, atm, pol, iline);
+bool is_active(const line& line, const ZeemanPolarization pol) {
+  return (line.z.on and pol != ZeemanPolarization::no) or (not line.z.on and pol == ZeemanPolarization::no);
+}
+
+void lines_push_back(std::vector<single_shape>&               lines,
+                     std::vector<line_pos>&                   pos,
+                     const SpeciesIsotope&                    spec,
+                     const line&                              line,
+                     const AtmPoint&                          atm,
+                     const ZeemanPolarization                 pol,
+                     const Size                               iline,
+                     const line_shape::compiled_band::values& v,
+                     const Numeric                            Q) {
+  if (is_active(line, pol)) {
+    zeeman_push_back(lines, pos, single_shape_builder{spec, line, atm, v, iline, Q}, line, atm, pol, iline);
   }
 }
 }  // namespace
@@ -326,21 +355,21 @@ void band_shape_helper(std::vector<single_shape>& lines,
   lines.resize(0);
   pos.resize(0);
 
+  auto [first, active_lines] = bnd.cutoff.type == LineByLineCutoffType::ByLine
+                                   ? bnd.active_lines(fmin, fmax)
+                                   : std::pair{Size{0}, std::span<const line>{bnd.lines}};
+  if (stdr::none_of(active_lines, [pol](auto& line) { return is_active(line, pol); })) return;
+
   lines.reserve(count_lines(bnd, pol));
   pos.reserve(lines.capacity());
 
-  using enum LineByLineCutoffType;
-  switch (bnd.cutoff.type) {
-    case None:
-      for (Size iline = 0; iline < bnd.size(); iline++) {
-        lines_push_back(lines, pos, spec, bnd.lines[iline], atm, pol, iline);
-      }
-      break;
-    case ByLine: {
-      auto [iline, active_lines] = bnd.active_lines(fmin, fmax);
-      for (auto& line : active_lines) { lines_push_back(lines, pos, spec, line, atm, pol, iline++); }
-    } break;
-  }
+  // The line shape variables of all active lines at once from the shared compiled band
+  line_shape::compiled_band::values v;
+  line_shape::compiled(bnd)->evaluate(v, atm, Range(first, active_lines.size()));
+  const Numeric Q = PartitionFunctions::Q(atm.temperature, spec);
+
+  Size iline = first;
+  for (auto& line : active_lines) { lines_push_back(lines, pos, spec, line, atm, pol, iline++, v, Q); }
 
   stdr::sort(stdv::zip(lines, pos), {}, [](const auto& x) { return std::get<0>(x).f0; });
 }
@@ -480,6 +509,40 @@ void band_shape::operator()(ComplexVectorView cut) const {
       lines.begin(), lines.end(), cut.begin(), [cutoff_freq = cutoff](auto& ls) { return ls(ls.f0 + cutoff_freq); });
 }
 
+void band_shape::sum(ComplexVectorView shape, ComplexVectorView F, const ConstVectorView& f_grid) const {
+  assert(shape.size() == f_grid.size() and F.size() == f_grid.size());
+
+  shape = 0.0;
+  for (auto& ls : lines) {
+    faddeeva::w(F, f_grid, ls.f0, ls.inv_gd, ls.z_imag);
+    std::transform(
+        shape.begin(), shape.end(), F.begin(), shape.begin(), [s = ls.s](Complex a, Complex b) { return a + s * b; });
+  }
+}
+
+void band_shape::sum(ComplexVectorView             shape,
+                     ComplexVectorView             F,
+                     const ConstComplexVectorView& cut,
+                     const ConstVectorView&        f_grid) const {
+  assert(shape.size() == f_grid.size() and F.size() == f_grid.size());
+  assert(static_cast<Size>(cut.size()) == lines.size());
+
+  shape = 0.0;
+  for (Size i = 0; i < lines.size(); i++) {
+    const auto& ls = lines[i];
+
+    const Range r = faddeeva::frequency_window(f_grid, ls.f0, cutoff);
+    if (r.nelem == 0) continue;
+
+    ComplexVectorView Fr = F[r];
+    ComplexVectorView sr = shape[r];
+    faddeeva::w(Fr, f_grid[r], ls.f0, ls.inv_gd, ls.z_imag);
+    std::transform(sr.begin(), sr.end(), Fr.begin(), sr.begin(), [s = ls.s, c = cut[i]](Complex a, Complex b) {
+      return a + s * b - c;
+    });
+  }
+}
+
 Complex band_shape::df(const ConstComplexVectorView& cut, const Numeric f) const {
   const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
   return std::transform_reduce(
@@ -739,7 +802,11 @@ ComputeData::ComputeData(const ConstVectorView&   f_grid,
                          const AtmPoint&          atm,
                          const Vector2&           los,
                          const ZeemanPolarization pol)
-    : scl(f_grid.size()), dscl(f_grid.size()), shape(f_grid.size()), dshape(f_grid.size()) {
+    : scl(f_grid.size()),
+      dscl(f_grid.size()),
+      shape(f_grid.size()),
+      dshape(f_grid.size()),
+      F(f_grid.size()) {
   std::transform(f_grid.begin(),
                  f_grid.end(),
                  scl.begin(),
@@ -761,11 +828,17 @@ void ComputeData::core_calc(const band_shape& shp, const band_data& bnd, const C
   dcut.resize(shp.size());
   filter.reserve(shp.size());
 
+  const Range r{0, f_grid.size()};
+
   if (bnd.cutoff.type != LineByLineCutoffType::None) {
     shp(cut);
-    std::transform(f_grid.begin(), f_grid.end(), shape.begin(), [this, &shp](Numeric f) { return shp(cut, f); });
+    if (stdr::is_sorted(f_grid)) {
+      shp.sum(shape[r], F[r], cut, f_grid);
+    } else {
+      std::transform(f_grid.begin(), f_grid.end(), shape.begin(), [this, &shp](Numeric f) { return shp(cut, f); });
+    }
   } else {
-    std::transform(f_grid.begin(), f_grid.end(), shape.begin(), [&shp](Numeric f) { return shp(f); });
+    shp.sum(shape[r], F[r], f_grid);
   }
 }
 
@@ -1634,8 +1707,11 @@ bool calculate_shape(ComplexVectorView        pm_,
   const Size            nt     = dpm_.nrows();
 
   //! Must have to remove negative absorption later (optimization when not?)
-  ComplexVector pm(nf, 0);
-  ComplexMatrix dpm(nt, nf, 0);
+  //! Called per band and path point, so the buffers come from the arena of the thread
+  matpack::scratch_t<Complex, 1> pm_buf(nf);
+  matpack::scratch_t<Complex, 2> dpm_buf(nt, nf);
+  ComplexVectorView              pm  = pm_buf;
+  ComplexMatrixView              dpm = dpm_buf;
 
   const auto kernel =
       [&](ComplexVectorView res, StridedComplexMatrixView dres, const Size il, const ConstVectorView freqs) {
@@ -1695,10 +1771,10 @@ bool calculate_shape(ComplexVectorView        pm_,
       for (Size il = 0; il < bnd.lines.size(); il++) { has_pol = kernel(pm, dpm, il, f_grid) or has_pol; }
     } break;
     case LineByLineCutoffType::ByLine: {
-      Complex           cutoff = 0.0;
-      ComplexVector     dcutoffs(nt, 0.0);
-      ComplexVectorView cut{cutoff};
-      ComplexMatrixView dcut = dcutoffs.view_as(nt, 1);
+      Complex                        cutoff = 0.0;
+      matpack::scratch_t<Complex, 1> dcutoffs(nt);
+      ComplexVectorView              cut{cutoff};
+      ComplexMatrixView              dcut = dcutoffs.view_as(nt, 1);
 
       for (Size il = 0; il < bnd.lines.size(); il++) {
         const Numeric         l = bnd.lines[il].f0 - bnd.cutoff.value;
@@ -98,7 +98,11 @@ struct single_shape {
 
 Size count_lines(const band_data& bnd, const ZeemanPolarization type);
 
-//! Helper for initializing the band_shape
+/** Helper for initializing the band_shape
+
+  The line shape variables are evaluated from the band's shared compiled
+  line shape models, see line_shape::compiled.
+*/
 void band_shape_helper(std::vector<single_shape>& lines,
                        std::vector<line_pos>&     pos,
                        const SpeciesIsotope&      spec,
@@ -202,6 +206,29 @@ struct band_shape {
 
   void operator()(ComplexVectorView cut) const;
 
+  /** Sets the shape of all lines for all frequencies
+   *
+   * Works one line at a time over the whole frequency grid, so that
+   * the Faddeeva function is evaluated in batches.
+   *
+   * @param shape The line shape, same size as f_grid
+   * @param F Scratch space for the Faddeeva function, same size as f_grid
+   * @param f_grid The frequency grid
+   */
+  void sum(ComplexVectorView shape, ComplexVectorView F, const ConstVectorView& f_grid) const;
+
+  /** As sum(shape, F, f_grid) but with the cutoff applied
+   *
+   * @param shape The line shape, same size as f_grid
+   * @param F Scratch space for the Faddeeva function, same size as f_grid
+   * @param cut The line shape at the cutoff, see operator()(ComplexVectorView)
+   * @param f_grid The frequency grid, must be sorted
+   */
+  void sum(ComplexVectorView             shape,
+           ComplexVectorView             F,
+           const ConstComplexVectorView& cut,
+           const ConstVectorView&        f_grid) const;
+
   [[nodiscard]] Complex df(const ConstComplexVectorView& cut, const Numeric f) const;
 
   void df(ComplexVectorView cut) const;
@@ -327,13 +354,14 @@ struct ComputeData {
   Vector        dscl{};    //! Size of frequency
   ComplexVector shape{};   //! Size of frequency
   ComplexVector dshape{};  //! Size of frequency
+  ComplexVector F{};       //! Size of frequency
 
   Propmat npm{};      //! The orientation of the polarization
   Propmat dnpm_du{};  //! The orientation of the polarization
   Propmat dnpm_dv{};  //! The orientation of the polarization
   Propmat dnpm_dw{};  //! The orientation of the polarization
 
-  //! Sizes scl, dscl, shape, dshape.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
+  //! Sizes scl, dscl, shape, dshape, F.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
   ComputeData(const ConstVectorView&   f_grid,
               const AtmPoint&          atm,
               const Vector2&           los = {},
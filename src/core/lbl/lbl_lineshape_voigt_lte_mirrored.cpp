@@ -13,6 +13,7 @@
 #include <numeric>
 
 #include "lbl_data.h"
+#include "lbl_faddeeva.h"
 #include "lbl_zeeman.h"
 
 namespace lbl::voigt::lte_mirror {
@@ -483,6 +484,41 @@ void band_shape::operator()(ComplexVectorView cut) const {
       lines.begin(), lines.end(), cut.begin(), [cutoff_freq = cutoff](auto& ls) { return ls(ls.f0 + cutoff_freq); });
 }
 
+void band_shape::sum(ComplexVectorView      shape,
+                     ComplexVectorView      F,
+                     ComplexVectorView      Fm,
+                     const ConstVectorView& f_grid) const {
+  assert(shape.size() == f_grid.size() and F.size() == f_grid.size() and Fm.size() == f_grid.size());
+
+  shape = 0.0;
+  for (auto& ls : lines) {
+    faddeeva::w(F, f_grid, ls.f0, ls.inv_gd, ls.z_imag);
+    faddeeva::w(Fm, f_grid, -ls.f0, ls.inv_gd, ls.z_imag);
+    for (Size j = 0; j < f_grid.size(); j++) shape[j] += ls.s * (F[j] + Fm[j]);
+  }
+}
+
+void band_shape::sum(ComplexVectorView             shape,
+                     ComplexVectorView             F,
+                     ComplexVectorView             Fm,
+                     const ConstComplexVectorView& cut,
+                     const ConstVectorView&        f_grid) const {
+  assert(shape.size() == f_grid.size() and F.size() == f_grid.size() and Fm.size() == f_grid.size());
+  assert(static_cast<Size>(cut.size()) == lines.size());
+
+  shape = 0.0;
+  for (Size i = 0; i < lines.size(); i++) {
+    const auto& ls = lines[i];
+
+    const Range r = faddeeva::frequency_window(f_grid, ls.f0, cutoff);
+    if (r.nelem == 0) continue;
+
+    faddeeva::w(F[r], f_grid[r], ls.f0, ls.inv_gd, ls.z_imag);
+    faddeeva::w(Fm[r], f_grid[r], -ls.f0, ls.inv_gd, ls.z_imag);
+    for (Index j = r.offset; j < r.offset + r.nelem; j++) shape[j] += ls.s * (F[j] + Fm[j]) - cut[i];
+  }
+}
+
 Complex band_shape::df(const ConstComplexVectorView& cut, const Numeric f) const {
   const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
   return std::transform_reduce(
@@ -742,7 +778,12 @@ ComputeData::ComputeData(const ConstVectorView&   f_grid,
                          const AtmPoint&          atm,
                          const Vector2&           los,
                          const ZeemanPolarization pol)
-    : scl(f_grid.size()), dscl(f_grid.size()), shape(f_grid.size()), dshape(f_grid.size()) {
+    : scl(f_grid.size()),
+      dscl(f_grid.size()),
+      shape(f_grid.size()),
+      dshape(f_grid.size()),
+      F(f_grid.size()),
+      Fm(f_grid.size()) {
   std::transform(f_grid.begin(),
                  f_grid.end(),
                  scl.begin(),
@@ -764,11 +805,17 @@ void ComputeData::core_calc(const band_shape& shp, const band_data& bnd, const C
   dcut.resize(shp.size());
   filter.reserve(shp.size());
 
+  const Range r{0, f_grid.size()};
+
   if (bnd.cutoff.type != LineByLineCutoffType::None) {
     shp(cut);
-    std::transform(f_grid.begin(), f_grid.end(), shape.begin(), [this, &shp](Numeric f) { return shp(cut, f); });
+    if (stdr::is_sorted(f_grid)) {
+      shp.sum(shape[r], F[r], Fm[r], cut, f_grid);
+    } else {
+      std::transform(f_grid.begin(), f_grid.end(), shape.begin(), [this, &shp](Numeric f) { return shp(cut, f); });
+    }
   } else {
-    std::transform(f_grid.begin(), f_grid.end(), shape.begin(), [&shp](Numeric f) { return shp(f); });
+    shp.sum(shape[r], F[r], Fm[r], f_grid);
   }
 }
 
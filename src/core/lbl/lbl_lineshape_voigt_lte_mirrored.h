@@ -201,6 +201,32 @@ struct band_shape {
 
   void operator()(ComplexVectorView cut) const;
 
+  /** Sets the shape of all lines for all frequencies
+   *
+   * Works one line at a time over the whole frequency grid, so that
+   * the Faddeeva function is evaluated in batches.
+   *
+   * @param shape The line shape, same size as f_grid
+   * @param F Scratch space for the Faddeeva function, same size as f_grid
+   * @param Fm Scratch space for the mirrored Faddeeva function, same size as f_grid
+   * @param f_grid The frequency grid
+   */
+  void sum(ComplexVectorView shape, ComplexVectorView F, ComplexVectorView Fm, const ConstVectorView& f_grid) const;
+
+  /** As sum(shape, F, Fm, f_grid) but with the cutoff applied
+   *
+   * @param shape The line shape, same size as f_grid
+   * @param F Scratch space for the Faddeeva function, same size as f_grid
+   * @param Fm Scratch space for the mirrored Faddeeva function, same size as f_grid
+   * @param cut The line shape at the cutoff, see operator()(ComplexVectorView)
+   * @param f_grid The frequency grid, must be sorted
+   */
+  void sum(ComplexVectorView             shape,
+           ComplexVectorView             F,
+           ComplexVectorView             Fm,
+           const ConstComplexVectorView& cut,
+           const ConstVectorView&        f_grid) const;
+
   [[nodiscard]] Complex df(const ConstComplexVectorView& cut, const Numeric f) const;
 
   void df(ComplexVectorView cut) const;
@@ -326,13 +352,15 @@ struct ComputeData {
   Vector        dscl{};    //! Size of frequency
   ComplexVector shape{};   //! Size of frequency
   ComplexVector dshape{};  //! Size of frequency
+  ComplexVector F{};       //! Size of frequency
+  ComplexVector Fm{};      //! Size of frequency
 
   Propmat npm{};      //! The orientation of the polarization
   Propmat dnpm_du{};  //! The orientation of the polarization
   Propmat dnpm_dv{};  //! The orientation of the polarization
   Propmat dnpm_dw{};  //! The orientation of the polarization
 
-  //! Sizes scl, dscl, shape, dshape.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
+  //! Sizes scl, dscl, shape, dshape, F, Fm.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
   ComputeData(const ConstVectorView&   f_grid,
               const AtmPoint&          atm,
               const Vector2&           los = {},
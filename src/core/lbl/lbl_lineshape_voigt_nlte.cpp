@@ -18,6 +18,7 @@
 #include <numeric>
 
 #include "lbl_data.h"
+#include "lbl_faddeeva.h"
 #include "lbl_zeeman.h"
 
 namespace lbl::voigt::nlte {
@@ -364,6 +365,36 @@ void band_shape::operator()(CutView cut) const {
       lines.begin(), lines.end(), cut.begin(), [cutoff_freq = cutoff](auto& ls) { return ls(ls.f0 + cutoff_freq); });
 }
 
+void band_shape::sum(CutView shape, ComplexVectorView F, const ConstVectorView& f_grid) const {
+  assert(shape.size() == f_grid.size() and F.size() == f_grid.size());
+
+  shape = std::pair<Complex, Complex>{};
+  for (auto& ls : lines) {
+    faddeeva::w(F, f_grid, ls.f0, ls.inv_gd, ls.z_imag);
+    for (Size j = 0; j < f_grid.size(); j++) {
+      shape[j] = add_pair(shape[j], std::pair<Complex, Complex>{ls.k * F[j], ls.e_ratio * F[j]});
+    }
+  }
+}
+
+void band_shape::sum(CutView shape, ComplexVectorView F, const CutViewConst& cut, const ConstVectorView& f_grid) const {
+  assert(shape.size() == f_grid.size() and F.size() == f_grid.size());
+  assert(static_cast<Size>(cut.size()) == lines.size());
+
+  shape = std::pair<Complex, Complex>{};
+  for (Size i = 0; i < lines.size(); i++) {
+    const auto& ls = lines[i];
+
+    const Range r = faddeeva::frequency_window(f_grid, ls.f0, cutoff);
+    if (r.nelem == 0) continue;
+
+    faddeeva::w(F[r], f_grid[r], ls.f0, ls.inv_gd, ls.z_imag);
+    for (Index j = r.offset; j < r.offset + r.nelem; j++) {
+      shape[j] = add_pair(shape[j], rem_pair(std::pair<Complex, Complex>{ls.k * F[j], ls.e_ratio * F[j]}, cut[i]));
+    }
+  }
+}
+
 std::pair<Complex, Complex> band_shape::df(const CutViewConst& cut, const Numeric f) const {
   const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
   return std::transform_reduce(
@@ -442,7 +473,11 @@ ComputeData::ComputeData(const ConstVectorView&   f_grid,
                          const AtmPoint&          atm,
                          const Vector2&           los,
                          const ZeemanPolarization pol)
-    : scl(f_grid.size()), dscl(f_grid.size()), shape(f_grid.size()), dshape(f_grid.size()) {
+    : scl(f_grid.size()),
+      dscl(f_grid.size()),
+      shape(f_grid.size()),
+      dshape(f_grid.size()),
+      F(f_grid.size()) {
   std::transform(
       f_grid.begin(), f_grid.end(), scl.begin(), [N = number_density(atm.pressure, atm.temperature)](auto f) {
         constexpr Numeric c = Constant::c * Constant::c / (8 * Constant::pi);
@@ -461,11 +496,17 @@ void ComputeData::core_calc(const band_shape& shp, const band_data& bnd, const C
   de_ratio.resize(shp.size());
   dcut.resize(shp.size());
 
+  const Range r{0, f_grid.size()};
+
   if (bnd.cutoff.type != LineByLineCutoffType::None) {
     shp(cut);
-    std::transform(f_grid.begin(), f_grid.end(), shape.begin(), [this, &shp](Numeric f) { return shp(cut, f); });
+    if (stdr::is_sorted(f_grid)) {
+      shp.sum(shape[r], F[r], cut, f_grid);
+    } else {
+      std::transform(f_grid.begin(), f_grid.end(), shape.begin(), [this, &shp](Numeric f) { return shp(cut, f); });
+    }
   } else {
-    std::transform(f_grid.begin(), f_grid.end(), shape.begin(), [&shp](Numeric f) { return shp(f); });
+    shp.sum(shape[r], F[r], f_grid);
   }
 }
 
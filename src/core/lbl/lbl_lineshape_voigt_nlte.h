@@ -105,6 +105,26 @@ struct band_shape {
 
   void operator()(CutView cut) const;
 
+  /** Sets the shape of all lines for all frequencies
+   *
+   * Works one line at a time over the whole frequency grid, so that
+   * the Faddeeva function is evaluated in batches.
+   *
+   * @param shape The line shape, same size as f_grid
+   * @param F Scratch space for the Faddeeva function, same size as f_grid
+   * @param f_grid The frequency grid
+   */
+  void sum(CutView shape, ComplexVectorView F, const ConstVectorView& f_grid) const;
+
+  /** As sum(shape, F, f_grid) but with the cutoff applied
+   *
+   * @param shape The line shape, same size as f_grid
+   * @param F Scratch space for the Faddeeva function, same size as f_grid
+   * @param cut The line shape at the cutoff, see operator()(CutView)
+   * @param f_grid The frequency grid, must be sorted
+   */
+  void sum(CutView shape, ComplexVectorView F, const CutViewConst& cut, const ConstVectorView& f_grid) const;
+
   [[nodiscard]] std::pair<Complex, Complex> df(const CutViewConst& cut, const Numeric f) const;
 
   void df(CutView cut) const;
@@ -156,12 +176,14 @@ struct ComputeData {
   PairDataC shape{};   //! Size of frequency
   PairDataC dshape{};  //! Size of frequency
 
+  ComplexVector F{};  //! Size of frequency
+
   Propmat npm{};      //! The orientation of the polarization
   Propmat dnpm_du{};  //! The orientation of the polarization
   Propmat dnpm_dv{};  //! The orientation of the polarization
   Propmat dnpm_dw{};  //! The orientation of the polarization
 
-  //! Sizes scl, dscl, shape, dshape.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
+  //! Sizes scl, dscl, shape, dshape, F.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
   ComputeData(const ConstVectorView&   f_grid,
               const AtmPoint&          atm,
               const Vector2&           los = {},
@@ -221,7 +221,7 @@ ARTS_METHOD_ERROR_CATCH
 Vector nlte_ratio_sum(const ArrayOfAtmPoint& atm_path, const ArrayOfQuantumLevelIdentifier& levels) try {
   return Vector(std::from_range, atm_path | stdv::transform([&levels](const AtmPoint& atm) {
                                    Numeric s{0.0};
-                                   for (auto& x : levels) s += atm.nlte.at(x);
+                                   for (auto& x : levels) s += atm[x];
                                    return s;
                                  }));
 }
@@ -312,7 +312,7 @@ Numeric set_nlte(AtmPoint& atm_point, const ArrayOfQuantumLevelIdentifier& level
 
   for (Size i = 0; i < level_keys.size(); i++) {
     auto& key  = level_keys[i];
-    auto& v    = atm_point.nlte[key];
+    auto& v    = atm_point[key];
     max_change = std::max(max_change, std::abs(v - x[i]));
     v          = x[i];
   }
@@ -1,6 +1,6 @@
 #include "lbl_voigt.h"
 
-#include <Faddeeva.hh>
+#include "lbl_faddeeva.h"
 
 bool is_voigt(LineByLineLineshape lsm) {
   using enum LineByLineLineshape;
@@ -33,9 +33,11 @@ void compute_voigt(VectorView y, const line& l, const AscendingGrid& f_grid, con
   const Numeric f0    = l.f0 + D0 + DV;
   const Numeric invGD = 1.0 / (std::sqrt(dop * atm.temperature / mass) * f0);
 
-  const Complex z0{-f0 * invGD, G0 * invGD};
   const Complex s{Constant::inv_sqrt_pi * invGD * Complex{1 + G, -Y}};
 
-  stdr::transform(f_grid, y.begin(), [s, z0, invGD](Numeric f) { return std::real(s * Faddeeva::w(f * invGD + z0)); });
+  ComplexVector F(f_grid.size());
+  faddeeva::w(F, f_grid, f0, invGD, G0 * invGD);
+
+  stdr::transform(F, y.begin(), [s](Complex x) { return std::real(s * x); });
 }
 }  // namespace lbl
@@ -0,0 +1,105 @@
+#include <lbl_faddeeva.h>
+#include <matpack.h>
+#include <rng.h>
+
+#include <Faddeeva/Faddeeva.hh>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <print>
+
+namespace {
+struct Result {
+  Numeric max_rel_err{0.0};
+  Numeric scalar_time{0.0};
+  Numeric batch_time{0.0};
+};
+
+Numeric seconds_since(std::chrono::high_resolution_clock::time_point start) {
+  return std::chrono::duration<Numeric>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+//! Compares the batched Faddeeva function to the scalar one for all z
+Result compare(const ConstComplexVectorView& z) {
+  Result res;
+
+  ComplexVector ref(z.size());
+  ComplexVector tst(z.size());
+
+  auto start = std::chrono::high_resolution_clock::now();
+  std::transform(z.begin(), z.end(), ref.begin(), [](Complex x) { return Faddeeva::w(x); });
+  res.scalar_time = seconds_since(start);
+
+  start = std::chrono::high_resolution_clock::now();
+  lbl::faddeeva::w(tst, z);
+  res.batch_time = seconds_since(start);
+
+  for (Size i = 0; i < z.size(); i++) {
+    res.max_rel_err = std::max(res.max_rel_err, std::abs(tst[i] - ref[i]) / std::abs(ref[i]));
+  }
+
+  return res;
+}
+
+//! Arguments as a line shape sees them: a line at 0 with the given widths over the frequency range
+ComplexVector line_arguments(Numeric fmax, Numeric inv_gd, Numeric z_imag, Index n) {
+  const Vector  f = random_numbers<1>({n}, -fmax, fmax);
+  ComplexVector z(n);
+  std::transform(f.begin(), f.end(), z.begin(), [inv_gd, z_imag](Numeric x) { return Complex{inv_gd * x, z_imag}; });
+  return z;
+}
+
+bool report(const std::string_view name, const Result& res) {
+  constexpr Numeric tolerance = 1e-13;
+
+  std::println("{:<32} max rel err: {:.3e}, scalar: {:.3e} s, batched: {:.3e} s, speed-up: {:.2f}",
+               name,
+               res.max_rel_err,
+               res.scalar_time,
+               res.batch_time,
+               res.scalar_time / res.batch_time);
+
+  return res.max_rel_err < tolerance;
+}
+}  // namespace
+
+int main() {
+  constexpr Index N = 2'000'000;
+
+  std::println("Batched Faddeeva kernel uses: {}", lbl::faddeeva::simd_name());
+
+  bool ok = true;
+
+  // Microwave line, pressure broadened: the wings dominate
+  ok = report("pressure broadened (y=10)", compare(line_arguments(1e11, 1e-5, 10, N))) and ok;
+
+  // Doppler dominated: most points are near the line center
+  ok = report("doppler broadened (y=0.01)", compare(line_arguments(1e8, 1e-6, 0.01, N))) and ok;
+
+  // Transition region where the continued fraction needs the most terms
+  ok = report("transition (y=0.5)", compare(line_arguments(20, 1.0, 0.5, N))) and ok;
+
+  // Far wings only
+  ok = report("far wings (|x|>1e4)", compare(line_arguments(1e12, 1e-7, 1e-3, N))) and ok;
+
+  // The line-shape form must agree with the generic form
+  {
+    const Vector f = random_numbers<1>({N}, -1e10, 1e10);
+
+    ComplexVector z(N), a(N), b(N);
+    std::transform(f.begin(), f.end(), z.begin(), [](Numeric x) { return Complex{1e-8 * (x - 1e3), 2.0}; });
+
+    lbl::faddeeva::w(a, z);
+    lbl::faddeeva::w(b, f, 1e3, 1e-8, 2.0);
+
+    for (Index i = 0; i < N; i++) {
+      if (a[i] != b[i]) {
+        std::println("line-shape form differs at {}: {} vs {}", i, a[i], b[i]);
+        ok = false;
+        break;
+      }
+    }
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -239,6 +239,14 @@ Numeric lbl_data_line_hitran_s(const std::vector<lbl::line>& lines) {
   return result;
 }
 
+Numeric lbl_atm_point_number_density(const AtmPoint& atm, Index M) {
+  ARTS_NAMED_TIME_REPORT(std::format("lbl_atm_point_number_density; frozen: {}", atm.is_frozen()));
+
+  Numeric result = 0.0;
+  for (Index i = 0; i < M; ++i) result += atm.number_density(bnd_qid.isot) + atm[bnd_qid.isot.spec];
+  return result;
+}
+
 Numeric lbl_voigt_lte_calculate(
     PropmatVector& pm, PropmatMatrix& dpm, const AbsorptionBand& bnd, const Vector& fs, const AtmPoint& atm) {
   ARTS_NAMED_TIME_REPORT(std::format("lbl_voigt_lte_calculate; threads: {}", arts_omp_get_max_threads()));
@@ -383,6 +391,47 @@ Numeric lbl_voigt_lte_matrix_sumup_inf_cutoff_jac(ComplexMatrixView        a,
 
   return a[0, 0].real();
 }
+
+Numeric lbl_lineshape_model_per_line(const AbsorptionBand& bnd, const AtmPoint& atm) {
+  ARTS_NAMED_TIME_REPORT("lbl_lineshape_model_per_line");
+
+  Numeric result = 0.0;
+  for (auto& line : bnd) {
+    result += line.ls.G0(atm) + line.ls.D0(atm) + line.ls.DV(atm) + line.ls.G(atm) + line.ls.Y(atm);
+  }
+
+  return result;
+}
+
+Numeric lbl_lineshape_model_compile(const AbsorptionBand& bnd) {
+  ARTS_NAMED_TIME_REPORT("lbl_lineshape_model_compile");
+
+  return static_cast<Numeric>(lbl::line_shape::compiled_band{bnd}.size());
+}
+
+Numeric lbl_lineshape_model_cached(const AbsorptionBand& bnd) {
+  ARTS_NAMED_TIME_REPORT("lbl_lineshape_model_cached");
+
+  return static_cast<Numeric>(lbl::line_shape::compiled(bnd)->size());
+}
+
+Numeric lbl_lineshape_model_compiled(const lbl::line_shape::compiled_band& cmp, const AtmPoint& atm) {
+  ARTS_NAMED_TIME_REPORT("lbl_lineshape_model_compiled");
+
+  lbl::line_shape::compiled_band::values v;
+  cmp.evaluate(v, atm, Range(0, cmp.size()));
+
+  Numeric result = 0.0;
+  for (auto var : {LineShapeModelVariable::G0,
+                   LineShapeModelVariable::D0,
+                   LineShapeModelVariable::DV,
+                   LineShapeModelVariable::G,
+                   LineShapeModelVariable::Y}) {
+    result += sum(v[var]);
+  }
+
+  return result;
+}
 }  // namespace
 
 int main() {
@@ -415,6 +464,18 @@ int main() {
     buf += lbl_data_line_hitran_s(lines);
   }
 
+  {
+    constexpr Index M = 10'000'000;
+    AtmPoint        atm;
+    atm.temperature        = 250.0;
+    atm.pressure           = 182.0;
+    atm[bnd_qid.isot.spec] = 0.21;
+
+    buf += lbl_atm_point_number_density(atm, M);
+    atm.freeze();
+    buf += lbl_atm_point_number_density(atm, M);
+  }
+
   {
     AtmPoint             atm;
     constexpr Index      M   = 10'000;
@@ -439,6 +500,23 @@ int main() {
     arts_omp_set_num_threads(cores);
   }
 
+  {
+    constexpr Index      M   = 1'000'000;
+    const AbsorptionBand bnd = {.lines = create_lines(M)};
+    AtmPoint             atm;
+    atm.temperature        = 250.0;
+    atm.pressure           = 182.0;
+    atm[bnd_qid.isot.spec] = 0.21;
+
+    const lbl::line_shape::compiled_band cmp{bnd};
+
+    buf += lbl_lineshape_model_per_line(bnd, atm);
+    buf += lbl_lineshape_model_compile(bnd);
+    buf += static_cast<Numeric>(lbl::line_shape::compiled(bnd)->size());
+    buf += lbl_lineshape_model_cached(bnd);
+    buf += lbl_lineshape_model_compiled(cmp, atm);
+  }
+
   {
     constexpr Index M = 1'000'000;
     AbsorptionBands bands{};
@@ -4,7 +4,11 @@
 #include <jacobian.h>
 #include <lagrange_interp.h>
 
+#include "lookup_mapped.h"
+
 namespace lookup {
+absorption_derivatives::absorption_derivatives(Size n) : t(n, 0.0), p(n, 0.0), w(n, 0.0), vmr(n, 0.0), f(n, 0.0) {}
+
 table::table()                            = default;
 table::table(const table&)                = default;
 table::table(table&&) noexcept            = default;
@@ -29,6 +33,16 @@ Index table::f_size() const { return do_f() ? static_cast<Index>(f_grid->size())
 
 std::array<Index, 4> table::grid_shape() const { return {t_size(), w_size(), p_size(), f_size()}; }
 
+ConstTensor4View table::xsec_data() const { return mapped ? mapped->view() : ConstTensor4View{xsec}; }
+
+std::array<Index, 4> table::xsec_shape() const { return mapped ? mapped->shape() : xsec.shape(); }
+
+void table::materialize() {
+  if (not mapped) return;
+  xsec = Tensor4{mapped->view()};
+  mapped.reset();
+}
+
 table::table(const SpeciesEnum&                   species,
              const ArrayOfAtmPoint&               atmref,
              std::shared_ptr<const AscendingGrid> f_grid_,
@@ -166,7 +180,8 @@ void table::absorption(VectorView           absorption,
                        const Numeric&       extpolfac) const try {
   check();
 
-  if (xsec.empty()) return;
+  const ConstTensor4View xs = xsec_data();
+  if (xs.empty()) return;
 
   // Frequency grid positions
   const auto flag = frequency_lagrange(freq_grid, f_interp_order, extpolfac);
@@ -180,15 +195,15 @@ void table::absorption(VectorView           absorption,
   if (do_w() and do_t()) {
     const auto wlag = water_lagrange(atm_point["H2O"_spec], plag, water_interp_order, extpolfac);
     const auto tlag = temperature_lagrange(atm_point.temperature, plag, t_interp_order, extpolfac);
-    xsec_local      = reinterp(xsec, tlag, wlag, plag, flag).reshape(freq_grid.size());
+    xsec_local      = reinterp(xs, tlag, wlag, plag, flag).reshape(freq_grid.size());
   } else if (do_w()) {
     const auto wlag = water_lagrange(atm_point["H2O"_spec], plag, water_interp_order, extpolfac);
-    xsec_local      = reinterp(xsec[0], wlag, plag, flag).reshape(freq_grid.size());
+    xsec_local      = reinterp(xs[0], wlag, plag, flag).reshape(freq_grid.size());
   } else if (do_t()) {
     const auto tlag = temperature_lagrange(atm_point.temperature, plag, t_interp_order, extpolfac);
-    xsec_local      = reinterp(xsec[joker, 0, joker, joker], tlag, plag, flag).reshape(freq_grid.size());
+    xsec_local      = reinterp(xs[joker, 0, joker, joker], tlag, plag, flag).reshape(freq_grid.size());
   } else {
-    xsec_local = reinterp(xsec[0][0], plag, flag).reshape(freq_grid.size());
+    xsec_local = reinterp(xs[0][0], plag, flag).reshape(freq_grid.size());
   }
 
   const Numeric nd = atm_point.number_density(species);
@@ -196,6 +211,100 @@ void table::absorption(VectorView           absorption,
 }
 ARTS_METHOD_ERROR_CATCH
 
+namespace {
+using lag1 = std::array<lagrange_interp::lag_t<-1>, 1>;
+
+//! A grid that is not in use is a single point: the weight is 1 and its derivative is 0
+lag1 unused_lag(const Numeric weight) {
+  lag1 out;
+  out[0].indx = {0};
+  out[0].data = {weight};
+  return out;
+}
+}  // namespace
+
+void table::absorption(VectorView              absorption,
+                       absorption_derivatives& dabsorption,
+                       const SpeciesEnum&      species,
+                       const Index&            p_interp_order,
+                       const Index&            t_interp_order,
+                       const Index&            water_interp_order,
+                       const Index&            f_interp_order,
+                       const AtmPoint&         atm_point,
+                       const AscendingGrid&    freq_grid,
+                       const Numeric&          extpolfac) const try {
+  using lagrange_interp::derivative;
+
+  check();
+
+  const Size n = freq_grid.size();
+  ARTS_USER_ERROR_IF(dabsorption.t.size() != n or dabsorption.p.size() != n or dabsorption.w.size() != n or
+                         dabsorption.vmr.size() != n or dabsorption.f.size() != n,
+                     "The derivatives must be sized as the frequency grid: {}",
+                     n)
+
+  const ConstTensor4View xs = xsec_data();
+  if (xs.empty()) return;
+
+  // Frequency grid positions
+  const Vector& f_grid_v(*f_grid);
+  const auto    flag = frequency_lagrange(freq_grid, f_interp_order, extpolfac);
+  auto          dflag{flag};
+  for (Size i = 0; i < n; i++) dflag[i] = derivative(flag[i], f_grid_v, freq_grid[i]);
+
+  // Pressure grid positions
+  const Vector& plog_v(*log_p_grid);
+  const auto    plag  = pressure_lagrange(atm_point.pressure, p_interp_order, extpolfac);
+  const lag1    dplag = {derivative(plag[0], plog_v, std::log(atm_point.pressure))};
+
+  // Optional grid positions, and how the reference profiles change with log-pressure
+  lag1    tlag = unused_lag(1.0), dtlag = unused_lag(0.0);
+  Numeric dxt_dlogp = 0.0;
+  if (do_t()) {
+    const Vector& xi(*t_pert);
+    tlag      = temperature_lagrange(atm_point.temperature, plag, t_interp_order, extpolfac);
+    dtlag     = {derivative(tlag[0], xi, atm_point.temperature - interp(t_atmref, plag[0]))};
+    dxt_dlogp = -interp(t_atmref, dplag[0]);
+  }
+
+  lag1    wlag = unused_lag(1.0), dwlag = unused_lag(0.0);
+  Numeric dxw_dlogp = 0.0, dxw_dvmr = 0.0;
+  if (do_w()) {
+    const Vector& xi(*w_pert);
+    const Numeric vmr = atm_point["H2O"_spec];
+    const Numeric ref = interp(water_atmref, plag[0]);
+    wlag              = water_lagrange(vmr, plag, water_interp_order, extpolfac);
+    dwlag             = {derivative(wlag[0], xi, vmr / ref)};
+    dxw_dlogp         = -vmr * interp(water_atmref, dplag[0]) / (ref * ref);
+    dxw_dvmr          = 1.0 / ref;
+  }
+
+  const auto xsec_local = [&xs, n](const lag1& t, const lag1& w, const lag1& p, const auto& f) -> Vector {
+    return reinterp(xs, t, w, p, f).reshape(n);
+  };
+
+  const Vector x     = xsec_local(tlag, wlag, plag, flag);
+  const Vector dx_df = xsec_local(tlag, wlag, plag, dflag);
+  const Vector dx_dp = xsec_local(tlag, wlag, dplag, flag);
+  const Vector dx_dt = do_t() ? xsec_local(dtlag, wlag, plag, flag) : Vector(n, 0.0);
+  const Vector dx_dw = do_w() ? xsec_local(tlag, dwlag, plag, flag) : Vector(n, 0.0);
+
+  const Numeric P      = atm_point.pressure;
+  const Numeric T      = atm_point.temperature;
+  const Numeric nd     = atm_point.number_density(species);
+  const Numeric dnd_dv = species == "AIR"_spec ? 0.0 : atm_point.number_density();
+
+  for (Size i = 0; i < n; ++i) {
+    absorption[i]      += x[i] * nd;
+    dabsorption.t[i]   += (dx_dt[i] - x[i] / T) * nd;
+    dabsorption.p[i]   += (dx_dp[i] + dx_dt[i] * dxt_dlogp + dx_dw[i] * dxw_dlogp + x[i]) * nd / P;
+    dabsorption.w[i]   += dx_dw[i] * dxw_dvmr * nd;
+    dabsorption.vmr[i] += x[i] * dnd_dv;
+    dabsorption.f[i]   += dx_df[i] * nd;
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
 void table::check() const {
   ARTS_USER_ERROR_IF(not do_f() or not do_p(),
                      R"(Must have frequency and pressure grids.
@@ -206,7 +315,7 @@ void table::check() const {
                      do_p());
 
   const auto [t_size, w_size, p_size, f_size] = grid_shape();
-  ARTS_USER_ERROR_IF((xsec.shape() != std::array{t_size, w_size, p_size, f_size}),
+  ARTS_USER_ERROR_IF((xsec_shape() != std::array{t_size, w_size, p_size, f_size}),
                      R"(The shape of the absorption cross section table is incorrect.
 
   Found:    {4:B,},
@@ -221,7 +330,7 @@ void table::check() const {
                      w_size,
                      p_size,
                      f_size,
-                     xsec.shape());
+                     xsec_shape());
 
   ARTS_USER_ERROR_IF(water_atmref.size() != static_cast<Size>(p_size),
                      R"(Bad size of water_atmref
@@ -277,7 +386,11 @@ void xml_io_stream<AbsorptionLookupTable>::write(std::ostream&                os
   xml_write_to_stream(os, x.w_pert, pbofs, "water-pert"sv);
   xml_write_to_stream(os, x.water_atmref, pbofs, "water-ref"sv);
   xml_write_to_stream(os, x.t_atmref, pbofs, "t-ref"sv);
-  xml_write_to_stream(os, x.xsec, pbofs, "xsec");
+  if (x.mapped) {
+    xml_write_to_stream(os, Tensor4{x.xsec_data()}, pbofs, "xsec");
+  } else {
+    xml_write_to_stream(os, x.xsec, pbofs, "xsec");
+  }
 
   tag.write_to_end_stream(os);
 }
@@ -294,6 +407,7 @@ void xml_io_stream<AbsorptionLookupTable>::read(std::istream& is, AbsorptionLook
   xml_read_from_stream(is, x.water_atmref, pbifs);
   xml_read_from_stream(is, x.t_atmref, pbifs);
   xml_read_from_stream(is, x.xsec, pbifs);
+  x.mapped.reset();
 
   tag.read_from_stream(is);
   tag.check_end_name(type_name);
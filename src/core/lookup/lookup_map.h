@@ -10,6 +10,34 @@
 #include <unordered_map>
 
 namespace lookup {
+class mapped_xsec;
+
+/** Partial derivatives of the absorption from a table
+ *
+ * All vectors are on the frequency grid of the call to table::absorption.
+ */
+struct absorption_derivatives {
+  //! With respect to temperature
+  Vector t;
+
+  //! With respect to pressure
+  Vector p;
+
+  //! With respect to the water VMR (via the water perturbation grid)
+  Vector w;
+
+  //! With respect to the VMR of the species of the table (via the number density)
+  Vector vmr;
+
+  //! With respect to frequency
+  Vector f;
+
+  absorption_derivatives() = default;
+
+  //! All derivatives zeroed for a frequency grid of size n
+  explicit absorption_derivatives(Size n);
+};
+
 struct table {
   //! The frequency grid in Hz
   std::shared_ptr<const AscendingGrid> f_grid;
@@ -33,6 +61,9 @@ struct table {
   */
   Tensor4 xsec;
 
+  //! If set, the cross sections are in a mapped file instead of in xsec, which is then empty
+  std::shared_ptr<const mapped_xsec> mapped;
+
   table();
   table(const table&);
   table(table&&) noexcept;
@@ -57,6 +88,26 @@ struct table {
                   const AscendingGrid& freq_grid,
                   const Numeric&       extpolfac) const;
 
+  /** As absorption() but also adds the partial derivatives
+   *
+   * The derivatives are computed from the derivatives of the Lagrange
+   * weights, so the cost is a few extra interpolations of the table,
+   * independent of how many Jacobian targets use them.
+   *
+   * @param[inout] absorption The absorption coefficient, added to
+   * @param[inout] dabsorption The partial derivatives, added to
+   */
+  void absorption(VectorView              absorption,
+                  absorption_derivatives& dabsorption,
+                  const SpeciesEnum&      species,
+                  const Index&            p_interp_order,
+                  const Index&            t_interp_order,
+                  const Index&            water_interp_order,
+                  const Index&            f_interp_order,
+                  const AtmPoint&         atm_point,
+                  const AscendingGrid&    freq_grid,
+                  const Numeric&          extpolfac) const;
+
   [[nodiscard]] bool do_t() const;
   [[nodiscard]] bool do_w() const;
   [[nodiscard]] bool do_p() const;
@@ -70,6 +121,15 @@ struct table {
   [[nodiscard]] std::array<Index, 4> grid_shape() const;
   void                               check() const;
 
+  //! The cross sections, from xsec or from the mapped file (which is mapped on the first call)
+  [[nodiscard]] ConstTensor4View xsec_data() const;
+
+  //! The shape of xsec_data() without mapping the file
+  [[nodiscard]] std::array<Index, 4> xsec_shape() const;
+
+  //! Copies mapped cross sections into xsec and drops the mapping
+  void materialize();
+
   [[nodiscard]] std::array<lagrange_interp::lag_t<-1>, 1> pressure_lagrange(const Numeric& pressure,
                                                                             const Index    interpolation_order,
                                                                             const Numeric& extpolation_factor) const;
@@ -135,7 +195,7 @@ template <> struct std::formatter<AbsorptionLookupTable> {
                        "\nt_atmref: "sv,
                        v.t_atmref,
                        "\nxsec:\n"sv,
-                       v.xsec);
+                       v.xsec_data());
   }
 };
 
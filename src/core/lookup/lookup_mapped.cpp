@@ -0,0 +1,274 @@
+#include "lookup_mapped.h"
+
+#include <debug.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <random>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define ARTS_LOOKUP_MMAP 1
+#else
+#define ARTS_LOOKUP_MMAP 0
+#endif
+
+namespace lookup {
+namespace {
+constexpr std::array<char, 8> file_magic{'A', 'R', 'T', 'S', 'L', 'U', 'T', '\0'};
+constexpr std::uint64_t       file_version    = 1;
+constexpr std::uint64_t       file_byte_order = 0x0102030405060708;
+
+//! Larger than or equal to the page size of all supported systems
+constexpr std::uint64_t page_alignment = 1 << 16;
+
+struct file_header {
+  std::array<char, 8>          magic;
+  std::uint64_t                version;
+  std::uint64_t                byte_order;
+  std::uint64_t                nspecies;
+  std::array<std::uint64_t, 4> reserved;
+};
+static_assert(sizeof(file_header) == 64);
+
+struct file_entry {
+  //! Short name of the species, null-terminated
+  std::array<char, 32> species;
+
+  //! The shape of the cross sections
+  std::array<std::uint64_t, 4> shape;
+
+  //! The sizes of the frequency, log-pressure, temperature and water grids, 0 for no grid
+  std::array<std::uint64_t, 4> grid_sizes;
+
+  //! The grids in the order above, followed by water_atmref and t_atmref
+  std::uint64_t grids_offset;
+
+  //! The cross sections, a multiple of page_alignment
+  std::uint64_t xsec_offset;
+
+  std::array<std::uint64_t, 2> reserved;
+};
+static_assert(sizeof(file_entry) == 128);
+
+//! A new file in the same directory as file, so that it can be renamed over it
+std::filesystem::path temporary_path(const std::filesystem::path& file) {
+  std::random_device rd;
+  return file.parent_path() / std::format(".{}.{:08x}.tmp", file.filename().string(), rd());
+}
+
+std::uint64_t align(const std::uint64_t x) { return (x + page_alignment - 1) / page_alignment * page_alignment; }
+
+std::uint64_t grid_size(const auto& grid) { return grid ? grid->size() : 0; }
+
+void write_numbers(std::ostream& os, const ConstVectorView& x) {
+  for (Numeric v : x) os.write(reinterpret_cast<const char*>(&v), sizeof(Numeric));
+}
+
+void pad_to(std::ostream& os, const std::uint64_t pos) {
+  const auto here = static_cast<std::uint64_t>(os.tellp());
+  ARTS_USER_ERROR_IF(here > pos, "Internal error, the layout of the file is wrong")
+  const std::vector<char> zeros(pos - here, '\0');
+  os.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+}
+
+Vector read_numbers(std::istream& is, const std::uint64_t n) {
+  Vector out(n);
+  is.read(reinterpret_cast<char*>(out.data_handle()), static_cast<std::streamsize>(n * sizeof(Numeric)));
+  return out;
+}
+}  // namespace
+
+mapped_xsec::mapped_xsec(std::filesystem::path p, Size o, std::array<Index, 4> s)
+    : path(std::move(p)), offset(o), shp(s) {}
+
+mapped_xsec::~mapped_xsec() {
+#if ARTS_LOOKUP_MMAP
+  if (addr != nullptr) ::munmap(addr, bytes());
+#endif
+}
+
+Size mapped_xsec::bytes() const {
+  return sizeof(Numeric) * static_cast<Size>(std::reduce(shp.begin(), shp.end(), Index{1}, std::multiplies<>{}));
+}
+
+void mapped_xsec::map() const {
+  const Size n = bytes();
+  if (n == 0) return;
+
+#if ARTS_LOOKUP_MMAP
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  ARTS_USER_ERROR_IF(fd < 0, "Cannot open lookup table file {}: {}", path.string(), std::strerror(errno))
+
+  void*     a   = ::mmap(nullptr, n, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(offset));
+  const int err = errno;
+  ::close(fd);
+  ARTS_USER_ERROR_IF(a == MAP_FAILED, "Cannot map lookup table file {}: {}", path.string(), std::strerror(err))
+
+  addr = a;
+  ptr  = static_cast<const Numeric*>(a);
+#else
+  std::ifstream is(path, std::ios::binary);
+  ARTS_USER_ERROR_IF(not is, "Cannot open lookup table file {}", path.string())
+
+  heap.resize(n / sizeof(Numeric));
+  is.seekg(static_cast<std::streamoff>(offset));
+  is.read(reinterpret_cast<char*>(heap.data()), static_cast<std::streamsize>(n));
+  ARTS_USER_ERROR_IF(not is, "Cannot read lookup table file {}", path.string())
+
+  ptr = heap.data();
+#endif
+}
+
+ConstTensor4View mapped_xsec::view() const {
+  std::call_once(once, [this] { map(); });
+  return ConstTensor4View{matpack::mdview_t<const Numeric, 4>{ptr, shp}};
+}
+
+void save_mapped(const std::filesystem::path& file, const AbsorptionLookupTables& tables) try {
+  std::vector<SpeciesEnum> species;
+  for (auto& [spec, tab] : tables) {
+    tab.check();
+    ARTS_USER_ERROR_IF(toString<1>(spec).size() >= sizeof(file_entry::species), "Species name too long: {}", spec)
+    species.push_back(spec);
+  }
+  stdr::sort(species, {}, [](SpeciesEnum s) { return toString<1>(s); });
+
+  const file_header header{.magic      = file_magic,
+                           .version    = file_version,
+                           .byte_order = file_byte_order,
+                           .nspecies   = species.size(),
+                           .reserved   = {}};
+
+  std::vector<file_entry> entries(species.size());
+
+  // The grids follow the entries, the cross sections follow the grids
+  std::uint64_t pos = sizeof(file_header) + sizeof(file_entry) * entries.size();
+  for (Size i = 0; i < species.size(); i++) {
+    const table& tab = tables.at(species[i]);
+    file_entry&  e   = entries[i];
+
+    e = {};
+    stdr::copy(toString<1>(species[i]), e.species.begin());
+    for (Size j = 0; j < 4; j++) e.shape[j] = static_cast<std::uint64_t>(tab.xsec_shape()[j]);
+    e.grid_sizes   = {grid_size(tab.f_grid), grid_size(tab.log_p_grid), grid_size(tab.t_pert), grid_size(tab.w_pert)};
+    e.grids_offset = pos;
+
+    pos += sizeof(Numeric) * (std::reduce(e.grid_sizes.begin(), e.grid_sizes.end()) + tab.water_atmref.size() +
+                              tab.t_atmref.size());
+  }
+
+  for (auto& e : entries) {
+    const auto n  = std::reduce(e.shape.begin(), e.shape.end(), std::uint64_t{1}, std::multiplies<>{});
+    e.xsec_offset = align(pos);
+    pos           = e.xsec_offset + sizeof(Numeric) * n;
+  }
+
+  // Truncating the file would pull the pages from under any live mapping of
+  // it, so the tables are written next to it and then renamed over it
+  const std::filesystem::path tmp = temporary_path(file);
+  try {
+    std::ofstream os(tmp, std::ios::binary | std::ios::trunc);
+    ARTS_USER_ERROR_IF(not os, "Cannot open {} for writing", tmp.string())
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char*>(entries.data()),
+             static_cast<std::streamsize>(sizeof(file_entry) * entries.size()));
+
+    for (auto& spec : species) {
+      const table& tab = tables.at(spec);
+      if (tab.f_grid) write_numbers(os, *tab.f_grid);
+      if (tab.log_p_grid) write_numbers(os, *tab.log_p_grid);
+      if (tab.t_pert) write_numbers(os, *tab.t_pert);
+      if (tab.w_pert) write_numbers(os, *tab.w_pert);
+      write_numbers(os, tab.water_atmref);
+      write_numbers(os, tab.t_atmref);
+    }
+
+    for (Size i = 0; i < species.size(); i++) {
+      pad_to(os, entries[i].xsec_offset);
+
+      const ConstTensor4View xsec = tables.at(species[i]).xsec_data();
+      if (not xsec.empty()) {
+        os.write(reinterpret_cast<const char*>(xsec.data_handle()),
+                 static_cast<std::streamsize>(sizeof(Numeric) * xsec.size()));
+      }
+    }
+
+    os.close();
+    ARTS_USER_ERROR_IF(not os, "Error writing {}", tmp.string())
+
+    std::filesystem::rename(tmp, file);
+  } catch (...) {
+    std::error_code ec;
+    std::filesystem::remove(tmp, ec);
+    throw;
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
+AbsorptionLookupTables read_mapped(const std::filesystem::path& file) try {
+  std::ifstream is(file, std::ios::binary);
+  ARTS_USER_ERROR_IF(not is, "Cannot open {}", file.string())
+
+  const auto file_size = static_cast<std::uint64_t>(std::filesystem::file_size(file));
+
+  file_header header;
+  is.read(reinterpret_cast<char*>(&header), sizeof(header));
+  ARTS_USER_ERROR_IF(not is or header.magic != file_magic, "{} is not a mapped lookup table file", file.string())
+  ARTS_USER_ERROR_IF(header.version != file_version,
+                     "{} has version {}, only version {} is supported",
+                     file.string(),
+                     header.version,
+                     file_version)
+  ARTS_USER_ERROR_IF(header.byte_order != file_byte_order,
+                     "{} was written on a system with a different byte order",
+                     file.string())
+
+  std::vector<file_entry> entries(header.nspecies);
+  is.read(reinterpret_cast<char*>(entries.data()),
+          static_cast<std::streamsize>(sizeof(file_entry) * entries.size()));
+  ARTS_USER_ERROR_IF(not is, "Cannot read the species entries of {}", file.string())
+
+  AbsorptionLookupTables out;
+  for (auto& e : entries) {
+    ARTS_USER_ERROR_IF(e.species.back() != '\0', "Bad species name in {}", file.string())
+    const auto spec = to<SpeciesEnum>(std::string_view{e.species.data()});
+
+    const auto [nf, np, nt, nw] = e.grid_sizes;
+
+    is.seekg(static_cast<std::streamoff>(e.grids_offset));
+    table tab;
+    tab.f_grid       = std::make_shared<const AscendingGrid>(read_numbers(is, nf));
+    tab.log_p_grid   = std::make_shared<const DescendingGrid>(read_numbers(is, np));
+    tab.t_pert       = nt == 0 ? nullptr : std::make_shared<const AscendingGrid>(read_numbers(is, nt));
+    tab.w_pert       = nw == 0 ? nullptr : std::make_shared<const AscendingGrid>(read_numbers(is, nw));
+    tab.water_atmref = read_numbers(is, np);
+    tab.t_atmref     = read_numbers(is, np);
+    ARTS_USER_ERROR_IF(not is, "Cannot read the grids of species {} in {}", spec, file.string())
+
+    std::array<Index, 4> shape;
+    for (Size j = 0; j < 4; j++) shape[j] = static_cast<Index>(e.shape[j]);
+
+    tab.mapped = std::make_shared<const mapped_xsec>(file, e.xsec_offset, shape);
+    ARTS_USER_ERROR_IF(e.xsec_offset % page_alignment != 0 or e.xsec_offset + tab.mapped->bytes() > file_size,
+                       "The cross sections of species {} are outside of {}",
+                       spec,
+                       file.string())
+
+    tab.check();
+    out[spec] = std::move(tab);
+  }
+
+  return out;
+}
+ARTS_METHOD_ERROR_CATCH
+}  // namespace lookup
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <matpack.h>
+
+#include <array>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "lookup_map.h"
+
+namespace lookup {
+/** The cross sections of one table in a mapped lookup table file
+
+  The file region is mapped read-only the first time the data is used.
+  The mapping is backed by the operating system's file cache, so all
+  processes that map the same file share one copy of the data.
+
+  Systems without mmap read the region into memory on first use instead.
+*/
+class mapped_xsec {
+  std::filesystem::path path;
+  Size                  offset;
+  std::array<Index, 4>  shp;
+
+  mutable std::once_flag       once{};
+  mutable const Numeric*       ptr{nullptr};
+  mutable void*                addr{nullptr};
+  mutable std::vector<Numeric> heap{};
+
+  void map() const;
+
+ public:
+  /** Refers to, but does not yet map, the cross sections in a file
+
+    @param path The file
+    @param offset The byte offset of the data in the file, a multiple of the page size
+    @param shape The shape of the table, see table::xsec
+  */
+  mapped_xsec(std::filesystem::path path, Size offset, std::array<Index, 4> shape);
+
+  mapped_xsec(const mapped_xsec&)            = delete;
+  mapped_xsec(mapped_xsec&&)                 = delete;
+  mapped_xsec& operator=(const mapped_xsec&) = delete;
+  mapped_xsec& operator=(mapped_xsec&&)      = delete;
+
+  ~mapped_xsec();
+
+  [[nodiscard]] const std::array<Index, 4>& shape() const { return shp; }
+
+  //! The number of bytes of the data in the file
+  [[nodiscard]] Size bytes() const;
+
+  //! The cross sections, mapping them on the first call
+  [[nodiscard]] ConstTensor4View view() const;
+};
+
+/** Saves the tables in the mapped format
+
+  The file starts with a 64-byte header and a 128-byte entry per
+  species, followed by the small grids of all tables.  The cross
+  sections of each species come last, each starting at a 64 KiB
+  boundary so that they can be mapped separately on any page size.
+  All numbers are stored in the native byte order.
+
+  @param file The file to write
+  @param tables The tables to save
+*/
+void save_mapped(const std::filesystem::path& file, const AbsorptionLookupTables& tables);
+
+/** Reads tables saved by save_mapped
+
+  Only the grids are read.  The cross sections are mapped on first use
+  of each table.
+
+  @param file The file to read
+  @return The tables
+*/
+AbsorptionLookupTables read_mapped(const std::filesystem::path& file);
+}  // namespace lookup
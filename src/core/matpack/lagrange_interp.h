@@ -499,6 +499,60 @@ template <Index N, grid_transformer transform = grid_identity> struct lag_t {
   [[nodiscard]] static constexpr Index size() requires(not runtime) { return N + 1; }
 };
 
+/******************************************************************
+ * Derivatives of the Lagrange weights
+ ******************************************************************/
+
+/*! The derivative of the weights of lag with respect to x
+ *
+ * The returned object keeps the positions of lag, so interpolating with
+ * it instead of lag gives the derivative of the interpolated value.
+ * The derivative is with respect to the transformed coordinate.
+ *
+ * @param lag The Lagrange weights at x
+ * @param xi The grid that lag was computed for
+ * @param x The coordinate that lag was computed for
+ * @return The derivative of the weights
+ */
+template <Index N, grid_transformer transform>
+constexpr lag_t<N, transform> derivative(const lag_t<N, transform>& lag, std::span<const Numeric> xi, Numeric x)
+  requires(not cyclic<transform>)
+{
+  lag_t<N, transform> out = lag;
+
+  const Size M = out.data.size();
+  if (M == 0) return out;
+
+  x = transform::op(x);
+
+  // The last weight makes the sum 1, so its derivative makes the sum 0
+  const Size P = M - 1;
+  for (Size j = 0; j < P; ++j) {
+    const Numeric xj = transform::op(xi[lag.indx[j]]);
+
+    Numeric denom = 1.0;
+    Numeric numer = 0.0;
+    for (Size m = 0; m < M; ++m) {
+      if (m == j) continue;
+
+      denom *= xj - transform::op(xi[lag.indx[m]]);
+
+      Numeric prod = 1.0;
+      for (Size k = 0; k < M; ++k) {
+        if (k != j and k != m) prod *= x - transform::op(xi[lag.indx[k]]);
+      }
+      numer += prod;
+    }
+
+    out.data[j] = numer / denom;
+  }
+
+  out.data[P] = 0.0;
+  for (Size j = 0; j < P; ++j) out.data[P] -= out.data[j];
+
+  return out;
+}
+
 /******************************************************************
  * Common helper functions for linear Lagrange interpolation
  ******************************************************************/
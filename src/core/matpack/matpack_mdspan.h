@@ -4,6 +4,7 @@
 #include "matpack_mdspan_cdata_t.h"
 #include "matpack_mdspan_data_t.h"
 #include "matpack_mdspan_math.h"
+#include "matpack_mdspan_scratch_t.h"
 #include "matpack_mdspan_sort.h"
 #include "matpack_mdspan_strided_view_t.h"
 #include "matpack_mdspan_view_t.h"
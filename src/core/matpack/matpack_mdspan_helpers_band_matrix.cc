@@ -3,6 +3,9 @@
 #include <debug.h>
 #include <time_report.h>
 
+#include <algorithm>
+#include <cmath>
+
 extern "C" void dgbsv_(
     int* N, int* KL, int* KU, int* NRHS, double* AB, int* LDAB, int* IPIV, double* B, int* LDB, int* INFO);
 
@@ -54,4 +57,118 @@ int band_matrix::solve(Vector& bx) {
 
   return info;
 }
+
+batched_band_matrix::batched_band_matrix(Index ku, Index kl, Index n, Index k)
+    : KU(ku), KL(kl), N(n), K(k), AB(N * (2 * KL + KU + 1) * K, 0.0), ipiv(N * K), tmp(K) {}
+
+void batched_band_matrix::set(Index k, const band_matrix& a) {
+  assert(a.KU == KU and a.KL == KL and a.N == N and a.M == N);
+  assert(k < K);
+
+  const Index ldab = 2 * KL + KU + 1;
+  for (Index j = 0; j < N; j++) {
+    for (Index r = 0; r < ldab; r++) AB[(j * ldab + r) * K + k] = a.AB[j, r];
+  }
+}
+
+/* The same algorithm as LAPACK's dgbtf2 and dgbtrs, but with the loops
+   over the matrices innermost.  The fill-in of every matrix is assumed
+   to reach as far as the band allows, so that all matrices use the same
+   loop bounds.  The extra elements are zero and do not change the result. */
+Index batched_band_matrix::solve(MatrixView bx, Index nk) {
+  ARTS_TIME_REPORT
+
+  assert(bx.nrows() == N and bx.ncols() == K);
+  assert(nk <= K);
+
+  const Index KV = KU + KL;
+
+  // The fill-in above the band of the first columns
+  for (Index j = KU + 1; j < std::min(KV, N); j++) {
+    for (Index i = 0; i < j - KU; i++) std::fill_n(lanes(i, j), nk, 0.0);
+  }
+
+  Index info = 0;
+
+  for (Index j = 0; j < N; j++) {
+    if (j + KV < N) {
+      for (Index i = j; i < j + KL; i++) std::fill_n(lanes(i, j + KV), nk, 0.0);
+    }
+
+    const Index km = std::min(KL, N - 1 - j);
+    const Index ju = std::min(j + KV, N - 1);
+
+    for (Index k = 0; k < nk; k++) {
+      Index   p = j;
+      Numeric v = std::abs(lanes(j, j)[k]);
+      for (Index i = j + 1; i <= j + km; i++) {
+        if (const Numeric x = std::abs(lanes(i, j)[k]); x > v) {
+          v = x;
+          p = i;
+        }
+      }
+
+      ipiv[j * K + k] = p;
+
+      if (v == 0.0) {
+        if (info == 0) info = k + 1;
+        tmp[k] = 0.0;
+        continue;
+      }
+
+      if (p != j) {
+        for (Index c = j; c <= ju; c++) std::swap(lanes(j, c)[k], lanes(p, c)[k]);
+      }
+
+      tmp[k] = 1.0 / lanes(j, j)[k];
+    }
+
+    for (Index i = j + 1; i <= j + km; i++) {
+      Numeric* l = lanes(i, j);
+      for (Index k = 0; k < nk; k++) l[k] *= tmp[k];
+    }
+
+    for (Index c = j + 1; c <= ju; c++) {
+      const Numeric* u = lanes(j, c);
+      for (Index i = j + 1; i <= j + km; i++) {
+        const Numeric* l = lanes(i, j);
+        Numeric*       a = lanes(i, c);
+        for (Index k = 0; k < nk; k++) a[k] -= l[k] * u[k];
+      }
+    }
+  }
+
+  if (info != 0) return info;
+
+  // Forward substitution with the row interchanges
+  for (Index j = 0; j < N - 1; j++) {
+    const Index km = std::min(KL, N - 1 - j);
+
+    auto bj = bx[j];
+    for (Index k = 0; k < nk; k++) {
+      if (const Index p = ipiv[j * K + k]; p != j) std::swap(bj[k], bx[p, k]);
+    }
+
+    for (Index i = j + 1; i <= j + km; i++) {
+      const Numeric* l  = lanes(i, j);
+      auto           bi = bx[i];
+      for (Index k = 0; k < nk; k++) bi[k] -= l[k] * bj[k];
+    }
+  }
+
+  // Backward substitution
+  for (Index j = N - 1; j >= 0; j--) {
+    auto           bj = bx[j];
+    const Numeric* d  = lanes(j, j);
+    for (Index k = 0; k < nk; k++) bj[k] /= d[k];
+
+    for (Index i = std::max<Index>(0, j - KV); i < j; i++) {
+      const Numeric* u  = lanes(i, j);
+      auto           bi = bx[i];
+      for (Index k = 0; k < nk; k++) bi[k] -= u[k] * bj[k];
+    }
+  }
+
+  return 0;
+}
 }  // namespace matpack
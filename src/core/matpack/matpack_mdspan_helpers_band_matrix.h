@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "matpack_mdspan_data_t.h"
 
 namespace matpack {
@@ -39,5 +41,47 @@ class band_matrix {
 
   //! Solves the system of equations A * x = b destructively
   int solve(Vector& bx);
+
+  friend class batched_band_matrix;
+};
+
+/** Several square band matrices of the same shape, solved together
+
+  The same element of all matrices is stored contiguously, so the
+  elimination and substitution loops run over the matrices innermost.
+  Each matrix is factorized with its own partial pivoting, as by dgbsv.
+*/
+class batched_band_matrix {
+  Index                KU{0};
+  Index                KL{0};
+  Index                N{0};
+  Index                K{0};
+  std::vector<Numeric> AB{};    // [N, 2 * KL + KU + 1, K]
+  std::vector<Index>   ipiv{};  // [N, K]
+  std::vector<Numeric> tmp{};   // [K]
+
+  //! The K values of element (i, j)
+  [[nodiscard]] Numeric* lanes(Index i, Index j) {
+    return AB.data() + (j * (2 * KL + KU + 1) + KU + KL + i - j) * K;
+  }
+
+ public:
+  batched_band_matrix() = default;
+
+  //! Space for k band matrices of size n x n
+  batched_band_matrix(Index ku, Index kl, Index n, Index k);
+
+  [[nodiscard]] Index batch_size() const { return K; }
+
+  //! Copies the band of a into position k, a must have the same shape
+  void set(Index k, const band_matrix& a);
+
+  /** Solves the systems of equations A_k * x_k = b_k destructively for k < nk
+
+    @param bx The right-hand sides on input, the solutions on output, N x K
+    @param nk The number of matrices to solve for
+    @return 0 on success, otherwise 1 + the position of the first singular matrix
+  */
+  Index solve(MatrixView bx, Index nk);
 };
 }  // namespace matpack
@@ -0,0 +1,92 @@
+#include "matpack_mdspan_scratch_t.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace matpack {
+arena& arena::local() {
+  thread_local arena a;
+  return a;
+}
+
+void arena::add_chunk(Size bytes) {
+  const Size last = chunks.empty() ? 0 : chunks.back().size;
+  const Size size = std::max({bytes, 2 * last, min_chunk_bytes});
+
+  chunks.push_back({.data = std::make_unique_for_overwrite<std::byte[]>(size), .size = size});
+  counters.heap_allocations++;
+  counters.reserved_bytes += size;
+}
+
+void arena::reset() {
+  // Merge the chunks so that the same work fits in one chunk next time
+  if (chunks.size() > 1) {
+    Size total = 0;
+    for (auto& c : chunks) total += c.size;
+
+    chunks.clear();
+    counters.reserved_bytes = 0;
+    add_chunk(total);
+  }
+
+  current = 0;
+  offset  = 0;
+  used    = 0;
+}
+
+void* arena::allocate(Size bytes, Size align) {
+  assert(std::has_single_bit(align) and align <= alignof(std::max_align_t));
+
+  counters.allocations++;
+  live++;
+
+  // Never hand out the same address twice at once
+  bytes = std::max<Size>(bytes, 1);
+
+  while (current < chunks.size()) {
+    const auto base  = reinterpret_cast<std::uintptr_t>(chunks[current].data.get());
+    const Size start = ((base + offset + align - 1) & ~(align - 1)) - base;
+    if (start + bytes <= chunks[current].size) {
+      used                 += start + bytes - offset;
+      offset                = start + bytes;
+      counters.peak_bytes   = std::max(counters.peak_bytes, used);
+      return chunks[current].data.get() + start;
+    }
+
+    current++;
+    offset = 0;
+  }
+
+  add_chunk(bytes);
+  current              = chunks.size() - 1;
+  offset               = bytes;
+  used                += bytes;
+  counters.peak_bytes  = std::max(counters.peak_bytes, used);
+  return chunks[current].data.get();
+}
+
+void arena::deallocate(void* ptr, Size bytes) noexcept {
+  assert(live > 0);
+
+  if (--live == 0) {
+    reset();
+    return;
+  }
+
+  // The most recent buffer is given back directly
+  bytes = std::max<Size>(bytes, 1);
+  if (current < chunks.size() and static_cast<std::byte*>(ptr) + bytes == chunks[current].data.get() + offset) {
+    const Size start  = static_cast<Size>(static_cast<std::byte*>(ptr) - chunks[current].data.get());
+    used             -= offset - start;
+    offset            = start;
+  }
+}
+
+void arena::clear_stats() {
+  counters = {.allocations      = 0,
+              .heap_allocations = 0,
+              .reserved_bytes   = counters.reserved_bytes,
+              .peak_bytes       = used};
+}
+}  // namespace matpack
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <configtypes.h>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "matpack_mdspan_common_sizes.h"
+#include "matpack_mdspan_view_t.h"
+
+namespace matpack {
+//! Counters of an arena, see arena::stats
+struct arena_stats {
+  //! The number of buffers handed out
+  Size allocations{0};
+
+  //! The number of chunks allocated from the heap
+  Size heap_allocations{0};
+
+  //! The bytes currently held in chunks
+  Size reserved_bytes{0};
+
+  //! The most bytes in use at once
+  Size peak_bytes{0};
+};
+
+/** A per-thread monotonic memory pool for short-lived buffers
+
+  Buffers are carved from large chunks by moving an offset.  Releasing the
+  most recent buffer moves the offset back, so scoped buffers are reused
+  in a loop.  Other buffers are only reclaimed when no buffer of the arena
+  is in use anymore.  At that point the arena is also merged to a single
+  chunk, so that the steady state of a repeated calculation allocates
+  nothing from the heap.
+
+  Use local() to get the arena of the calling thread.  Buffers must be
+  released on the thread that allocated them.
+*/
+class arena {
+  struct chunk {
+    std::unique_ptr<std::byte[]> data;
+    Size                         size;
+  };
+
+  std::vector<chunk> chunks{};
+  Size               current{0};
+  Size               offset{0};
+  Size               live{0};
+  Size               used{0};
+  arena_stats        counters{};
+
+  void add_chunk(Size bytes);
+  void reset();
+
+ public:
+  //! The smallest chunk allocated from the heap
+  static constexpr Size min_chunk_bytes = 1 << 20;
+
+  arena()                        = default;
+  arena(const arena&)            = delete;
+  arena(arena&&)                 = delete;
+  arena& operator=(const arena&) = delete;
+  arena& operator=(arena&&)      = delete;
+
+  //! The arena of the calling thread
+  static arena& local();
+
+  /** Gets uninitialized memory from the arena
+
+    @param bytes The size of the buffer
+    @param align The alignment of the buffer, at most alignof(std::max_align_t)
+    @return A pointer to the buffer
+  */
+  [[nodiscard]] void* allocate(Size bytes, Size align);
+
+  /** Returns memory to the arena
+
+    @param ptr A pointer from allocate()
+    @param bytes The size given to allocate()
+  */
+  void deallocate(void* ptr, Size bytes) noexcept;
+
+  //! The counters since the arena was created or the counters were cleared
+  [[nodiscard]] const arena_stats& stats() const { return counters; }
+
+  //! Clears the counters, keeping the reserved and in use bytes
+  void clear_stats();
+};
+
+/** A multidimensional buffer living in the arena of the current thread
+
+  For temporaries that live shorter than the method that creates them.
+  The buffer behaves like a view_t.  It cannot be resized, copied or
+  moved, so it cannot escape the scope it was created in.  Only use it
+  for element types without a destructor and do not share it between
+  threads.
+
+  @tparam T The element type
+  @tparam N The rank of the buffer
+*/
+template <typename T, Size N> class [[nodiscard]] scratch_t {
+  static_assert(not std::is_const_v<T>);
+  static_assert(std::is_trivially_destructible_v<T>);
+  static_assert(alignof(T) <= alignof(std::max_align_t));
+  static_assert(N > 0);
+
+  arena*       owner;
+  Size         n;
+  view_t<T, N> view;
+
+ public:
+  explicit scratch_t(const std::array<Index, N>& sz, const T& x = {})
+      : owner(&arena::local()),
+        n(mdsize<N>(sz)),
+        view(typename view_t<T, N>::base{static_cast<T*>(owner->allocate(n * sizeof(T), alignof(T))), sz}) {
+    std::uninitialized_fill_n(view.data_handle(), n, x);
+  }
+
+  template <integral... inds> explicit scratch_t(inds... ind) requires(sizeof...(inds) == N)
+      : scratch_t(std::array{static_cast<Index>(ind)...}) {}
+
+  scratch_t(const scratch_t&)            = delete;
+  scratch_t(scratch_t&&)                 = delete;
+  scratch_t& operator=(const scratch_t&) = delete;
+  scratch_t& operator=(scratch_t&&)      = delete;
+
+  ~scratch_t() {
+    assert(owner == &arena::local());
+    owner->deallocate(view.data_handle(), n * sizeof(T));
+  }
+
+  constexpr operator view_t<T, N>&() { return view; }
+  constexpr operator const view_t<T, N>&() const { return view; }
+  constexpr operator std::span<T>() requires(N == 1) { return {view.data_handle(), n}; }
+  constexpr operator std::span<const T>() const requires(N == 1) { return {view.data_handle(), n}; }
+
+  template <typename U> constexpr scratch_t& operator=(U&& x) {
+    view = std::forward<U>(x);
+    return *this;
+  }
+
+  template <typename Self, Size M> constexpr auto view_as(this Self&& self, const std::array<Index, M>& exts) {
+    return std::forward<Self>(self).view.view_as(exts);
+  }
+
+  template <typename Self, integral... inds> constexpr auto view_as(this Self&& self, inds... exts) {
+    return std::forward<Self>(self).view.view_as(std::forward<inds>(exts)...);
+  }
+
+  template <typename Self, access_operator... Acc>
+  [[nodiscard]] constexpr decltype(auto) operator[](this Self&& self, Acc&&... i) requires(sizeof...(Acc) <= N) {
+    return std::forward<Self>(self).view[std::forward<Acc>(i)...];
+  }
+
+  template <typename U> constexpr scratch_t& operator+=(U&& x) {
+    view += std::forward<U>(x);
+    return *this;
+  }
+
+  template <typename U> constexpr scratch_t& operator-=(U&& x) {
+    view -= std::forward<U>(x);
+    return *this;
+  }
+
+  template <typename U> constexpr scratch_t& operator*=(U&& x) {
+    view *= std::forward<U>(x);
+    return *this;
+  }
+
+  template <typename U> constexpr scratch_t& operator/=(U&& x) {
+    view /= std::forward<U>(x);
+    return *this;
+  }
+
+  template <typename Self> constexpr auto shape(this Self&& self) { return std::forward<Self>(self).view.shape(); }
+
+  template <typename Self> constexpr auto size(this Self&& self) { return std::forward<Self>(self).view.size(); }
+
+  template <typename Self> constexpr auto empty(this Self&& self) { return std::forward<Self>(self).view.empty(); }
+
+  template <typename Self> constexpr auto extent(this Self&& self, Index i) {
+    return std::forward<Self>(self).view.extent(i);
+  }
+
+  template <typename Self> constexpr auto begin(this Self&& self) { return std::forward<Self>(self).view.begin(); }
+
+  template <typename Self> constexpr auto end(this Self&& self) { return std::forward<Self>(self).view.end(); }
+
+  template <typename Self> constexpr auto data_handle(this Self&& self) {
+    return std::forward<Self>(self).view.data_handle();
+  }
+};
+}  // namespace matpack
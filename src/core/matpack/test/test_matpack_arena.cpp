@@ -0,0 +1,84 @@
+#include <arts_omp.h>
+#include <matpack.h>
+#include <time_report.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <print>
+
+namespace {
+constexpr Size NF    = 1'000;
+constexpr Size NT    = 4;
+constexpr Size NBAND = 1'000;
+constexpr Size NCALL = 20;
+
+/* Mimics the temporaries of one forward call
+
+  Each band needs a complex spectrum and its derivatives, the path needs
+  a small tensor per point.
+*/
+template <template <typename, Size> class buffer> Numeric forward_call(ComplexVectorView out) {
+  Numeric sum = 0;
+  for (Size i = 0; i < NBAND; i++) {
+    buffer<Complex, 1> pm(NF);
+    buffer<Complex, 2> dpm(NT, NF);
+    buffer<Numeric, 3> t(2, NT, 7);
+
+    pm             = Complex{static_cast<Numeric>(i), 1.0};
+    dpm[i % NT]    = Complex{1.0, static_cast<Numeric>(i)};
+    t[0, 0, i % 7] = static_cast<Numeric>(i);
+
+    out += dpm[i % NT];
+    sum += t[0, 0, i % 7] + pm[i % NF].real();
+  }
+  return sum;
+}
+
+template <template <typename, Size> class buffer> Numeric run(const std::string& name) {
+  ARTS_NAMED_TIME_REPORT(name);
+
+  Numeric sum = 0;
+#pragma omp parallel for reduction(+ : sum)
+  for (Size i = 0; i < NCALL * static_cast<Size>(arts_omp_get_max_threads()); i++) {
+    ComplexVector out(NF, 0.0);
+    sum += forward_call<buffer>(out) + out[0].real();
+  }
+  return sum;
+}
+
+//! The arena counters of each thread for one more forward call per thread
+void print_arena_counts() {
+#pragma omp parallel
+  {
+    matpack::arena::local().clear_stats();
+
+    ComplexVector out(NF, 0.0);
+    std::ignore = forward_call<matpack::scratch_t>(out);
+
+    const auto& s = matpack::arena::local().stats();
+#pragma omp critical
+    std::println("Thread {}: {} buffers, {} heap allocations, {} bytes reserved, {} bytes at most in use",
+                 arts_omp_get_thread_num(),
+                 s.allocations,
+                 s.heap_allocations,
+                 s.reserved_bytes,
+                 s.peak_bytes);
+  }
+
+  std::println("data_t: {} heap allocations per forward call", 3 * NBAND);
+}
+}  // namespace
+
+int main() try {
+  Numeric buf{};
+
+  buf += run<matpack::data_t>("data_t temporaries");
+  buf += run<matpack::scratch_t>("scratch_t temporaries");
+  print_arena_counts();
+
+  std::println(std::cerr, "Prevent optimizing away: {}", buf);
+  arts::print_report();
+} catch (std::exception& e) {
+  std::cerr << "Error in main:\n" << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -114,6 +114,69 @@ Numeric sort_tensor(Tensor7View& a) {
   return a.front();
 }
 
+//! K diagonally dominant band matrices of the shape of a DISORT Fourier mode system
+std::vector<matpack::band_matrix> random_band_matrices(Index ku, Index kl, Index n, Index k) {
+  std::vector<matpack::band_matrix> out(k, matpack::band_matrix(ku, kl, n, n));
+
+  for (auto& a : out) {
+    for (Index j = 0; j < n; j++) {
+      const Vector x = random_numbers<1>({static_cast<Size>(a.end_row(j) - a.start_row(j))});
+      for (Index i = a.start_row(j); i < a.end_row(j); i++) a[i, j] = x[i - a.start_row(j)];
+      a[j, j] += static_cast<Numeric>(ku + kl + 1);
+    }
+  }
+
+  return out;
+}
+
+//! The per-frequency path, one LAPACK dgbsv per matrix
+Numeric band_solve_dgbsv(std::vector<matpack::band_matrix>& a, Matrix& bx) {
+  ARTS_NAMED_TIME_REPORT(std::format("band_solve_dgbsv; {} of {}", a.size(), bx.ncols()));
+
+  Vector x(bx.ncols());
+  for (Size k = 0; k < a.size(); k++) {
+    x = bx[k];
+    if (a[k].solve(x) != 0) throw std::runtime_error("Singular band matrix");
+    bx[k] = x;
+  }
+
+  return bx.front();
+}
+
+//! The batched path, including interleaving the matrices as DISORT does
+Numeric band_solve_batched(matpack::batched_band_matrix&            batch,
+                           const std::vector<matpack::band_matrix>& a,
+                           Matrix&                                  bx) {
+  ARTS_NAMED_TIME_REPORT(std::format("band_solve_batched; {} of {}", a.size(), bx.nrows()));
+
+  for (Size k = 0; k < a.size(); k++) batch.set(k, a[k]);
+  if (batch.solve(bx, static_cast<Index>(a.size())) != 0) throw std::runtime_error("Singular band matrix");
+
+  return bx.front();
+}
+
+void band_solve(Numeric& buf, Index nquad, Index nlayers, Index nk) {
+  const Index n  = nquad * nlayers;
+  const Index kb = 3 * nquad - 1;
+
+  const auto a = random_band_matrices(kb, kb, n, nk);
+  const auto b = random_numbers<2>({static_cast<Size>(nk), static_cast<Size>(n)});
+
+  auto   a1 = a;
+  Matrix x1 = b;
+  buf      += band_solve_dgbsv(a1, x1);
+
+  matpack::batched_band_matrix batch(kb, kb, n, nk);
+  Matrix                       x2 = transpose(b);
+  buf                            += band_solve_batched(batch, a, x2);
+
+  Numeric maxdiff = 0;
+  for (Index k = 0; k < nk; k++) {
+    for (Index i = 0; i < n; i++) maxdiff = std::max(maxdiff, std::abs(x1[k, i] - x2[i, k]));
+  }
+  if (maxdiff > 1e-10) throw std::runtime_error(std::format("Batched band solve differs by {}", maxdiff));
+}
+
 Numeric dot_sum(const ConstMatrixView& a) {
   ARTS_NAMED_TIME_REPORT(std::format("dot_sum; {:B,}", a.shape()));
 
@@ -221,6 +284,10 @@ int main() {
     buf += dot_sum(A);
   }
 
+  for (Index nk : {1, 2, 4, 8, 16}) {
+    for (Index nq : {4, 16}) band_solve(buf, nq, 100, nk);
+  }
+
   std::println(std::cerr, "Prevent optimizing away: {}", buf);
   arts::print_report();
 }
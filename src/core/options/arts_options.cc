@@ -695,7 +695,8 @@ Lastly, the unit option of course just retains the current state [W / m :math:`^
   //       .values_and_desc =
   //           {Value{"ascii", "ASCII", "Ascii", "text", "Save as ASCII"},
   //            Value{"zascii", "ZASCII", "Zip", "zip", "Save as zipped ASCII"},
-  //            Value{"binary", "BINARY", "Binary", "bin", "Save as binary data"}},
+  //            Value{"binary", "BINARY", "Binary", "bin", "Save as binary data"},
+  //            Value{"cbinary", "CBINARY", "ChunkedBinary", "cbin", "Save as chunked binary data, deflated in independent blocks"}},
   //   });
 
   opts.emplace_back(EnumeratedOption{
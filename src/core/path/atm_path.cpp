@@ -16,37 +16,28 @@ ArrayOfAtmPoint &atm_path_resize(ArrayOfAtmPoint &atm_path, const ArrayOfPropaga
 }
 
 void forward_atm_path(ArrayOfAtmPoint &atm_path, const ArrayOfPropagationPathPoint &rad_path, const AtmField &atm) {
-  std::string error{};
+  const Size n = rad_path.size();
 
-  atm_path.resize(atm_path.size());
+  atm_path.resize(n);
 
-#pragma omp parallel for
-  for (Size i = 0; i < rad_path.size(); i++) {
+  matpack::scratch_t<Numeric, 2> pos_buf(3, n);
+  VectorView                     alt = pos_buf[0], lat = pos_buf[1], lon = pos_buf[2];
+  for (Size i = 0; i < n; i++) {
     auto &pp = rad_path[i];
-    auto &ap = atm_path[i];
-    try {
-      if (pp.has(PathPositionType::atm)) {
-        ap = atm.at(pp.pos);
-      } else {
-        ap = atm.at(atm.top_of_atmosphere, pp.pos[1], pp.pos[2]);
-      }
-    } catch (const std::exception &e) {
-#pragma omp critical
-      if (error.empty()) {
-        error = std::format(
-            R"(Error extracting atmospheric point from path at index {}:
-pos: {:B,}
-los: {:B,}
-Error message: {})",
-            i,
-            pp.pos,
-            pp.los,
-            e.what());
-      }
-    }
+    alt[i]   = pp.has(PathPositionType::atm) ? pp.pos[0] : atm.top_of_atmosphere;
+    lat[i]   = pp.pos[1];
+    lon[i]   = pp.pos[2];
+  }
+
+  // All points at once, so that batched functional data is evaluated once per path
+  try {
+    atm.at(atm_path, alt, lat, lon);
+  } catch (const std::exception &e) {
+    throw std::runtime_error(
+        std::format("Error extracting atmospheric points from path:\n{}", std::string_view(e.what())));
   }
 
-  ARTS_USER_ERROR_IF(not error.empty(), error);
+  for (auto &ap : atm_path) ap.freeze();
 }
 
 ArrayOfAtmPoint forward_atm_path(const ArrayOfPropagationPathPoint &rad_path, const AtmField &atm) {
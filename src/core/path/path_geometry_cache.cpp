@@ -0,0 +1,56 @@
+#include "path_geometry_cache.h"
+
+#include <mutex>
+
+namespace path {
+namespace {
+std::array<Numeric, 5> observer(const Vector3& pos, const Vector2& los) {
+  return {pos[0], pos[1], pos[2], los[0], los[1]};
+}
+}  // namespace
+
+geometry_cache::geometry_cache(std::vector<std::pair<Size, Size>> ranges) : watched(std::move(ranges)) {}
+
+bool geometry_cache::update(const ConstVectorView& x) {
+  // Nothing if x is too short to be the state vector the cache was made for
+  std::optional<std::vector<Numeric>> now{std::in_place};
+  for (auto [start, size] : watched) {
+    if (start + size > x.size()) {
+      now.reset();
+      break;
+    }
+
+    now->insert(now->end(), x.begin() + start, x.begin() + start + size);
+  }
+
+  std::unique_lock lock(mtx);
+  if (now and state == now) return false;
+
+  paths.clear();
+  state = std::move(now);
+  return true;
+}
+
+std::optional<ArrayOfPropagationPathPoint> geometry_cache::find(const Vector3& pos, const Vector2& los) {
+  std::shared_lock lock(mtx);
+
+  auto it = paths.find(observer(pos, los));
+  if (it == paths.end()) {
+    nmisses.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+  }
+
+  nhits.fetch_add(1, std::memory_order_relaxed);
+  return it->second;
+}
+
+void geometry_cache::insert(const Vector3& pos, const Vector2& los, const ArrayOfPropagationPathPoint& ray_path) {
+  std::unique_lock lock(mtx);
+  paths.insert_or_assign(observer(pos, los), ray_path);
+}
+
+Size geometry_cache::size() const {
+  std::shared_lock lock(mtx);
+  return paths.size();
+}
+}  // namespace path
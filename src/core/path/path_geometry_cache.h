@@ -0,0 +1,68 @@
+#pragma once
+
+#include <matpack.h>
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include "path_point.h"
+
+namespace path {
+/** Observed ray paths for reuse while the geometry is known to stay the same
+
+  The paths are keyed on the observer position and line of sight.  What
+  else they depend on, e.g., the refractive index, is tracked by the owner
+  through a state vector: the cache watches parts of it and forgets all
+  paths when any watched element changes, see update().
+
+  find() and insert() may be called in parallel, update() may not.
+*/
+class geometry_cache {
+  using key = std::array<Numeric, 5>;
+
+  //! Start and size of the watched parts of the state vector
+  std::vector<std::pair<Size, Size>> watched;
+
+  //! The watched elements at the last update()
+  std::optional<std::vector<Numeric>> state;
+
+  mutable std::shared_mutex                  mtx;
+  std::map<key, ArrayOfPropagationPathPoint> paths;
+  std::atomic<Size>                          nhits{0};
+  std::atomic<Size>                          nmisses{0};
+
+ public:
+  /** A cache that watches parts of a state vector
+
+    @param ranges The start and size of each watched part
+  */
+  explicit geometry_cache(std::vector<std::pair<Size, Size>> ranges = {});
+
+  /** Forgets all paths if a watched element of x differs from the last call
+
+    @param x The state vector the next paths are traced for
+    @return Whether the paths were forgotten
+  */
+  bool update(const ConstVectorView& x);
+
+  //! The cached path, or nothing
+  [[nodiscard]] std::optional<ArrayOfPropagationPathPoint> find(const Vector3& pos, const Vector2& los);
+
+  //! Caches a path, replacing any old path with the same key
+  void insert(const Vector3& pos, const Vector2& los, const ArrayOfPropagationPathPoint& ray_path);
+
+  //! The number of paths in the cache
+  [[nodiscard]] Size size() const;
+
+  //! The number of find() calls that found a path
+  [[nodiscard]] Size hits() const { return nhits.load(std::memory_order_relaxed); }
+
+  //! The number of find() calls that found no path
+  [[nodiscard]] Size misses() const { return nmisses.load(std::memory_order_relaxed); }
+};
+}  // namespace path
@@ -0,0 +1,205 @@
+#include "path_refraction.h"
+
+#include <debug.h>
+#include <geodetic.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+namespace path {
+Numeric refractivity::operator()(const AtmField& atm_field, const Vector3& pos) const {
+  if (pos[0] > atm_field.top_of_atmosphere) return 0.0;
+
+  const Numeric p = atm_field[AtmKey::p].at(pos);
+  const Numeric t = atm_field[AtmKey::t].at(pos);
+  const Numeric e = atm_field.contains("H2O"_spec) ? p * atm_field["H2O"_spec].at(pos) : 0.0;
+
+  return k1 * (p - e) / t + k2 * e / t + k3 * e / (t * t);
+}
+
+namespace {
+//! ECEF position and n times the ECEF direction
+using state = std::array<Numeric, 6>;
+
+Numeric surf_altitude(const SurfaceField& surf_field, const Numeric lat, const Numeric lon) {
+  return surf_field.contains(SurfaceKey::h) ? surf_field.single_value(SurfaceKey::h, lat, lon) : 0.0;
+}
+
+Numeric norm3(const Numeric x, const Numeric y, const Numeric z) { return std::sqrt(x * x + y * y + z * z); }
+
+struct ray_equation {
+  const AtmField&     atm_field;
+  const Vector2       ell;
+  const refractivity& refr;
+
+  //! Central difference step for the gradient [m]
+  static constexpr Numeric dx = 1.0;
+
+  [[nodiscard]] Numeric N(const Vector3& ecef) const { return refr(atm_field, ecef2geodetic(ecef, ell)); }
+
+  [[nodiscard]] Numeric n(const Vector3& ecef) const { return 1.0 + 1e-6 * N(ecef); }
+
+  [[nodiscard]] state operator()(const state& y) const {
+    const Vector3 r{y[0], y[1], y[2]};
+    const Numeric nr = n(r);
+
+    state dy;
+    for (Size i = 0; i < 3; i++) {
+      Vector3 rp = r, rm = r;
+      rp[i]      += dx;
+      rm[i]      -= dx;
+
+      dy[i]     = y[3 + i] / nr;
+      dy[3 + i] = 1e-6 * (N(rp) - N(rm)) / (2 * dx);
+    }
+    return dy;
+  }
+};
+
+struct step_result {
+  state y;
+  state err;
+  state k7;
+};
+
+//! One Dormand-Prince 5(4) step, k1 is the derivative at y
+step_result dormand_prince(const ray_equation& f, const state& y, const state& k1, const Numeric h) {
+  const auto at = [&y, h](std::initializer_list<std::pair<Numeric, const state*>> terms) {
+    state out = y;
+    for (auto& [a, k] : terms) {
+      for (Size i = 0; i < 6; i++) out[i] += h * a * (*k)[i];
+    }
+    return out;
+  };
+
+  const state k2 = f(at({{1.0 / 5.0, &k1}}));
+  const state k3 = f(at({{3.0 / 40.0, &k1}, {9.0 / 40.0, &k2}}));
+  const state k4 = f(at({{44.0 / 45.0, &k1}, {-56.0 / 15.0, &k2}, {32.0 / 9.0, &k3}}));
+  const state k5 = f(
+      at({{19372.0 / 6561.0, &k1}, {-25360.0 / 2187.0, &k2}, {64448.0 / 6561.0, &k3}, {-212.0 / 729.0, &k4}}));
+  const state k6 = f(at({{9017.0 / 3168.0, &k1},
+                         {-355.0 / 33.0, &k2},
+                         {46732.0 / 5247.0, &k3},
+                         {49.0 / 176.0, &k4},
+                         {-5103.0 / 18656.0, &k5}}));
+
+  step_result out;
+  out.y  = at({{35.0 / 384.0, &k1},
+               {500.0 / 1113.0, &k3},
+               {125.0 / 192.0, &k4},
+               {-2187.0 / 6784.0, &k5},
+               {11.0 / 84.0, &k6}});
+  out.k7 = f(out.y);
+
+  // Difference between the 5th and the embedded 4th order solutions
+  for (Size i = 0; i < 6; i++) {
+    out.err[i] = h * (71.0 / 57600.0 * k1[i] - 71.0 / 16695.0 * k3[i] + 71.0 / 1920.0 * k4[i] -
+                      17253.0 / 339200.0 * k5[i] + 22.0 / 525.0 * k6[i] - 1.0 / 40.0 * out.k7[i]);
+  }
+
+  return out;
+}
+
+//! The error of a step as a distance, with the direction error taken over the step
+Numeric error_distance(const state& err, const Numeric h) {
+  return std::max(norm3(err[0], err[1], err[2]), h * norm3(err[3], err[4], err[5]));
+}
+}  // namespace
+
+ArrayOfPropagationPathPoint& fill_refractive(ArrayOfPropagationPathPoint& path,
+                                             const AtmField&              atm_field,
+                                             const SurfaceField&          surf_field,
+                                             const refractivity&          refr,
+                                             const Numeric                max_step,
+                                             const Numeric                tolerance,
+                                             const Numeric                surf_search_accuracy) {
+  using enum PathPositionType;
+
+  ARTS_USER_ERROR_IF(max_step <= 0, "Must move forward")
+  ARTS_USER_ERROR_IF(tolerance <= 0, "The tolerance must be positive, is {}", tolerance)
+  ARTS_USER_ERROR_IF(path.size() != 1 or path.front().los_type != unknown,
+                     "Must have a single initialized path point, please call some init() first")
+
+  // The geometric extremes give where the ray enters the atmosphere, if it does
+  set_geometric_extremes(path, atm_field, surf_field, surf_search_accuracy, false);
+  if (path.front().pos_type == space) {
+    if (path.size() == 1) return path;
+    path.resize(2);
+  } else {
+    if (path.front().los_type != atm) return path;
+    path.resize(1);
+  }
+
+  const Vector2      ell = surf_field.ellipsoid;
+  const ray_equation f{.atm_field = atm_field, .ell = ell, .refr = refr};
+
+  const auto [ecef, decef] = geodetic_los2ecef(path.back().pos, mirror(path.back().los), ell);
+  const Numeric n0         = f.n(ecef);
+  path.back().nreal        = n0;
+  path.back().ngroup       = n0;
+
+  state y{ecef[0], ecef[1], ecef[2], n0 * decef[0], n0 * decef[1], n0 * decef[2]};
+  state k1 = f(y);
+
+  const auto where = [&](const state& s) {
+    const Vector3 pos = ecef2geodetic({s[0], s[1], s[2]}, ell);
+    if (pos[0] > atm_field.top_of_atmosphere) return space;
+    if (pos[0] < surf_altitude(surf_field, pos[1], pos[2])) return surface;
+    return atm;
+  };
+
+  const auto point = [&](const state& s, PathPositionType los_type) {
+    const Vector3 r{s[0], s[1], s[2]};
+    const Numeric u         = norm3(s[3], s[4], s[5]);
+    const auto [pos, los]   = ecef2geodetic_los(r, {s[3] / u, s[4] / u, s[5] / u}, ell);
+    const Numeric nr        = f.n(r);
+    return PropagationPathPoint{
+        .pos_type = atm, .los_type = los_type, .pos = pos, .los = mirror(los), .nreal = nr, .ngroup = nr};
+  };
+
+  const Numeric min_step = 1e-3 * std::min(tolerance, max_step);
+
+  Numeric h = max_step;
+  for (;;) {
+    const step_result step = dormand_prince(f, y, k1, h);
+    const Numeric     e    = error_distance(step.err, h) / tolerance;
+
+    if (e > 1.0) {
+      h *= std::max(0.2, 0.9 * std::pow(e, -0.2));
+      ARTS_USER_ERROR_IF(h < min_step,
+                         "Step size underflow at {:B,} while tracing a refractive path",
+                         ecef2geodetic({y[0], y[1], y[2]}, ell))
+      continue;
+    }
+
+    if (const PathPositionType end = where(step.y); end != atm) {
+      // Bisect the step to find where the ray leaves the atmosphere
+      Numeric h0 = 0.0, h1 = h;
+      state   y1 = step.y;
+      while (h1 - h0 > surf_search_accuracy) {
+        const Numeric hm = std::midpoint(h0, h1);
+        const state   ym = dormand_prince(f, y, k1, hm).y;
+        if (where(ym) == atm) {
+          h0 = hm;
+        } else {
+          h1 = hm;
+          y1 = ym;
+        }
+      }
+
+      PropagationPathPoint& last = path.emplace_back(point(y1, end));
+      last.altitude() =
+          end == space ? atm_field.top_of_atmosphere : surf_altitude(surf_field, last.latitude(), last.longitude());
+      return path;
+    }
+
+    y  = step.y;
+    k1 = step.k7;
+    path.push_back(point(y, atm));
+
+    h = std::min(max_step, h * std::min(5.0, 0.9 * std::pow(std::max(e, 1e-10), -0.2)));
+  }
+}
+}  // namespace path
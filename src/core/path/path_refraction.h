@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atm.h>
+#include <matpack.h>
+#include <surf.h>
+
+#include "path_point.h"
+
+namespace path {
+/** The microwave refractivity of moist air
+ *
+ * N = k1 (p - e) / T + k2 e / T + k3 e / T^2, with p the pressure, e the
+ * partial pressure of water vapour, and T the temperature.  The refractive
+ * index is n = 1 + 1e-6 N.  The default coefficients are those of Bevis et al. (1994),
+ * converted to Pa.
+ */
+struct refractivity {
+  Numeric k1{0.776};
+  Numeric k2{0.704};
+  Numeric k3{3739.0};
+
+  //! The refractivity N at a position in the atmosphere, 0 above it
+  [[nodiscard]] Numeric operator()(const AtmField& atm_field, const Vector3& pos) const;
+};
+
+/** Traces a refractive path through the atmosphere
+ *
+ * The ray equation, d(n t)/ds = grad(n), is integrated in ECEF coordinates
+ * using the embedded Dormand-Prince 5(4) Runge-Kutta scheme.  The step length
+ * is adapted so that the estimated local position error of each step is below
+ * the tolerance, but is never longer than max_step.  The gradient of the
+ * refractive index is computed by central differences.
+ *
+ * The path must consist only of an initialized point, see init().  Paths
+ * that start in space are first extended geometrically to the top of the
+ * atmosphere.  The last point is placed at the top of the atmosphere or on the
+ * surface, found by bisection to within surf_search_accuracy.
+ *
+ * @param path The propagation path
+ * @param atm_field The atmospheric field (as the WSV)
+ * @param surf_field The surface field (as the WSV)
+ * @param refr The refractivity model
+ * @param max_step The maximum step size in meters
+ * @param tolerance The allowed local position error of a step in meters
+ * @param surf_search_accuracy The accuracy of the final point in meters
+ * @return The input for piping
+ */
+ArrayOfPropagationPathPoint& fill_refractive(ArrayOfPropagationPathPoint& path,
+                                             const AtmField&              atm_field,
+                                             const SurfaceField&          surf_field,
+                                             const refractivity&          refr,
+                                             const Numeric                max_step,
+                                             const Numeric                tolerance,
+                                             const Numeric                surf_search_accuracy);
+}  // namespace path
@@ -1,5 +1,13 @@
 #include "scattering_habit.h"
 
+#include <arts_omp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
+
 #include "configtypes.h"
 #include "interpolation.h"
 
@@ -180,6 +188,24 @@ ScatteringTroSpectralVector ScatteringHabit::get_bulk_scattering_properties_tro_
                                                                                          const Vector&   f_grid,
                                                                                          const Index     degree
                                                                                          [[maybe_unused]]) const {
+  if (bulk_table and stdr::equal(bulk_table->f_grid, f_grid)) {
+    const auto& moment = std::get<MGDSingleMoment>(psd).moment;
+    if (point.has(moment)) {
+      if (auto res = bulk_table->interpolate(point[AtmKey::t], point[moment])) return *std::move(res);
+    }
+  }
+
+  return integrate_tro_spectral(point, f_grid);
+}
+
+/** Integrate the TRO spectral bulk properties over the particle sizes
+ *
+ * @param point: The AtmPoint for which to calculate the bulk properties.
+ * @param f_grid: The frequencies for which to calculate the bulk scattering properties.
+ * @return The bulk-scattering properties.
+ */
+ScatteringTroSpectralVector ScatteringHabit::integrate_tro_spectral(const AtmPoint& point,
+                                                                    const Vector&   f_grid) const {
   auto   sizes = particle_habit.get_sizes(std::visit([](const auto& psd) { return psd.get_size_parameter(); }, psd));
   Index  n_particles = sizes.size();
   Vector bin_widths  = sizes;
@@ -289,6 +315,165 @@ ScatteringTroSpectralVector ScatteringHabit::get_bulk_scattering_properties_tro_
   return ScatteringTroSpectralVector(phase_matrix_new, extinction_matrix_new, absorption_vector_new);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Bulk properties tables
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+//! As x, but all zeros
+ScatteringTroSpectralVector zeros_like(const ScatteringTroSpectralVector& x) {
+  ScatteringTroSpectralVector out{.phase_matrix      = std::nullopt,
+                                  .extinction_matrix = PropmatVector(x.extinction_matrix.size()),
+                                  .absorption_vector = StokvecVector(x.absorption_vector.size())};
+  if (x.phase_matrix.has_value()) {
+    out.phase_matrix = SpecmatMatrix(x.phase_matrix->nrows(), x.phase_matrix->ncols(), Specmat(0.0));
+  }
+  return out;
+}
+
+//! out += w * x
+void add_scaled(ScatteringTroSpectralVector& out, const Numeric w, const ScatteringTroSpectralVector& x) {
+  if (out.phase_matrix.has_value() and x.phase_matrix.has_value()) {
+    auto&       pm_out = out.phase_matrix.value();
+    const auto& pm     = x.phase_matrix.value();
+    for (Index i = 0; i < pm.nrows(); ++i) {
+      for (Index j = 0; j < pm.ncols(); ++j) pm_out[i, j] += w * pm[i, j];
+    }
+  }
+
+  for (Size i = 0; i < x.extinction_matrix.size(); ++i) {
+    out.extinction_matrix[i] += w * x.extinction_matrix[i];
+    out.absorption_vector[i] += w * x.absorption_vector[i];
+  }
+}
+
+//! The index of the lower grid point of the cell holding v, v must be inside the grid
+Size lower_index(const AscendingGrid& grid, const Numeric v) {
+  const auto it = stdr::upper_bound(grid, v);
+  return std::min<Size>(std::distance(grid.begin(), it), grid.size() - 1) - 1;
+}
+
+bool strictly_increasing(const AscendingGrid& grid) {
+  return stdr::adjacent_find(grid, std::greater_equal<>{}) == grid.end();
+}
+
+Numeric relative_difference(const Numeric a, const Numeric b) {
+  const Numeric denom = std::max(std::abs(a), std::abs(b));
+  return denom > std::numeric_limits<Numeric>::epsilon() ? std::abs(a - b) / denom : 0.0;
+}
+}  // namespace
+
+std::optional<ScatteringTroSpectralVector> BulkPropertiesTable::interpolate(const Numeric t,
+                                                                            const Numeric moment) const {
+  // The PSD treats negative moments as positive
+  const Numeric x = std::abs(moment);
+
+  if (t < t_grid.front() or t > t_grid.back()) return std::nullopt;
+  if (x == 0.0) return zeros_like(data.front());
+  if (x < moment_grid.front() or x > moment_grid.back()) return std::nullopt;
+
+  const Size    it = lower_index(t_grid, t);
+  const Size    im = lower_index(moment_grid, x);
+  const Numeric wt = (t - t_grid[it]) / (t_grid[it + 1] - t_grid[it]);
+  const Numeric wm = std::log(x / moment_grid[im]) / std::log(moment_grid[im + 1] / moment_grid[im]);
+
+  const Size nm = moment_grid.size();
+
+  auto out = zeros_like(data.front());
+  add_scaled(out, x * (1.0 - wt) * (1.0 - wm), data[it * nm + im]);
+  add_scaled(out, x * (1.0 - wt) * wm, data[it * nm + im + 1]);
+  add_scaled(out, x * wt * (1.0 - wm), data[(it + 1) * nm + im]);
+  add_scaled(out, x * wt * wm, data[(it + 1) * nm + im + 1]);
+  return out;
+}
+
+const BulkPropertiesTable& ScatteringHabit::set_bulk_table(const AscendingGrid& t_grid,
+                                                           const AscendingGrid& moment_grid,
+                                                           const Vector&        f_grid) {
+  ARTS_USER_ERROR_IF(not std::holds_alternative<MGDSingleMoment>(psd),
+                     "Bulk property tables are only supported for single-moment modified gamma PSDs")
+  ARTS_USER_ERROR_IF(t_grid.size() < 2 or moment_grid.size() < 2,
+                     "Need at least two temperatures and two moments, got {} and {}",
+                     t_grid.size(),
+                     moment_grid.size())
+  ARTS_USER_ERROR_IF(not strictly_increasing(t_grid) or not strictly_increasing(moment_grid),
+                     "The temperature and moment grids must be strictly increasing")
+  ARTS_USER_ERROR_IF(moment_grid.front() <= 0.0, "The moment grid must be positive, starts at {}", moment_grid.front())
+
+  const auto& moment   = std::get<MGDSingleMoment>(psd).moment;
+  auto        point_at = [&moment](const Numeric t, const Numeric x) {
+    AtmPoint point;
+    point[AtmKey::t] = t;
+    point[moment]    = x;
+    return point;
+  };
+
+  const Size nt = t_grid.size();
+  const Size nm = moment_grid.size();
+
+  auto table         = std::make_shared<BulkPropertiesTable>();
+  table->t_grid      = t_grid;
+  table->moment_grid = moment_grid;
+  table->f_grid      = f_grid;
+  table->data.resize(nt * nm);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  std::string error{};
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size i = 0; i < nt * nm; i++) {
+    try {
+      const Numeric x = moment_grid[i % nm];
+      const auto    v = integrate_tro_spectral(point_at(t_grid[i / nm], x), f_grid);
+
+      table->data[i] = zeros_like(v);
+      add_scaled(table->data[i], 1.0 / x, v);
+    } catch (const std::exception& e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "Error building the bulk property table:\n{}", error)
+
+  table->build_time = std::chrono::duration<Numeric>(std::chrono::steady_clock::now() - start).count();
+
+  // Compare against the full integration where the interpolation is the least accurate
+  std::vector<Numeric> cell_error((nt - 1) * (nm - 1), 0.0);
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size i = 0; i < cell_error.size(); i++) {
+    try {
+      const Size    it = i / (nm - 1);
+      const Size    im = i % (nm - 1);
+      const Numeric t  = 0.5 * (t_grid[it] + t_grid[it + 1]);
+      const Numeric x  = std::sqrt(moment_grid[im] * moment_grid[im + 1]);
+
+      const auto ref = integrate_tro_spectral(point_at(t, x), f_grid);
+      const auto tab = table->interpolate(t, x).value();
+
+      for (Size f_ind = 0; f_ind < ref.extinction_matrix.size(); ++f_ind) {
+        cell_error[i] = std::max({cell_error[i],
+                                  relative_difference(ref.extinction_matrix[f_ind].A(), tab.extinction_matrix[f_ind].A()),
+                                  relative_difference(ref.absorption_vector[f_ind][0], tab.absorption_vector[f_ind][0])});
+      }
+    } catch (const std::exception& e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "Error checking the bulk property table:\n{}", error)
+
+  table->max_rel_error = stdr::max(cell_error);
+
+  bulk_table = std::move(table);
+  return *bulk_table;
+}
+
+void ScatteringHabit::clear_bulk_table() { bulk_table.reset(); }
+
+std::shared_ptr<const BulkPropertiesTable> ScatteringHabit::get_bulk_table() const { return bulk_table; }
+
 }  // namespace scattering
 
 void xml_io_stream<scattering::ScatteringHabit>::write(std::ostream&,
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+#include <vector>
+
 #include "bulk_scattering_properties.h"
 #include "general_tro_spectral.h"
 #include "particle_habit.h"
@@ -9,6 +13,35 @@ namespace scattering {
 
 using PSD = std::variant<MGDSingleMoment, BinnedPSD>;
 
+/*** Precomputed bulk scattering properties of a scattering habit
+ *
+ * The TRO spectral bulk properties per unit PSD moment on a grid of
+ * temperature and moment.  Lookups interpolate linearly in temperature
+ * and in the logarithm of the moment, and scale the result by the moment.
+ */
+struct BulkPropertiesTable {
+  AscendingGrid t_grid;
+  AscendingGrid moment_grid;
+  Vector        f_grid;
+
+  //! Properties per unit moment, moment_grid varies fastest
+  std::vector<ScatteringTroSpectralVector> data;
+
+  //! The wall time in seconds it took to compute the data
+  Numeric build_time{0.0};
+
+  //! The largest relative error in extinction and absorption at the cell centres
+  Numeric max_rel_error{0.0};
+
+  /** Interpolate the table
+   *
+   * @param t The temperature.
+   * @param moment The PSD moment.
+   * @return The bulk properties, or nothing if the point is outside the table.
+   */
+  [[nodiscard]] std::optional<ScatteringTroSpectralVector> interpolate(Numeric t, Numeric moment) const;
+};
+
 /*** A scattering habit
  *
  * A scattering habit combines a particle habit with an additional PSD
@@ -31,6 +64,28 @@ class ScatteringHabit {
                                                                           const Vector& f_grid,
                                                                           const Index   degree [[maybe_unused]]) const;
 
+  /** Precompute the TRO spectral bulk properties
+   *
+   * Later calls to get_bulk_scattering_properties_tro_spectral() with the
+   * same frequency grid look up the table instead of integrating over the
+   * particle sizes, as long as the temperature and the PSD moment are
+   * inside the table.  Only single-moment modified gamma PSDs are supported.
+   *
+   * @param t_grid The temperature grid [K].
+   * @param moment_grid The grid of the PSD moment, must be positive.
+   * @param f_grid The frequency grid of the lookups.
+   * @return The table, with its build time and accuracy.
+   */
+  const BulkPropertiesTable& set_bulk_table(const AscendingGrid& t_grid,
+                                            const AscendingGrid& moment_grid,
+                                            const Vector&        f_grid);
+
+  //! Removes the table so that all bulk properties are integrated again
+  void clear_bulk_table();
+
+  //! The table, or nullptr if there is none
+  [[nodiscard]] std::shared_ptr<const BulkPropertiesTable> get_bulk_table() const;
+
   //  BulkScatteringProperties<Format::TRO, Representation::Gridded>
   //  get_bulk_scattering_properties_tro_spectral(
   //      const AtmPoint&,
@@ -38,9 +93,12 @@ class ScatteringHabit {
   //      Index l) const;
 
  private:
-  ParticleHabit particle_habit;
-  Numeric       mass_size_rel_a, mass_size_rel_b;
-  PSD           psd;
+  ScatteringTroSpectralVector integrate_tro_spectral(const AtmPoint&, const Vector& f_grid) const;
+
+  ParticleHabit                              particle_habit;
+  Numeric                                    mass_size_rel_a, mass_size_rel_b;
+  PSD                                        psd;
+  std::shared_ptr<const BulkPropertiesTable> bulk_table{};
 };
 
 }  // namespace scattering
@@ -5,6 +5,7 @@
 #include <debug.h>
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <ranges>
 #include <set>
@@ -15,11 +16,48 @@ bool SensorKey::operator==(const SensorKey& other) const {
 }
 
 namespace sensor {
-Obsel::Obsel()                            = default;
-Obsel::Obsel(const Obsel&)                = default;
-Obsel::Obsel(Obsel&&) noexcept            = default;
-Obsel& Obsel::operator=(const Obsel&)     = default;
-Obsel& Obsel::operator=(Obsel&&) noexcept = default;
+namespace {
+//! A generation that no element has had before
+std::uint64_t new_generation() {
+  static std::atomic<std::uint64_t> next{0};
+  return next.fetch_add(1, std::memory_order_relaxed);
+}
+}  // namespace
+
+Obsel::Obsel() : gen{new_generation()} {}
+
+Obsel::Obsel(const Obsel& o) : f{o.f}, poslos{o.poslos}, w{o.w}, gen{o.gen}, response{o.response.load()} {}
+
+Obsel::Obsel(Obsel&& o) noexcept
+    : f{std::move(o.f)},
+      poslos{std::move(o.poslos)},
+      w{std::move(o.w)},
+      gen{o.gen},
+      response{o.response.exchange(nullptr)} {
+  o.gen = new_generation();
+}
+
+Obsel& Obsel::operator=(const Obsel& o) {
+  if (this != &o) {
+    f      = o.f;
+    poslos = o.poslos;
+    w      = o.w;
+    gen    = o.gen;
+    response.store(o.response.load());
+  }
+  return *this;
+}
+
+Obsel& Obsel::operator=(Obsel&& o) noexcept {
+  if (this != &o) {
+    f      = std::move(o.f);
+    poslos = std::move(o.poslos);
+    w      = std::move(o.w);
+    gen    = std::exchange(o.gen, new_generation());
+    response.store(o.response.exchange(nullptr));
+  }
+  return *this;
+}
 
 bool SparseStokvec::operator==(const SparseStokvec& other) const {
   return (irow == other.irow) and (icol == other.icol);
@@ -135,7 +173,7 @@ void Obsel::check() const {
 }
 
 Obsel::Obsel(std::shared_ptr<const AscendingGrid> fs, std::shared_ptr<const PosLosVector> pl, SparseStokvecMatrix ws)
-    : f{std::move(fs)}, poslos{std::move(pl)}, w{std::move(ws)} {
+    : f{std::move(fs)}, poslos{std::move(pl)}, w{std::move(ws)}, gen{new_generation()} {
   check();
 }
 
@@ -158,18 +196,21 @@ bool Obsel::same_poslos(const PosLosVector& other) const { return poslos.get() =
 void Obsel::set_f_grid_ptr(std::shared_ptr<const AscendingGrid> n) {
   ARTS_USER_ERROR_IF(not n, "Must exist");
   ARTS_USER_ERROR_IF(n->size() != f->size(), "Mismatching size");
-  f = std::move(n);
+  f   = std::move(n);
+  gen = new_generation();
 }
 
 void Obsel::set_poslos_grid_ptr(std::shared_ptr<const PosLosVector> n) {
   ARTS_USER_ERROR_IF(not n, "Must exist");
   ARTS_USER_ERROR_IF(n->size() != poslos->size(), "Mismatching size");
   poslos = std::move(n);
+  gen    = new_generation();
 }
 
 void Obsel::set_weight_matrix(SparseStokvecMatrix n) {
   ARTS_USER_ERROR_IF(n.shape() != w.shape(), "Mismatching shape");
-  w = std::move(n);
+  w   = std::move(n);
+  gen = new_generation();
 }
 
 void Obsel::normalize(Stokvec pol) {
@@ -191,15 +232,21 @@ void Obsel::normalize(Stokvec pol) {
     e.data.U() *= pol.U();
     e.data.V() *= pol.V();
   }
+
+  gen = new_generation();
+}
+
+std::span<const SparseStokvec> Obsel::poslos_weights(Index ip) const {
+  // w is a sparse sorted matrix of shape poslos->size() x f->size()
+  const SparseStokvec v0{.irow = static_cast<Size>(ip), .icol = static_cast<Size>(0)};
+  const SparseStokvec vn{.irow = static_cast<Size>(ip), .icol = std::numeric_limits<Size>::max()};
+  return {stdr::lower_bound(w, v0), stdr::upper_bound(w, vn)};
 }
 
 Numeric Obsel::sumup(const Stokvec& i, Index ip) const {
   assert(ip < static_cast<Index>(poslos->size()) and ip >= 0);
 
-  // w is a sparse sorted matrix of shape poslos->size() x f->size()
-  const SparseStokvec            v0{.irow = static_cast<Size>(ip), .icol = static_cast<Size>(0)};
-  const SparseStokvec            vn{.irow = static_cast<Size>(ip), .icol = std::numeric_limits<Size>::max()};
-  std::span<const SparseStokvec> span{stdr::lower_bound(w, v0), stdr::upper_bound(w, vn)};
+  const std::span<const SparseStokvec> span = poslos_weights(ip);
 
   Numeric sum = 0.0;
   for (const auto& ws : span) sum += dot(i, ws.data);
@@ -210,10 +257,7 @@ Numeric Obsel::sumup(const StokvecVectorView& i, Index ip) const {
   assert(i.size() == f->size());
   assert(ip < static_cast<Index>(poslos->size()) and ip >= 0);
 
-  // w is a sparse sorted matrix of shape poslos->size() x f->size()
-  const SparseStokvec            v0{.irow = static_cast<Size>(ip), .icol = static_cast<Size>(0)};
-  const SparseStokvec            vn{.irow = static_cast<Size>(ip), .icol = std::numeric_limits<Size>::max()};
-  std::span<const SparseStokvec> span{stdr::lower_bound(w, v0), stdr::upper_bound(w, vn)};
+  const std::span<const SparseStokvec> span = poslos_weights(ip);
 
   Numeric sum = 0.0;
   for (const auto& ws : span) {
@@ -225,10 +269,7 @@ Numeric Obsel::sumup(const StokvecVectorView& i, Index ip) const {
 
 void Obsel::sumup(VectorView out, const StokvecMatrixView& j, Index ip) const {
   // j is a matrix of shape JACS x f->size()
-  // w is a sparse sorted matrix of shape poslos->size() x f->size()
-  const SparseStokvec            v0{.irow = static_cast<Size>(ip), .icol = static_cast<Size>(0)};
-  const SparseStokvec            vn{.irow = static_cast<Size>(ip), .icol = std::numeric_limits<Size>::max()};
-  std::span<const SparseStokvec> span{stdr::lower_bound(w, v0), stdr::upper_bound(w, vn)};
+  const std::span<const SparseStokvec> span = poslos_weights(ip);
 
   for (Index ij = 0; ij < j.nrows(); ij++) {
     auto jac = j[ij];
@@ -475,6 +516,116 @@ void collect_frequency_grids(std::span<SensorObsel> obsels) {
   }
 }
 
+namespace sensor {
+ResponseOperator::ResponseOperator(const std::span<const Obsel>& obsels, const SensorSimulations& simulations) {
+  const Size N = simulations.size();
+  const Size M = obsels.size();
+
+  //! The first simulation of each frequency and poslos grid pair
+  std::map<std::pair<const AscendingGrid*, const PosLosVector*>, Size> first_sim;
+
+  row_gen.resize(M);
+
+  sim_start.resize(N + 1);
+  for (Size i = 0; i < N; i++) {
+    const auto& sim  = simulations[i];
+    sim_start[i + 1] = sim_start[i] + sim.freq_grid.size();
+    if (sim.iposlos == 0) first_sim.try_emplace({&sim.freq_grid, &sim.poslos_grid}, i);
+  }
+
+  row_start.resize(M + 1);
+  for (Size iv = 0; iv < M; iv++) row_start[iv + 1] = row_start[iv] + obsels[iv].weight_matrix().size();
+
+  cols.resize(row_start.back());
+  weights.resize(row_start.back());
+
+  std::string error{};
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size iv = 0; iv < M; iv++) {
+    const Obsel& obsel = obsels[iv];
+
+    const auto it = first_sim.find({&obsel.f_grid(), &obsel.poslos_grid()});
+    if (it == first_sim.end()) {
+#pragma omp critical
+      if (error.empty()) error = std::format("No simulation for the grids of observational element {}", iv);
+      continue;
+    }
+
+    row_gen[iv] = obsel.generation();
+
+    Size k = row_start[iv];
+    for (const auto& w : obsel.weight_matrix()) {
+      cols[k]    = sim_start[it->second + w.irow] + w.icol;
+      weights[k] = w.data;
+      k++;
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+}
+
+Size ResponseOperator::nrows() const { return row_start.size() - 1; }
+
+Size ResponseOperator::ncols() const { return sim_start.back(); }
+
+Size ResponseOperator::size() const { return cols.size(); }
+
+Size ResponseOperator::sim_offset(Size i) const { return sim_start[i]; }
+
+bool ResponseOperator::matches(const std::span<const Obsel>& obsels) const {
+  return stdr::equal(obsels, row_gen, {}, &Obsel::generation);
+}
+
+std::shared_ptr<const ResponseOperator> response_operator(const std::span<const Obsel>& obsels,
+                                                          const SensorSimulations&      simulations) {
+  if (obsels.empty()) return std::make_shared<const ResponseOperator>();
+
+  if (auto op = obsels.front().response.load(); op and op->matches(obsels)) return op;
+
+  auto op = std::make_shared<const ResponseOperator>(obsels, simulations);
+  for (const Obsel& obsel : obsels) obsel.response.store(op);
+  return op;
+}
+
+void ResponseOperator::apply(VectorView y, const StokvecConstVectorView& x) const {
+  ARTS_USER_ERROR_IF(static_cast<Size>(y.size()) != nrows() or static_cast<Size>(x.size()) != ncols(),
+                     "Bad sizes. y.size(): {}, x.size(): {}, operator shape: [{}, {}]",
+                     y.size(),
+                     x.size(),
+                     nrows(),
+                     ncols())
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size iv = 0; iv < nrows(); iv++) {
+    Numeric sum = 0.0;
+    for (Size k = row_start[iv]; k < row_start[iv + 1]; k++) sum += dot(weights[k], x[cols[k]]);
+    y[iv] += sum;
+  }
+}
+
+void ResponseOperator::apply(MatrixView y, const StokvecConstMatrixView& x) const {
+  ARTS_USER_ERROR_IF(static_cast<Size>(y.nrows()) != nrows() or static_cast<Size>(x.nrows()) != ncols() or
+                         y.ncols() != x.ncols(),
+                     "Bad sizes. y.shape(): {:B,}, x.shape(): {:B,}, operator shape: [{}, {}]",
+                     y.shape(),
+                     x.shape(),
+                     nrows(),
+                     ncols())
+
+  const Size J = y.ncols();
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size iv = 0; iv < nrows(); iv++) {
+    auto out = y[iv];
+    for (Size k = row_start[iv]; k < row_start[iv + 1]; k++) {
+      const Stokvec& w  = weights[k];
+      const auto     xr = x[cols[k]];
+      for (Size ij = 0; ij < J; ij++) out[ij] += dot(w, xr[ij]);
+    }
+  }
+}
+}  // namespace sensor
+
 namespace {
 void set_frq(const SensorObsel& v, ArrayOfSensorObsel& sensor, const ConstVectorView x) {
   ARTS_USER_ERROR_IF(
@@ -5,11 +5,16 @@
 #include <rtepack.h>
 #include <xml.h>
 
+#include <atomic>
 #include <boost/container_hash/hash.hpp>
+#include <cstdint>
 #include <memory>
+#include <span>
 
 #include "matpack_mdspan_helpers_grid_t.h"
 
+struct SensorSimulationsCache;
+
 namespace sensor {
 struct PosLos {
   Vector3 pos;
@@ -95,6 +100,8 @@ class SparseStokvecMatrix {
   explicit operator StokvecMatrix() const;
 };
 
+class ResponseOperator;
+
 class Obsel {
   //! Frequency grid, must be ascending
   std::shared_ptr<const AscendingGrid> f{std::shared_ptr<const AscendingGrid>(new AscendingGrid{})};
@@ -105,6 +112,15 @@ class Obsel {
   //! poslos x frequency sparse matrix of Stokvec weights
   SparseStokvecMatrix w{};
 
+  //! Unique to the grids and weights, renewed on every change and kept by copies
+  std::uint64_t gen;
+
+  //! The operator of the last sensor this element was part of, see response_operator()
+  mutable std::atomic<std::shared_ptr<const ResponseOperator>> response{};
+
+  friend std::shared_ptr<const ResponseOperator> response_operator(
+      const std::span<const Obsel>& obsels, const std::vector<SensorSimulationsCache>& simulations);
+
  public:
   Obsel();
   Obsel(const Obsel&);
@@ -142,6 +158,9 @@ class Obsel {
 
   void set_weight_matrix(SparseStokvecMatrix n);
 
+  //! Equal for two elements only if one is an unchanged copy of the other
+  [[nodiscard]] std::uint64_t generation() const { return gen; }
+
   //! Constant indicating that the frequency or poslos is not found in the grid
   constexpr static Index dont_have = -1;
 
@@ -156,6 +175,13 @@ class Obsel {
    */
   void normalize(Stokvec pol = {1., 0., 0., 0.});
 
+  /** The weights of a single position and line of sight
+   *
+   * @param ip The index in the poslos grid
+   * @return The sorted weights of row ip of the weight matrix (may be empty)
+   */
+  [[nodiscard]] std::span<const SparseStokvec> poslos_weights(Index ip) const;
+
   [[nodiscard]] Numeric sumup(const Stokvec& i, Index ip) const;
   [[nodiscard]] Numeric sumup(const StokvecVectorView& i, Index ip) const;
   void                  sumup(VectorView out, const StokvecMatrixView& j, Index ip) const;
@@ -251,6 +277,84 @@ std::vector<const SensorPosLosVector*> unique_poslos_grids(const std::span<const
 
 SensorSimulations collect_simulations(const std::span<const SensorObsel>& obsels);
 
+namespace sensor {
+/** All observational elements as one sparse operator
+ *
+ * Row iv holds the Stokes weights of observational element iv in
+ * compressed sparse row form.  The columns are the frequencies of all
+ * simulations, one simulation after the other in the order given to the
+ * constructor.  Applying the operator to the concatenated spectral
+ * radiances and their Jacobians gives the measurement vector and its
+ * Jacobian.
+ */
+class ResponseOperator {
+  std::vector<Size>    sim_start{0};
+  std::vector<Size>    row_start{0};
+  std::vector<Size>    cols{};
+  std::vector<Stokvec> weights{};
+
+  //! The generation of each element when the operator was assembled
+  std::vector<std::uint64_t> row_gen{};
+
+ public:
+  ResponseOperator() = default;
+
+  /** Assemble the operator
+   *
+   * @param obsels The observational elements, one per row
+   * @param simulations The simulations, as from collect_simulations(obsels), the
+   *        simulations of a frequency and poslos grid pair must be consecutive
+   */
+  ResponseOperator(const std::span<const Obsel>& obsels, const SensorSimulations& simulations);
+
+  //! The number of observational elements
+  [[nodiscard]] Size nrows() const;
+
+  //! The total number of simulated frequencies
+  [[nodiscard]] Size ncols() const;
+
+  //! The number of Stokes weights
+  [[nodiscard]] Size size() const;
+
+  //! The first column of simulation i
+  [[nodiscard]] Size sim_offset(Size i) const;
+
+  /** Whether the operator is the one of obsels
+   *
+   * True if the elements have the same generations as when the operator
+   * was assembled, so the check is one comparison per element.
+   */
+  [[nodiscard]] bool matches(const std::span<const Obsel>& obsels) const;
+
+  /** y += A x
+   *
+   * @param y The measurement vector [nrows()]
+   * @param x The concatenated spectral radiances [ncols()]
+   */
+  void apply(VectorView y, const StokvecConstVectorView& x) const;
+
+  /** Y += A X
+   *
+   * @param y The measurement Jacobian [nrows(), J]
+   * @param x The concatenated spectral radiance Jacobians, transposed [ncols(), J]
+   */
+  void apply(MatrixView y, const StokvecConstMatrixView& x) const;
+};
+
+/** The response operator of obsels, reused while it matches them
+ *
+ * The operator is kept on the elements, so copies of a sensor share it
+ * until their grids or weights change.
+ *
+ * @param obsels The observational elements, one per row
+ * @param simulations As from collect_simulations(obsels)
+ */
+std::shared_ptr<const ResponseOperator> response_operator(const std::span<const Obsel>& obsels,
+                                                          const SensorSimulations&      simulations);
+}  // namespace sensor
+
+using SensorResponseOperator = sensor::ResponseOperator;
+
 template <> struct std::formatter<SensorPosLos> {
   format_tags tags{};
 
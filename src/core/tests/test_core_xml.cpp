@@ -125,6 +125,20 @@ void test_tensor3(const std::string& fn) try {
 }
 ARTS_METHOD_ERROR_CATCH
 
+void test_chunked_tensor3(const std::string& fn) try {
+  // Large enough to span several blocks, with a partial last block
+  Tensor3 x(31, 170, 211);
+  Size    i = 0;
+  for (auto it = x.elem_begin(); it != x.elem_end(); ++it) *it = static_cast<Numeric>(i++ % 1013) * 0.25;
+
+  xml_write_to_file_base(fn + "testcbin.xml", x, FileType::cbinary);
+  Tensor3 x_read;
+  xml_read_from_file_base(fn + "testcbin.xml", x_read);
+  std::println("{} --- {} vs {} elements", xml_io_stream<Tensor3>::type_name, x.size(), x_read.size());
+  if (x != x_read) { throw std::runtime_error("Read from chunked binary XML does not match original."); }
+}
+ARTS_METHOD_ERROR_CATCH
+
 void test_complex_vector(const std::string& fn) try {
   const ComplexVector x{1 + 2i, 2 + 5i, 3 + 5i, 4 + 12i, 5.5 - 32i};
   xml_write_to_file_base(fn + "test.xml", x, FileType::ascii);
@@ -393,6 +407,7 @@ int main() try {
   test_vector("vector");
   test_matrix("matrix");
   test_tensor3("tensor3");
+  test_chunked_tensor3("ctensor3chunk");
   test_complex_vector("cvector");
   test_complex_matrix("cmatrix");
   test_complex_tensor3("ctensor3");
@@ -438,6 +438,33 @@ void test_old() {
   }
 }
 
+//! The derivative weights must reproduce the derivative of a polynomial of the same order
+void test_derivative() {
+  using namespace lagrange_interp;
+
+  const Vector grid{-3.0, -1.5, 0.0, 0.5, 2.0, 4.0, 7.0};
+  const Vector coords{nlinspace(-4, 8, 97)};
+
+  for (Index order = 0; order < 5; ++order) {
+    const auto poly  = [order](Numeric x) { return std::pow(x, order); };
+    const auto dpoly = [order](Numeric x) { return order == 0 ? 0.0 : order * std::pow(x, order - 1); };
+
+    const Vector data(std::from_range, grid | stdv::transform(poly));
+    const auto   lags = make_lags<grid_identity>(grid, coords, order, 1e99);
+
+    for (Size i = 0; i < coords.size(); ++i) {
+      const auto dlag = derivative(lags[i], grid, coords[i]);
+      const auto d    = interp(data, dlag);
+      ARTS_USER_ERROR_IF(nonstd::abs(d - dpoly(coords[i])) > 1e-9 * (1.0 + nonstd::abs(dpoly(coords[i]))),
+                         "Bad derivative of order {} at {}: {} vs {}",
+                         order,
+                         coords[i],
+                         d,
+                         dpoly(coords[i]));
+    }
+  }
+}
+
 template <Size N> void test_variant_lag() {
   for (Size i = 1; i < 10; ++i) {
     Vector     grid = nlinspace(-100, 100, i);
@@ -498,4 +525,6 @@ int main() {
   test_variant_lag<3z>();
   test_variant_lag<4z>();
   test_variant_lag<5z>();
+
+  test_derivative();
 }
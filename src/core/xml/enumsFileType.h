@@ -6,11 +6,12 @@ enum class FileType : unsigned char {
   ascii,
   zascii,
   binary,
+  cbinary,
 };
 
 template <> constexpr bool good_enum<FileType>(FileType x) noexcept {
   const auto v = static_cast<std::size_t>(x);
-  return v < 3;
+  return v < 4;
 }
 
 template <> struct enumdocs<FileType> {
@@ -23,6 +24,7 @@ inline constexpr std::array FileTypeTypes = {
     FileType::ascii,
     FileType::zascii,
     FileType::binary,
+    FileType::cbinary,
 };
 }  // namespace enumtyps
 
@@ -33,6 +35,7 @@ template <> struct enum_str_data<FileType, 0> {
       "ascii"sv,
       "zascii"sv,
       "binary"sv,
+      "cbinary"sv,
   };
 };
 
@@ -41,6 +44,7 @@ template <> struct enum_str_data<FileType, 1> {
       "ASCII"sv,
       "ZASCII"sv,
       "BINARY"sv,
+      "CBINARY"sv,
   };
 };
 
@@ -49,6 +53,7 @@ template <> struct enum_str_data<FileType, 2> {
       "Ascii"sv,
       "Zip"sv,
       "Binary"sv,
+      "ChunkedBinary"sv,
   };
 };
 
@@ -57,6 +62,7 @@ template <> struct enum_str_data<FileType, 3> {
       "text"sv,
       "zip"sv,
       "bin"sv,
+      "cbin"sv,
   };
 };
 
@@ -71,13 +77,13 @@ template <int i = 0> constexpr std::string_view toString(FileType x) requires(i
 template <> constexpr FileType to<FileType>(const std::string_view x) {
   using namespace enumstrs;
   using namespace enumtyps;
-  if (const auto i = stdr::distance(stdr::begin(FileTypeNames<0>), stdr::find(FileTypeNames<0>, x)); i < 3)
+  if (const auto i = stdr::distance(stdr::begin(FileTypeNames<0>), stdr::find(FileTypeNames<0>, x)); i < 4)
     return FileTypeTypes[i];
-  if (const auto i = stdr::distance(stdr::begin(FileTypeNames<1>), stdr::find(FileTypeNames<1>, x)); i < 3)
+  if (const auto i = stdr::distance(stdr::begin(FileTypeNames<1>), stdr::find(FileTypeNames<1>, x)); i < 4)
     return FileTypeTypes[i];
-  if (const auto i = stdr::distance(stdr::begin(FileTypeNames<2>), stdr::find(FileTypeNames<2>, x)); i < 3)
+  if (const auto i = stdr::distance(stdr::begin(FileTypeNames<2>), stdr::find(FileTypeNames<2>, x)); i < 4)
     return FileTypeTypes[i];
-  if (const auto i = stdr::distance(stdr::begin(FileTypeNames<3>), stdr::find(FileTypeNames<3>, x)); i < 3)
+  if (const auto i = stdr::distance(stdr::begin(FileTypeNames<3>), stdr::find(FileTypeNames<3>, x)); i < 4)
     return FileTypeTypes[i];
   throw std::runtime_error(std::format(R"-x-(Bad input "{}"
 
@@ -87,7 +93,7 @@ See https://atmtools.github.io/arts-docs-master/pyarts3.arts.FileType.html for v
 }
 
 namespace enumsize {
-inline constexpr std::size_t FileTypeSize = 3;
+inline constexpr std::size_t FileTypeSize = 4;
 }
 
 std::ostream& operator<<(std::ostream& os, const FileType x);
@@ -618,7 +618,8 @@ void xml_write_header_to_stream(std::ostream& os, FileType ftype) {
   switch (ftype) {
     case FileType::ascii:
     case FileType::zascii: tag.add_attribute("format", "ascii"); break;
-    case FileType::binary: tag.add_attribute("format", "binary"); break;
+    case FileType::binary:
+    case FileType::cbinary: tag.add_attribute("format", "binary"); break;
   }
 
   tag.add_attribute("version", ARTS_XML_VERSION);
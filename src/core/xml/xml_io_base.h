@@ -289,10 +289,15 @@ template <arts_xml_ioable T> void xml_write_to_file_base(const String& filename,
     xml_write_header_to_stream(*ofs, ftype);
     if (ftype == FileType::ascii or ftype == FileType::zascii) {
       xml_io_stream<T>::write(*ofs, type, static_cast<bofstream*>(nullptr), "");
-    } else {
+    } else if (ftype == FileType::binary) {
       String    bfilename = filename + ".bin";
       bofstream bofs(bfilename.c_str());
       xml_io_stream<T>::write(*ofs, type, &bofs, "");
+    } else {
+      String    bfilename = filename + ".bin";
+      bofstream bofs(bfilename.c_str(), chunked_binary::default_block_size);
+      xml_io_stream<T>::write(*ofs, type, &bofs, "");
+      bofs.finish();
     }
 
     xml_write_footer_to_stream(*ofs);
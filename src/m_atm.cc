@@ -1,4 +1,5 @@
 #include <array_algo.h>
+#include <arts_omp.h>
 #include <debug.h>
 #include <enumsHydrostaticPressureOption.h>
 #include <enumsIsoRatioOption.h>
@@ -461,6 +462,59 @@ void atm_fieldIGRF(AtmField &atm_field, const Time &time) {
   atm_field[AtmKey::mag_w] = magw;
 }
 
+void atm_fieldIGRFGridded(AtmField            &atm_field,
+                          const Time          &time,
+                          const AscendingGrid &alt,
+                          const LatGrid       &lat,
+                          const LonGrid       &lon) try {
+  ARTS_TIME_REPORT
+
+  const Atm::IGRF13 igrf{.time = time};
+
+  GeodeticField3 magu{.data_name  = "mag_u",
+                      .data       = Tensor3(alt.size(), lat.size(), lon.size()),
+                      .grid_names = {"alt", "lat", "lon"},
+                      .grids      = {alt, lat, lon}};
+  GeodeticField3 magv{magu};
+  GeodeticField3 magw{magu};
+  magv.data_name = "mag_v";
+  magw.data_name = "mag_w";
+
+  std::string error{};
+
+#pragma omp parallel for if (not arts_omp_in_parallel()) collapse(3)
+  for (Size i = 0; i < alt.size(); ++i) {
+    for (Size j = 0; j < lat.size(); ++j) {
+      for (Size k = 0; k < lon.size(); ++k) {
+        try {
+          const Vector3 mag = igrf.field(alt[i], lat[j], lon[k]);
+          magu[i, j, k]     = mag[0];
+          magv[i, j, k]     = mag[1];
+          magw[i, j, k]     = mag[2];
+        } catch (std::exception &e) {
+#pragma omp critical
+          if (error.empty()) error = e.what();
+        }
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "Error computing the IGRF field: {}", error)
+
+  for (auto &&[key, field] :
+       {std::pair{AtmKey::mag_u, &magu}, std::pair{AtmKey::mag_v, &magv}, std::pair{AtmKey::mag_w, &magw}}) {
+    auto &data   = atm_field[key];
+    data         = std::move(*field);
+    data.alt_upp = InterpolationExtrapolation::Nearest;
+    data.alt_low = InterpolationExtrapolation::Nearest;
+    data.lat_upp = InterpolationExtrapolation::Nearest;
+    data.lat_low = InterpolationExtrapolation::Nearest;
+    data.lon_upp = InterpolationExtrapolation::Nearest;
+    data.lon_low = InterpolationExtrapolation::Nearest;
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
 void atm_fieldSchmidthFieldFromIGRF(AtmField &atm_field, const Time &time) {
   ARTS_TIME_REPORT
 
@@ -1,6 +1,8 @@
 #include <debug.h>
 #include <workspace.h>
 
+#include <limits>
+
 void ReadCatalogData(PredefinedModelData&     abs_predef_data,
                      XsecRecords&             abs_xfit_data,
                      CIARecords&              abs_cia_data,
@@ -10,7 +12,9 @@ void ReadCatalogData(PredefinedModelData&     abs_predef_data,
                      const Index&             ignore_missing) try {
   ARTS_TIME_REPORT
 
-  abs_bandsReadSpeciesSplitCatalog(abs_bands, abs_species, basename + "lines/", ignore_missing);
+  constexpr Numeric inf = std::numeric_limits<Numeric>::infinity();
+
+  abs_bandsReadSpeciesSplitCatalog(abs_bands, abs_species, basename + "lines/", ignore_missing, -inf, inf);
 
   abs_cia_dataReadSpeciesSplitCatalog(abs_cia_data, abs_species, basename + "cia/", ignore_missing);
 
@@ -41,7 +41,7 @@ Target: {}
                        target.type);
 
     if (not target.overlap) {
-      covmat.add_correlation({colrow, colrow, IndexPair{target.target_pos, target.target_pos}, matrix});
+      covmat.add_correlation_inverse({colrow, colrow, IndexPair{target.target_pos, target.target_pos}, inverse});
     }
   }
 }
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <format>
+#include <optional>
 
 ////////////////////////////////////////////////////////////////////////
 // Core Disort
@@ -50,29 +51,67 @@ void disort_spectral_rad_fieldCalc(DisortRadiance&       disort_spectral_rad_fie
 }
 ARTS_METHOD_ERROR_CATCH
 
-void disort_spectral_flux_fieldCalc(DisortFlux& disort_spectral_flux_field, const DisortSettings& disort_settings) try {
+void disort_spectral_flux_fieldCalc(DisortFlux&           disort_spectral_flux_field,
+                                    const DisortSettings& disort_settings,
+                                    const Index&          batch_size) try {
   ARTS_TIME_REPORT
 
+  ARTS_USER_ERROR_IF(batch_size < 1, "batch_size must be positive, got {}", batch_size)
+
   const Index nv = disort_settings.frequency_count();
+  const Index nb = std::min(batch_size, nv);
 
   disort_spectral_flux_field.resize(disort_settings.freq_grid, disort_settings.alt_grid);
 
-  disort::main_data dis = disort_settings.init();
+  if (nv == 0) return;
 
   String error;
 
-#pragma omp parallel for if (not arts_omp_in_parallel()) firstprivate(dis)
-  for (Index iv = 0; iv < nv; iv++) {
-    try {
-      disort_settings.set(dis, iv);
+  // The models are created by each thread rather than copied from a shared one
+#pragma omp parallel if (not arts_omp_in_parallel())
+  {
+    std::optional<disort::main_data> one;
+    std::optional<disort::batch>     dis;
 
-      dis.gridded_flux(disort_spectral_flux_field.up[iv],
-                       disort_spectral_flux_field.down_diffuse[iv],
-                       disort_spectral_flux_field.down_direct[iv]);
+    try {
+      if (nb == 1) {
+        one.emplace(disort_settings.init_flux());
+      } else {
+        dis.emplace(disort_settings.init_flux(), nb);
+      }
     } catch (const std::exception& e) {
 #pragma omp critical
       if (error.empty()) error = e.what();
     }
+
+#pragma omp for
+    for (Index ib = 0; ib < (nv + nb - 1) / nb; ib++) {
+      if (not one and not dis) continue;
+
+      try {
+        const Index iv = ib * nb;
+
+        if (one) {
+          disort_settings.set(*one, iv).gridded_flux(disort_spectral_flux_field.up[iv],
+                                                     disort_spectral_flux_field.down_diffuse[iv],
+                                                     disort_spectral_flux_field.down_direct[iv]);
+          continue;
+        }
+
+        const Index n = std::min(nb, nv - iv);
+
+        disort_settings.set(*dis, iv, n);
+
+        for (Index k = 0; k < n; k++) {
+          (*dis)[k].gridded_flux(disort_spectral_flux_field.up[iv + k],
+                                 disort_spectral_flux_field.down_diffuse[iv + k],
+                                 disort_spectral_flux_field.down_direct[iv + k]);
+        }
+      } catch (const std::exception& e) {
+#pragma omp critical
+        if (error.empty()) error = e.what();
+      }
+    }
   }
 
   ARTS_USER_ERROR_IF(error.size(), "Error occurred in disort:\n{}", error);
@@ -24,12 +24,12 @@
 #include <exception>
 #include <filesystem>
 #include <iterator>
+#include <limits>
 #include <ranges>
 #include <unordered_map>
 
-void abs_bandsSelectFrequencyByLine(AbsorptionBands& abs_bands, const Numeric& fmin, const Numeric& fmax) try {
-  ARTS_TIME_REPORT
-
+namespace {
+void select_frequency_by_line(AbsorptionBands& abs_bands, const Numeric fmin, const Numeric fmax) {
   std::vector<QuantumIdentifier> to_remove;
 
   for (auto& [key, band] : abs_bands) {
@@ -47,6 +47,13 @@ void abs_bandsSelectFrequencyByLine(AbsorptionBands& abs_bands, const Numeric& f
 
   for (const auto& key : to_remove) abs_bands.erase(key);
 }
+}  // namespace
+
+void abs_bandsSelectFrequencyByLine(AbsorptionBands& abs_bands, const Numeric& fmin, const Numeric& fmax) try {
+  ARTS_TIME_REPORT
+
+  select_frequency_by_line(abs_bands, fmin, fmax);
+}
 ARTS_METHOD_ERROR_CATCH
 
 void abs_bandsSelectFrequencyByBand(AbsorptionBands& abs_bands, const Numeric& fmin, const Numeric& fmax) try {
@@ -91,12 +98,16 @@ ARTS_METHOD_ERROR_CATCH
 void abs_bandsReadSpeciesSplitCatalog(AbsorptionBands&         abs_bands,
                                       const ArrayOfSpeciesTag& absorbtion_species,
                                       const String&            basename,
-                                      const Index&             ignore_missing_) try {
+                                      const Index&             ignore_missing_,
+                                      const Numeric&           fmin,
+                                      const Numeric&           fmax) try {
   ARTS_TIME_REPORT
 
   abs_bands.clear();
 
   const bool ignore_missing = static_cast<bool>(ignore_missing_);
+  const bool everything     = fmin == -std::numeric_limits<Numeric>::infinity() and
+                              fmax == std::numeric_limits<Numeric>::infinity();
 
   const String my_base = complete_basename(basename);
 
@@ -122,16 +133,25 @@ void abs_bandsReadSpeciesSplitCatalog(AbsorptionBands&         abs_bands,
   for (std::size_t iisot = 0; iisot < isotopologues.size(); iisot++) {
     try {
       const auto& isot{visot[iisot]};
+      String      indexed{my_base + isot.FullName() + ".lbl"};
       String      filename{my_base + isot.FullName() + ".xml"};
-      if (find_xml_file_existence(filename)) {
-        AbsorptionBands other;
+
+      AbsorptionBands other;
+      if (std::filesystem::is_regular_file(indexed)) {
+        other = lbl::read_indexed(indexed, fmin, fmax);
+      } else if (find_xml_file_existence(filename)) {
         xml_read_from_file(filename, other);
-#pragma omp critical(abs_bandsReadSpeciesSplitCatalogInsert)
-        abs_bands.insert(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
-      } else if (not ignore_missing) {
+        if (not everything) select_frequency_by_line(other, fmin, fmax);
+      } else {
+        if (not ignore_missing) {
 #pragma omp critical(abs_bandsReadSpeciesSplitCatalogFileError)
-        file_errors.push_back(filename);
+          file_errors.push_back(filename);
+        }
+        continue;
       }
+
+#pragma omp critical(abs_bandsReadSpeciesSplitCatalogInsert)
+      abs_bands.insert(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
     } catch (const std::exception& e) {
 #pragma omp critical(abs_bandsReadSpeciesSplitCatalogReadError)
       read_errors.emplace_back(e.what());
@@ -194,6 +214,21 @@ void abs_bandsSaveSplit(const AbsorptionBands& abs_bands, const String& dir) try
 }
 ARTS_METHOD_ERROR_CATCH
 
+void abs_bandsSaveSplitIndexed(const AbsorptionBands& abs_bands, const String& dir) try {
+  ARTS_TIME_REPORT
+
+  const std::filesystem::path p = dir;
+  if (not std::filesystem::exists(p)) std::filesystem::create_directories(p);
+
+  std::unordered_map<SpeciesIsotope, AbsorptionBands> isotopologues_data;
+  for (auto& [key, band] : abs_bands) { isotopologues_data[key.isot][key] = band; }
+
+  for (const auto& [isot, bands] : isotopologues_data) {
+    lbl::save_indexed(p / std::format("{}.lbl", isot), bands);
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
 void abs_bandsSetZeeman(AbsorptionBands&      abs_bands,
                         const SpeciesIsotope& species,
                         const Numeric&        fmin,
@@ -243,20 +278,22 @@ void spectral_propmatAddLines(PropmatVector&              pm,
                    path_point.los,
                    no_negative_absorption);
   } else {
-    const auto  f_ranges = matpack::omp_offset_count(f_grid.size(), n);
+    // Cache-sized tiles taken by the threads as they become free, each only computing the bands that reach it
+    const auto  windows = lbl::band_windows(abs_bands, species);
+    const auto  f_tiles = lbl::frequency_tiles(f_grid, windows, n, lbl::frequency_tile_size(dpm.nrows()));
     std::string error;
-#pragma omp parallel for
-    for (Size i = 0; i < n; i++) {
+#pragma omp parallel for schedule(dynamic, 1)
+    for (Size i = 0; i < f_tiles.size(); i++) {
       try {
         lbl::calculate(pm,
                        sv,
                        dpm,
                        dsv,
                        f_grid,
-                       f_ranges[i],
+                       f_tiles[i],
                        jac_targets,
                        species,
-                       abs_bands,
+                       windows,
                        abs_ecs_data,
                        atm_point,
                        path_point.los,
@@ -1,3 +1,4 @@
+#include <lookup_mapped.h>
 #include <workspace.h>
 
 #include <algorithm>
@@ -10,121 +11,48 @@ void abs_lookup_dataInit(AbsorptionLookupTables& abs_lookup_data) {
 }
 
 namespace {
-template <bool calc>
-std::conditional_t<calc, Vector, void> _spectral_propmatAddLookup(PropmatVector& spectral_propmat [[maybe_unused]],
-                                                                  PropmatMatrix& spectral_propmat_jac [[maybe_unused]],
-                                                                  const AscendingGrid&   freq_grid,
-                                                                  const JacobianTargets& jac_targets [[maybe_unused]],
-                                                                  const SpeciesEnum& spectral_propmat_select_species,
-                                                                  const AbsorptionLookupTables& abs_lookup_data,
-                                                                  const AtmPoint&               atm_point_,
-                                                                  const Index&                  no_negative_absorption,
-                                                                  const Index&                  p_interp_order,
-                                                                  const Index&                  t_interp_order,
-                                                                  const Index&                  water_interp_order,
-                                                                  const Index&                  f_interp_order,
-                                                                  const Numeric&                extpolfac) {
-  if constexpr (calc) {
-    Vector absorption(freq_grid.size(), 0.0);
-
-    if (spectral_propmat_select_species == "Bath"_spec) {
-      for (auto& [spec, data] : abs_lookup_data) {
-        data.absorption(absorption,
-                        spec,
-                        p_interp_order,
-                        t_interp_order,
-                        water_interp_order,
-                        f_interp_order,
-                        atm_point_,
-                        freq_grid,
-                        extpolfac);
-      }
-    } else {
-      abs_lookup_data.at(spectral_propmat_select_species)
-          .absorption(absorption,
-                      spectral_propmat_select_species,
-                      p_interp_order,
-                      t_interp_order,
-                      water_interp_order,
-                      f_interp_order,
-                      atm_point_,
-                      freq_grid,
-                      extpolfac);
+/** The derivative of the absorption with respect to one atmospheric Jacobian target
+ *
+ * Wind shifts the frequency grid, so the wind targets all use the
+ * frequency derivative, in per Hz.  As for all other spectral_propmatAdd
+ * methods, spectral_propmat_jacWindFix converts it to per m/s by the
+ * Doppler factor of the ray path point.  Targets that do not enter the
+ * lookup table interpolation (e.g., the magnetic field) have no derivative.
+ */
+const Vector* lookup_derivative(const Jacobian::AtmTarget&                         target,
+                                const lookup::absorption_derivatives&              dabs,
+                                const std::vector<std::pair<SpeciesEnum, Vector>>& dvmr,
+                                Vector&                                            buffer) {
+  if (is_wind(target)) return &dabs.f;
+
+  if (const auto* key = std::get_if<AtmKey>(&target.type)) {
+    switch (*key) {
+      case AtmKey::t: return &dabs.t;
+      case AtmKey::p: return &dabs.p;
+      default:        return nullptr;
     }
+  }
 
-    return absorption;
-  } else {
-    const Vector absorption = _spectral_propmatAddLookup<not calc>(spectral_propmat,
-                                                                   spectral_propmat_jac,
-                                                                   freq_grid,
-                                                                   jac_targets,
-                                                                   spectral_propmat_select_species,
-                                                                   abs_lookup_data,
-                                                                   atm_point_,
-                                                                   no_negative_absorption,
-                                                                   p_interp_order,
-                                                                   t_interp_order,
-                                                                   water_interp_order,
-                                                                   f_interp_order,
-                                                                   extpolfac);
-
-    for (Size i = 0; i < freq_grid.size(); i++) {
-      if (no_negative_absorption == 0 or absorption[i] > 0.0) { spectral_propmat[i].A() += absorption[i]; }
+  if (const auto* spec = std::get_if<SpeciesEnum>(&target.type)) {
+    bool found = false;
+    buffer     = 0.0;
+
+    if (*spec == "H2O"_spec) {
+      buffer += dabs.w;
+      found   = true;
     }
 
-    if (jac_targets.atm.size()) {
-      Vector d_absorption;
-
-      for (auto& jacobian_target : jac_targets.atm) {
-        ARTS_USER_ERROR_IF(not std::isnormal(jacobian_target.d),
-                           "The target {} is not good, it lacks a perturbation value.",
-                           jacobian_target);
-
-        if (is_wind(jacobian_target)) {
-          const AscendingGrid freq_grid2(
-              freq_grid.begin(), freq_grid.end(), [d = jacobian_target.d](Numeric x) { return x + d; });
-          d_absorption = _spectral_propmatAddLookup<not calc>(spectral_propmat,
-                                                              spectral_propmat_jac,
-                                                              freq_grid2,
-                                                              {},
-                                                              spectral_propmat_select_species,
-                                                              abs_lookup_data,
-                                                              atm_point_,
-                                                              no_negative_absorption,
-                                                              p_interp_order,
-                                                              t_interp_order,
-                                                              water_interp_order,
-                                                              f_interp_order,
-                                                              extpolfac);
-
-        } else {
-          AtmPoint atm_point               = atm_point_;
-          atm_point[jacobian_target.type] += jacobian_target.d;
-
-          d_absorption = _spectral_propmatAddLookup<not calc>(spectral_propmat,
-                                                              spectral_propmat_jac,
-                                                              freq_grid,
-                                                              {},
-                                                              spectral_propmat_select_species,
-                                                              abs_lookup_data,
-                                                              atm_point,
-                                                              no_negative_absorption,
-                                                              p_interp_order,
-                                                              t_interp_order,
-                                                              water_interp_order,
-                                                              f_interp_order,
-                                                              extpolfac);
-        }
-
-        const Numeric d_inv = 1.0 / jacobian_target.d;
-        for (Size i = 0; i < freq_grid.size(); i++) {
-          if (no_negative_absorption == 0 or d_absorption[i] > 0.0) {
-            spectral_propmat_jac[jacobian_target.target_pos, i].A() = (d_absorption[i] - absorption[i]) * d_inv;
-          }
-        }
+    for (auto& [s, d] : dvmr) {
+      if (s == *spec) {
+        buffer += d;
+        found   = true;
       }
     }
+
+    return found ? &buffer : nullptr;
   }
+
+  return nullptr;
 }
 }  // namespace
 
@@ -143,19 +71,62 @@ void spectral_propmatAddLookup(PropmatVector&                spectral_propmat,
                                const Numeric&                extpolfac) try {
   ARTS_TIME_REPORT
 
-  _spectral_propmatAddLookup<false>(spectral_propmat,
-                                    spectral_propmat_jac,
-                                    freq_grid,
-                                    jac_targets,
-                                    spectral_propmat_select_species,
-                                    abs_lookup_data,
-                                    atm_point,
-                                    no_negative_absorption,
-                                    p_interp_order,
-                                    t_interp_order,
-                                    water_interp_order,
-                                    f_interp_order,
-                                    extpolfac);
+  const Size n = freq_grid.size();
+
+  Vector                                      absorption(n, 0.0);
+  lookup::absorption_derivatives              dabs(jac_targets.atm.empty() ? 0 : n);
+  std::vector<std::pair<SpeciesEnum, Vector>> dvmr;
+
+  const auto compute = [&](const SpeciesEnum& spec, const AbsorptionLookupTable& data) {
+    if (jac_targets.atm.empty()) {
+      data.absorption(absorption,
+                      spec,
+                      p_interp_order,
+                      t_interp_order,
+                      water_interp_order,
+                      f_interp_order,
+                      atm_point,
+                      freq_grid,
+                      extpolfac);
+    } else {
+      dabs.vmr = 0.0;
+      data.absorption(absorption,
+                      dabs,
+                      spec,
+                      p_interp_order,
+                      t_interp_order,
+                      water_interp_order,
+                      f_interp_order,
+                      atm_point,
+                      freq_grid,
+                      extpolfac);
+      dvmr.emplace_back(spec, dabs.vmr);
+    }
+  };
+
+  if (spectral_propmat_select_species == "Bath"_spec) {
+    for (auto& [spec, data] : abs_lookup_data) compute(spec, data);
+  } else {
+    compute(spectral_propmat_select_species, abs_lookup_data.at(spectral_propmat_select_species));
+  }
+
+  const auto keep = [no_negative_absorption, &absorption](Size i) {
+    return no_negative_absorption == 0 or absorption[i] > 0.0;
+  };
+
+  for (Size i = 0; i < n; i++) {
+    if (keep(i)) spectral_propmat[i].A() += absorption[i];
+  }
+
+  Vector buffer(dabs.t.size());
+  for (auto& jacobian_target : jac_targets.atm) {
+    const Vector* d = lookup_derivative(jacobian_target, dabs, dvmr, buffer);
+    if (d == nullptr) continue;
+
+    for (Size i = 0; i < n; i++) {
+      if (keep(i)) spectral_propmat_jac[jacobian_target.target_pos, i].A() += (*d)[i];
+    }
+  }
 }
 ARTS_METHOD_ERROR_CATCH
 
@@ -333,3 +304,15 @@ void abs_lookup_dataSimpleWide(AbsorptionLookupTables&   abs_lookup_data,
                               water_affected_species,
                               isoratio_option);
 }
+
+void abs_lookup_dataSaveMapped(const AbsorptionLookupTables& abs_lookup_data, const String& filename) {
+  ARTS_TIME_REPORT
+
+  lookup::save_mapped(filename, abs_lookup_data);
+}
+
+void abs_lookup_dataReadMapped(AbsorptionLookupTables& abs_lookup_data, const String& filename) {
+  ARTS_TIME_REPORT
+
+  abs_lookup_data = lookup::read_mapped(filename);
+}
@@ -21,11 +21,18 @@
 #include <atm.h>
 #include <config.h>
 #include <debug.h>
+#include <fwd_propmat_cache.h>
 #include <jacobian.h>
+#include <path_geometry_cache.h>
 #include <workspace.h>
 
+#include <algorithm>
 #include <cmath>
+#include <memory>
 #include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #ifndef _MSC_VER
 #pragma GCC diagnostic ignored "-Wconversion"
@@ -47,6 +54,49 @@ void measurement_vec_fitFromMeasurement(Vector& yf, const Vector& y) {
   yf = y;
 }
 
+namespace {
+/** The parts of the state vector that the observed ray paths depend on
+
+  The paths always depend on the surface elevation.  They only depend on
+  the atmosphere through the refractive index used by the methods of
+  ray_path_observer_agenda:
+
+  - Geometric methods read the atmospheric grids but not the values.
+  - ray_pathRefractive reads temperature, pressure, and water vapour.
+  - Anything else that reads the atmosphere or executes an agenda may
+    refract through any quantity, e.g., free electrons, so all retrieved
+    atmospheric quantities are watched.
+*/
+std::vector<std::pair<Size, Size>> geometry_state(const Workspace& ws, const JacobianTargets& jac_targets) {
+  std::vector<std::pair<Size, Size>> state;
+  for (auto& t : jac_targets.surf) {
+    if (t.type == SurfaceKey::h) state.emplace_back(t.x_start, t.x_size);
+  }
+
+  if (not ws.contains("ray_path_observer_agenda")) return state;
+
+  bool refractive = false, unknown = false;
+  for (auto& method : ws.get<Agenda>("ray_path_observer_agenda").get_methods()) {
+    const std::string& name = method.get_name();
+    if (name == "ray_pathRefractive") {
+      refractive = true;
+    } else if (not name.contains("Geometric")) {
+      unknown = unknown or stdr::any_of(method.get_ins(), [](const std::string& in) {
+                  return in == "atm_field" or in.ends_with("_agenda");
+                });
+    }
+  }
+
+  for (auto& t : jac_targets.atm) {
+    if (unknown or (refractive and (t.type == AtmKey::t or t.type == AtmKey::p or t.type == "H2O"_spec))) {
+      state.emplace_back(t.x_start, t.x_size);
+    }
+  }
+
+  return state;
+}
+}  // namespace
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void OEM(const Workspace&        ws,
          Vector&                 model_state_vec,
@@ -74,7 +124,8 @@ void OEM(const Workspace&        ws,
          const Numeric&          stop_dx,
          const Vector&           lm_ga_settings,
          const Index&            clear_matrices,
-         const Index&            display_progress) {
+         const Index&            display_progress,
+         const Index&            reuse_species_propmat) {
   ARTS_TIME_REPORT
 
   // Main sizes
@@ -108,6 +159,20 @@ void OEM(const Workspace&        ws,
              clear_matrices,
              display_progress);
 
+  // The agendas see the caches through their workspace, so they live as long as this call
+  Workspace oem_ws{ws};
+  oem_ws.caches.ray_path = std::make_shared<path::geometry_cache>(geometry_state(ws, jac_targets));
+  path::geometry_cache& ray_path_cache = *oem_ws.caches.ray_path;
+
+  if (reuse_species_propmat) {
+    std::unordered_set<SpeciesEnum> vmrs, lines;
+    for (auto& t : jac_targets.atm) {
+      if (auto* spec = std::get_if<SpeciesEnum>(&t.type)) vmrs.insert(*spec);
+    }
+    for (auto& t : jac_targets.line) lines.insert(t.type.band.isot.spec);
+    oem_ws.caches.propmat_species = std::make_shared<fwd::propmat_species_cache>(std::move(vmrs), std::move(lines));
+  }
+
   // Size diagnostic output and init with NaNs
   oem_diagnostics.resize(5);
   oem_diagnostics = NAN;
@@ -129,7 +194,8 @@ void OEM(const Workspace&        ws,
   // If no precomputed value given, we compute yf and jacobian to
   // compute initial cost (and use in the first OEM iteration).
   if (measurement_vec_fit.size() == 0) {
-    inversion_iterate_agendaExecute(ws,
+    ray_path_cache.update(model_state_vec_apriori);
+    inversion_iterate_agendaExecute(oem_ws,
                                     atm_field,
                                     abs_bands,
                                     measurement_sensor,
@@ -197,7 +263,7 @@ void OEM(const Workspace&        ws,
 
     oem::CovarianceMatrix Se(measurement_vec_error_covmat), Sa(model_state_covmat);
     oem::Vector           xa_oem(model_state_vec_apriori), y_oem(measurement_vec), x_oem(model_state_vec);
-    oem::AgendaWrapper    aw(&ws,
+    oem::AgendaWrapper    aw(&oem_ws,
                              (unsigned int)m,
                              (unsigned int)n,
                              measurement_jac,
@@ -322,6 +388,17 @@ void OEM(const Workspace&        ws,
     model_state_vec     = x_oem;
     measurement_vec_fit = aw.get_measurement_vec();
 
+    if (display_progress) {
+      std::cout << "\n   Ray paths reused : " << ray_path_cache.hits() << '\n'
+                << "   Ray paths traced : " << ray_path_cache.misses() << '\n';
+    }
+
+    if (display_progress and oem_ws.caches.propmat_species) {
+      const fwd::propmat_species_cache& propmat_cache = *oem_ws.caches.propmat_species;
+      std::cout << "\n   Species propagation matrices reused   : " << propmat_cache.hits() << '\n'
+                << "   Species propagation matrices computed : " << propmat_cache.misses() << '\n';
+    }
+
     // Shall empty jacobian and dxdy be returned?
     if (clear_matrices) {
       measurement_jac.resize(0, 0);
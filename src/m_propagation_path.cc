@@ -1,6 +1,7 @@
 #include <atm_field.h>
 #include <enumsSurfaceKey.h>
 #include <path_point.h>
+#include <path_refraction.h>
 #include <workspace.h>
 
 #include <algorithm>
@@ -230,6 +231,36 @@ void ray_pathGeometric(ArrayOfPropagationPathPoint& ray_path,
   if (remove_non_atm) ray_pathRemoveNonAtm(ray_path);
 }
 
+void ray_pathRefractive(ArrayOfPropagationPathPoint& ray_path,
+                        const AtmField&              atm_field,
+                        const SurfaceField&          surf_field,
+                        const Numeric&               max_step,
+                        const Vector3&               pos,
+                        const Vector2&               los,
+                        const Numeric&               tolerance,
+                        const Vector3&               refractivity_coefficients,
+                        const Numeric&               surf_search_accuracy,
+                        const Index&                 as_sensor,
+                        const Index&                 remove_non_atm,
+                        const Index&                 fix_updown_azimuth) {
+  ARTS_TIME_REPORT
+
+  ARTS_USER_ERROR_IF(surf_field.bad_ellipsoid(),
+                     "Surface field not properly set up - bad reference ellipsoid: {:B,}",
+                     surf_field.ellipsoid)
+  ARTS_USER_ERROR_IF(not atm_field.contains(AtmKey::p) or not atm_field.contains(AtmKey::t),
+                     "The atmospheric field must contain pressure and temperature")
+
+  const path::refractivity refr{.k1 = refractivity_coefficients[0],
+                                .k2 = refractivity_coefficients[1],
+                                .k3 = refractivity_coefficients[2]};
+
+  ray_pathInit(ray_path, atm_field, surf_field, pos, los, as_sensor);
+  path::fill_refractive(ray_path, atm_field, surf_field, refr, max_step, tolerance, surf_search_accuracy);
+  if (fix_updown_azimuth) ray_pathFixUpdownAzimuth(ray_path);
+  if (remove_non_atm) ray_pathRemoveNonAtm(ray_path);
+}
+
 void ray_pointBackground(PropagationPathPoint& ray_point, const ArrayOfPropagationPathPoint& ray_path) {
   ARTS_TIME_REPORT
 
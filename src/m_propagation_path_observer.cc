@@ -1,5 +1,6 @@
 #include <array_algo.h>
 #include <arts_omp.h>
+#include <path_geometry_cache.h>
 #include <workspace.h>
 
 namespace {
@@ -265,3 +266,25 @@ void ray_path_fieldFromObserverAgenda(const Workspace&                    ws,
 
   if (not error.empty()) throw std::runtime_error(error);
 }
+
+void ray_pathFromObserverAgenda(const Workspace&             ws,
+                                ArrayOfPropagationPathPoint& ray_path,
+                                const Vector3&               obs_pos,
+                                const Vector2&               obs_los,
+                                const Agenda&                ray_path_observer_agenda) try {
+  ARTS_TIME_REPORT
+
+  path::geometry_cache* cache = ws.caches.ray_path.get();
+
+  if (cache) {
+    if (auto cached = cache->find(obs_pos, obs_los)) {
+      ray_path = std::move(*cached);
+      return;
+    }
+  }
+
+  ray_path_observer_agendaExecute(ws, ray_path, obs_pos, obs_los, ray_path_observer_agenda);
+
+  if (cache) cache->insert(obs_pos, obs_los, ray_path);
+}
+ARTS_METHOD_ERROR_CATCH
@@ -1,5 +1,6 @@
 #include <array_algo.h>
 #include <arts_omp.h>
+#include <fwd_propmat_cache.h>
 #include <workspace.h>
 
 void spectral_propmat_pathFromPath(const Workspace                   &ws,
@@ -86,7 +87,8 @@ void spectral_propmat_pathAddAdaptiveHalfPath(const Workspace             &ws,
 
   const auto &ellipsoid = surf_field.ellipsoid;
 
-  Vector                      sum_tau(nf, 0.0);
+  matpack::scratch_t<Numeric, 1> sum_tau_buf(nf);
+  VectorView                     sum_tau = sum_tau_buf;
   ArrayOfPropagationPathPoint nrp;
   ArrayOfAtmPoint             nap;
   ArrayOfAscendingGrid        nfgp;
@@ -168,12 +170,25 @@ void spectral_propmat_path_species_splitFromPath(
   for (auto &s : spectral_propmat_jac_path_species_split) s.resize(np);
   for (auto &s : spectral_nlte_srcvec_jac_path_species_split) s.resize(np);
 
+  fwd::propmat_species_cache *cache = ws.caches.propmat_species.get();
+
   String error{};
 
 #pragma omp parallel for if (!arts_omp_in_parallel()) collapse(2)
   for (Size is = 0; is < ns; is++) {
     for (Size ip = 0; ip < np; ip++) {
       try {
+        if (cache) {
+          if (auto res = cache->find(
+                  select_species_list[is], freq_grid_path[ip], ray_path[ip].pos, ray_path[ip].los, atm_path[ip])) {
+            spectral_propmat_path_species_split[is][ip]         = res->pm;
+            spectral_nlte_srcvec_path_species_split[is][ip]     = res->sv;
+            spectral_propmat_jac_path_species_split[is][ip]     = res->dpm;
+            spectral_nlte_srcvec_jac_path_species_split[is][ip] = res->dsv;
+            continue;
+          }
+        }
+
         spectral_propmat_agendaExecute(ws,
                                        spectral_propmat_path_species_split[is][ip],
                                        spectral_nlte_srcvec_path_species_split[is][ip],
@@ -186,6 +201,18 @@ void spectral_propmat_path_species_splitFromPath(
                                        ray_path[ip],
                                        atm_path[ip],
                                        spectral_propmat_agenda);
+
+        if (cache) {
+          cache->insert(select_species_list[is],
+                        freq_grid_path[ip],
+                        ray_path[ip].pos,
+                        ray_path[ip].los,
+                        atm_path[ip],
+                        {.pm  = spectral_propmat_path_species_split[is][ip],
+                         .sv  = spectral_nlte_srcvec_path_species_split[is][ip],
+                         .dpm = spectral_propmat_jac_path_species_split[is][ip],
+                         .dsv = spectral_nlte_srcvec_jac_path_species_split[is][ip]});
+        }
       } catch (const std::runtime_error &e) {
 #pragma omp critical
         if (error.empty()) error = e.what();
@@ -11,6 +11,8 @@
 
 #include <algorithm>
 #include <exception>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 void spectral_rad_jacEmpty(StokvecMatrix         &spectral_rad_jac,
@@ -274,6 +276,93 @@ location and the sensor element will not be found.
 ARTS_METHOD_ERROR_CATCH
 
 namespace {
+/** The observational elements that each simulation contributes to
+ *
+ * Only elements that share the frequency grid of the simulation and
+ * that have some weight for its position and line of sight are listed.
+ */
+std::vector<std::vector<Size>> simulation_obsels(const ArrayOfSensorObsel &measurement_sensor,
+                                                 const SensorSimulations  &simulations) {
+  std::unordered_map<const AscendingGrid *, std::vector<Size>> freq_obsels;
+  for (Size iv = 0; iv < measurement_sensor.size(); ++iv) {
+    freq_obsels[&measurement_sensor[iv].f_grid()].push_back(iv);
+  }
+
+  std::vector<std::vector<Size>> out(simulations.size());
+  for (Size i = 0; i < simulations.size(); i++) {
+    const auto it = freq_obsels.find(&simulations[i].freq_grid);
+    if (it == freq_obsels.end()) continue;
+
+    const Index ip = static_cast<Index>(simulations[i].iposlos);
+    for (const Size iv : it->second) {
+      if (not measurement_sensor[iv].poslos_weights(ip).empty()) out[i].push_back(iv);
+    }
+  }
+
+  return out;
+}
+
+/** Per-thread sums of simulations into rows of the measurement
+
+  At most max_rows rows are kept.  They are added to the measurement,
+  under one lock per group of rows, when a new row does not fit and in
+  flush(), so no thread needs its own copy of the full M x J Jacobian.
+
+  The rows live in the arena of the thread, so the partials must be
+  created and destroyed on the thread that uses them.
+*/
+class row_partials {
+  Vector                  &measurement_vec;
+  Matrix                  &measurement_jac;
+  std::vector<std::mutex> &locks;
+
+  std::unordered_map<Size, Size> slots{};
+  std::vector<Size>              rows{};
+  matpack::scratch_t<Numeric, 1> y;
+  matpack::scratch_t<Numeric, 2> jac;
+
+ public:
+  row_partials(Vector &measurement_vec_, Matrix &measurement_jac_, std::vector<std::mutex> &locks_, Size max_rows)
+      : measurement_vec(measurement_vec_),
+        measurement_jac(measurement_jac_),
+        locks(locks_),
+        y(max_rows),
+        jac(max_rows, measurement_jac_.ncols()) {
+    rows.reserve(max_rows);
+  }
+
+  //! Adds the contribution of a simulation to row iv
+  void add(Size iv, const SensorObsel &obsel, Index ip, StokvecVectorView rad, StokvecMatrixView rad_jac) {
+    auto it = slots.find(iv);
+    if (it == slots.end()) {
+      if (rows.size() == static_cast<Size>(y.size())) flush();
+      it = slots.emplace(iv, rows.size()).first;
+      rows.push_back(iv);
+    }
+
+    const Size k  = it->second;
+    y[k]         += obsel.sumup(rad, ip);
+    obsel.sumup(jac[k], rad_jac, ip);
+  }
+
+  //! Adds all kept rows to the measurement and clears them
+  void flush() {
+    for (Size k = 0; k < rows.size(); k++) {
+      const Size iv = rows[k];
+      {
+        std::lock_guard lock(locks[iv % locks.size()]);
+        measurement_vec[iv] += y[k];
+        measurement_jac[iv] += jac[k];
+      }
+      y[k]   = 0.0;
+      jac[k] = 0.0;
+    }
+
+    slots.clear();
+    rows.clear();
+  }
+};
+
 void low_memory(const Workspace                         &ws,
                 Vector                                  &measurement_vec,
                 Matrix                                  &measurement_jac,
@@ -288,50 +377,62 @@ void low_memory(const Workspace                         &ws,
   ARTS_TIME_REPORT
 
   const Size N = simulations.size();
+  const Size M = measurement_vec.size();
 
-  std::string error{};
+  const std::vector<std::vector<Size>> obsels = simulation_obsels(measurement_sensor, simulations);
 
-  //! Dynamic scheduling as some simulations may take much longer time than others
-#pragma omp parallel for schedule(dynamic) if (arts_omp_parallel(-1, N > 1))
-  for (Size i = 0; i < N; i++) {
-    try {
-      const Size  ip        = simulations[i].iposlos;
-      const auto &freq_grid = simulations[i].freq_grid;
-      const auto &poslos    = simulations[i].poslos_grid[ip];
+  //! Together, the partials of all threads hold about as many rows as the measurement
+  const bool parallel = arts_omp_parallel(-1, N > 1);
+  const Size nthreads = parallel ? static_cast<Size>(std::max(1, arts_omp_get_max_threads())) : 1;
+  const Size max_rows = std::max<Size>(1, M / nthreads);
 
-      StokvecVector               spectral_rad;
-      StokvecMatrix               spectral_rad_jac;
-      ArrayOfPropagationPathPoint ray_path;
+  std::vector<std::mutex> locks(std::clamp<Size>(M, 1, 64));
 
-      spectral_rad_observer_agendaExecute(ws,
-                                          spectral_rad,
-                                          spectral_rad_jac,
-                                          ray_path,
-                                          freq_grid,
-                                          jac_targets,
-                                          poslos.pos,
-                                          poslos.los,
-                                          atm_field,
-                                          surf_field,
-                                          subsurf_field,
-                                          spectral_rad_observer_agenda);
-
-      ARTS_USER_ERROR_IF(ray_path.empty(), "No ray path found");
-      spectral_rad_transform_operator(spectral_rad, spectral_rad_jac, freq_grid, ray_path.front());
-
-#pragma omp critical
-      for (Size iv = 0; iv < measurement_sensor.size(); ++iv) {
-        const SensorObsel &obsel = measurement_sensor[iv];
-        if (obsel.same_freqs(freq_grid)) {
-          measurement_vec[iv] += obsel.sumup(spectral_rad, ip);
+  std::string error{};
 
-          obsel.sumup(measurement_jac[iv], spectral_rad_jac, ip);
+#pragma omp parallel if (parallel)
+  {
+    row_partials partials(measurement_vec, measurement_jac, locks, max_rows);
+
+    StokvecVector spectral_rad;
+    StokvecMatrix spectral_rad_jac;
+
+    //! Dynamic scheduling as some simulations may take much longer time than others
+#pragma omp for schedule(dynamic)
+    for (Size i = 0; i < N; i++) {
+      try {
+        const Size  ip        = simulations[i].iposlos;
+        const auto &freq_grid = simulations[i].freq_grid;
+        const auto &poslos    = simulations[i].poslos_grid[ip];
+
+        ArrayOfPropagationPathPoint ray_path;
+
+        spectral_rad_observer_agendaExecute(ws,
+                                            spectral_rad,
+                                            spectral_rad_jac,
+                                            ray_path,
+                                            freq_grid,
+                                            jac_targets,
+                                            poslos.pos,
+                                            poslos.los,
+                                            atm_field,
+                                            surf_field,
+                                            subsurf_field,
+                                            spectral_rad_observer_agenda);
+
+        ARTS_USER_ERROR_IF(ray_path.empty(), "No ray path found");
+        spectral_rad_transform_operator(spectral_rad, spectral_rad_jac, freq_grid, ray_path.front());
+
+        for (const Size iv : obsels[i]) {
+          partials.add(iv, measurement_sensor[iv], static_cast<Index>(ip), spectral_rad, spectral_rad_jac);
         }
-      }
-    } catch (const std::exception &e) {
+      } catch (const std::exception &e) {
 #pragma omp critical
-      if (error.empty()) { error = std::format("Error in unflattening data for index {}: {}\n", i, e.what()); }
+        if (error.empty()) { error = std::format("Error in unflattening data for index {}: {}\n", i, e.what()); }
+      }
     }
+
+    partials.flush();
   }
 
   ARTS_USER_ERROR_IF(not error.empty(), "Errors occurred:\n{:}", error);
@@ -351,21 +452,15 @@ void high_performance(const Workspace                         &ws,
   ARTS_TIME_REPORT
 
   const Size N = simulations.size();
-  const Size M = measurement_vec.size();
   const Size J = jac_targets.x_size();
 
-  std::unordered_map<
-      const AscendingGrid *,
-      std::unordered_map<const SensorPosLosVector *, std::vector<std::pair<StokvecVector, StokvecMatrix>>>>
-      cache;
-
-  for (Size i = 0; i < N; i++) {
-    const Size ip = simulations[i].iposlos;
+  //! The Stokes weights of all elements as one operator on the concatenated simulations, kept on the sensor
+  const std::shared_ptr<const SensorResponseOperator> sensor_operator_ptr =
+      sensor::response_operator(measurement_sensor, simulations);
+  const SensorResponseOperator &sensor_operator = *sensor_operator_ptr;
 
-    if (ip == 0) {
-      cache[&simulations[i].freq_grid][&simulations[i].poslos_grid].resize(simulations[i].poslos_grid.size());
-    }
-  }
+  StokvecVector all_rad(sensor_operator.ncols());
+  StokvecMatrix all_rad_jac(sensor_operator.ncols(), J);
 
   std::string error{};
 
@@ -377,8 +472,9 @@ void high_performance(const Workspace                         &ws,
       const auto &freq_grid  = simulations[i].freq_grid;
       const auto &poslos_vec = simulations[i].poslos_grid;
 
+      StokvecVector               spectral_rad;
+      StokvecMatrix               spectral_rad_jac;
       ArrayOfPropagationPathPoint ray_path;
-      auto &[spectral_rad, spectral_rad_jac] = cache.at(&freq_grid).at(&poslos_vec).at(ip);
 
       spectral_rad_observer_agendaExecute(ws,
                                           spectral_rad,
@@ -395,6 +491,21 @@ void high_performance(const Workspace                         &ws,
 
       ARTS_USER_ERROR_IF(ray_path.empty(), "No ray path found");
       spectral_rad_transform_operator(spectral_rad, spectral_rad_jac, freq_grid, ray_path.front());
+
+      const Size nf = freq_grid.size();
+      ARTS_USER_ERROR_IF(spectral_rad.size() != nf or static_cast<Size>(spectral_rad_jac.nrows()) != J or
+                             static_cast<Size>(spectral_rad_jac.ncols()) != nf,
+                         "Bad shapes. spectral_rad.shape(): {:B,}, spectral_rad_jac.shape(): {:B,}, expected {} frequencies and {} Jacobian targets",
+                         spectral_rad.shape(),
+                         spectral_rad_jac.shape(),
+                         nf,
+                         J);
+
+      const Size i0 = sensor_operator.sim_offset(i);
+      for (Size iv = 0; iv < nf; iv++) {
+        all_rad[i0 + iv] = spectral_rad[iv];
+        for (Size ij = 0; ij < J; ij++) all_rad_jac[i0 + iv, ij] = spectral_rad_jac[ij, iv];
+      }
     } catch (const std::exception &e) {
 #pragma omp critical
       if (error.empty()) { error = std::format("Error in unflattening data for index {}: {}\n", i, e.what()); }
@@ -403,25 +514,8 @@ void high_performance(const Workspace                         &ws,
 
   ARTS_USER_ERROR_IF(not error.empty(), "Errors occurred:\n{:}", error);
 
-#pragma omp parallel for schedule(dynamic) if (arts_omp_parallel(-1, M > 1))
-  for (Size iv = 0; iv < M; ++iv) {
-    const SensorObsel &obsel = measurement_sensor[iv];
-
-    auto &data = cache.at(obsel.f_grid_ptr().get()).at(obsel.poslos_grid_ptr().get());
-
-    for (auto &sparse_weights : obsel.weight_matrix()) {
-      const Size ip    = sparse_weights.irow;
-      const Size ifreq = sparse_weights.icol;
-
-      const auto &[spectral_rad, spectral_rad_jac] = data.at(ip);
-
-      measurement_vec[iv] += dot(sparse_weights.data, spectral_rad[ifreq]);
-
-      auto jac   = measurement_jac[iv];
-      auto srjac = spectral_rad_jac[joker, ifreq];
-      for (Size ij = 0; ij < J; ij++) { jac[ij] += dot(sparse_weights.data, srjac[ij]); }
-    }
-  }
+  sensor_operator.apply(measurement_vec, all_rad);
+  sensor_operator.apply(measurement_jac, all_rad_jac);
 }
 }  // namespace
 
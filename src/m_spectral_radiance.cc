@@ -101,7 +101,8 @@ single_propmat_jac_path: (N, nq) = {:B,}
   single_tramat_jac_path = 0.0;
 
   const Vector ray_path_distance = distance(ray_path, surf_field.ellipsoid);
-  Tensor3      ray_path_distance_jacobian(2, N - 1, nq, 0.0);
+  matpack::scratch_t<Numeric, 3> ray_path_distance_jacobian_buf(2, N - 1, nq);
+  Tensor3View                    ray_path_distance_jacobian = ray_path_distance_jacobian_buf;
 
   const Index temperature_derivative_position = jac_targets.target_position(AtmKey::t);
   if (hse_derivative and temperature_derivative_position >= 0) {
@@ -197,7 +197,7 @@ void workspace_setup_and_exec(std::ostream& os, const std::string& name, const a
   std::println(os, R"(
   // Create a local workspace upon need or get the data from the pointer
   Workspace _lws = _lws_ptr ? std::move(*_lws_ptr) : Workspace(WorkspaceInitialization::Empty);
-  const bool empty = _lws.wsv.empty();
+  const bool empty = _lws.size() == 0;
 
   // Name the original data here)");
   for (auto& i : ag.i) { std::println(os, R"(  static const std::string _wsv_{0} = "{0}";)", i.second); }
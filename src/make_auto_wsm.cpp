@@ -156,6 +156,7 @@ void header(std::ostream& os) try {
 
 //! auto-generated by make_auto_wsm.cpp
 
+#include <span>
 #include <string>
 #include <vector>
 
@@ -168,6 +169,9 @@ struct WorkspaceMethodRecord {
   std::vector<std::string> in;
   std::unordered_map<std::string, Wsv> defs;
   std::function<void(Workspace&, const std::vector<std::string>&, const std::vector<std::string>&)> func;
+
+  //! As func but on variables already resolved by a compiled agenda (empty for generic methods)
+  std::function<void(Workspace&, std::span<Wsv* const>, std::span<Wsv* const>)> slot_func{};
 };
 
 const std::unordered_map<std::string, WorkspaceMethodRecord>& workspace_methods();
@@ -456,6 +460,53 @@ void call_function(std::ostream& os, const std::string& name, const WorkspaceMet
   }
 } catch (std::exception& e) { throw std::runtime_error("Error in call_function():\n\n" + std::string(e.what())); }
 
+//! As the specific-method branch of call_function, but the variables are passed as resolved pointers
+void slot_function(std::ostream& os, const std::string& name, const WorkspaceMethodInternalRecord& wsmr) try {
+  const auto& wsv = internal_workspace_variables();
+
+  os << "[](Workspace& ws [[maybe_unused]], std::span<Wsv* const> out [[maybe_unused]], std::span<Wsv* const> in [[maybe_unused]]) {\n";
+  os << "    try {\n";
+
+  bool first = true;
+  os << "      " << name << "(";
+  if (wsmr.pass_workspace) {
+    os << "ws";
+    first = false;
+  }
+
+  const String spaces(name.size() + 7, ' ');
+
+  int out_count = 0;
+  for (auto& str : wsmr.out) {
+    os << comma(first, spaces) << "out[" << out_count++ << "]->get<" << wsv.at(str).type << ">() /* out */";
+  }
+
+  for (std::size_t i = 0; i < wsmr.gout.size(); i++) {
+    os << comma(first, spaces) << "out[" << out_count++ << "]->get<" << any_is_typename(wsmr.gout_type[i])
+       << ">() /* gout */";
+  }
+
+  int in_count = 0;
+  for (auto& str : wsmr.in) {
+    if (std::any_of(wsmr.out.begin(), wsmr.out.end(), [&str](auto& var) { return str == var; })) {
+      in_count++;
+      continue;
+    }
+    os << comma(first, spaces) << "in[" << in_count++ << "]->get<" << wsv.at(str).type << ">() /* in */";
+  }
+
+  for (std::size_t i = 0; i < wsmr.gin.size(); i++) {
+    os << comma(first, spaces) << "in[" << in_count++ << "]->get<" << wsmr.gin_type[i] << ">() /* gin */";
+  }
+
+  os << "\n      );\n"
+        "    } catch (std::exception& e) {\n"
+        "      throw std::runtime_error(std::format(R\"-x-(Error in agenda call to specific method\n\n"
+     << error_signature(name, wsmr)
+     << "\n\n{})-x-\", e.what()));\n"
+        "    }\n  }\n";
+} catch (std::exception& e) { throw std::runtime_error("Error in slot_function():\n\n" + std::string(e.what())); }
+
 void wsm_record(std::ostream& os, const std::string& name, const WorkspaceMethodInternalRecord& wsmr) try {
   os << "    .out={";
   bool first = true;
@@ -480,6 +531,11 @@ void wsm_record(std::ostream& os, const std::string& name, const WorkspaceMethod
   os << "    .func=";
   call_function(os, name, wsmr);
 
+  if (not wsmr.has_any() and not wsmr.has_overloads()) {
+    os << ",\n    .slot_func=";
+    slot_function(os, name, wsmr);
+  }
+
   os << "\n";
 } catch (std::exception& e) { throw std::runtime_error("Error in wsm_record():\n\n" + std::string(e.what())); }
 
@@ -21,6 +21,7 @@
 #include "invlib/map.h"
 #include "invlib/optimization.h"
 #include "jacobian.h"
+#include "path_geometry_cache.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 //  Type Aliases
@@ -481,6 +482,7 @@ class AgendaWrapper {
    */
   MatrixReference Jacobian(const Vector &xi, Vector &yi) {
     if (!reuse_jacobian_) {
+      update_caches(xi);
       inversion_iterate_agendaExecute(*ws_,
                                       *atm,
                                       *absdata,
@@ -514,6 +516,7 @@ class AgendaWrapper {
    */
   Vector evaluate(const Vector &xi) {
     if (!reuse_jacobian_) {
+      update_caches(xi);
       Matrix dummy;
       inversion_iterate_agendaExecute(*ws_,
                                       *atm,
@@ -535,6 +538,11 @@ class AgendaWrapper {
   }
 
  private:
+  /** Forget the cached results of the workspace that may differ at xi. */
+  void update_caches(const Vector &xi) const {
+    if (ws_->caches.ray_path) ws_->caches.ray_path->update(xi);
+  }
+
   /** Pointer to the inversion_iterate_agenda of the workspace. */
   const Agenda          *inversion_iterate_agenda_;
   const JacobianTargets *jacs;
@@ -257,15 +257,21 @@ do_scattering : bool
       .def_rw("pressure", &AtmPoint::pressure, "Pressure [Pa]\n\n.. :class:`~pyarts3.arts.Numeric`")
       .def_rw("mag", &AtmPoint::mag, "Magnetic field [T]\n\n.. :class:`~pyarts3.arts.Vector3`")
       .def_rw("wind", &AtmPoint::wind, "Wind field [m/s]\n\n.. :class:`~pyarts3.arts.Vector3`")
-      .def_rw("nlte",
-              &AtmPoint::nlte,
-              "NLTE data\n\n.. :class:`dict[~pyarts3.arts.QuantumIdentifier, ~pyarts3.arts.Numeric]`")
-      .def_rw("specs",
-              &AtmPoint::specs,
-              "Species data\n\n.. :class:`dict[~pyarts3.arts.SpeciesEnum, ~pyarts3.arts.Numeric]`")
-      .def_rw("isots",
-              &AtmPoint::isots,
-              "Isotopologue ratio data\n\n.. :class:`dict[~pyarts3.arts.SpeciesIsotope, ~pyarts3.arts.Numeric]`")
+      .def_prop_rw(
+          "nlte",
+          [](const AtmPoint &self) { return self.nlte(); },
+          [](AtmPoint &self, AtmPoint::NlteMap x) { self.set_nlte(std::move(x)); },
+          "NLTE data, a copy that must be assigned back to change the point\n\n.. :class:`dict[~pyarts3.arts.QuantumIdentifier, ~pyarts3.arts.Numeric]`")
+      .def_prop_rw(
+          "specs",
+          [](const AtmPoint &self) { return self.specs(); },
+          [](AtmPoint &self, AtmPoint::SpeciesMap x) { self.set_specs(std::move(x)); },
+          "Species data, a copy that must be assigned back to change the point\n\n.. :class:`dict[~pyarts3.arts.SpeciesEnum, ~pyarts3.arts.Numeric]`")
+      .def_prop_rw(
+          "isots",
+          [](const AtmPoint &self) { return self.isots(); },
+          [](AtmPoint &self, AtmPoint::SpeciesIsotopeMap x) { self.set_isots(std::move(x)); },
+          "Isotopologue ratio data, a copy that must be assigned back to change the point\n\n.. :class:`dict[~pyarts3.arts.SpeciesIsotope, ~pyarts3.arts.Numeric]`")
       .def_rw(
           "ssprops",
           &AtmPoint::ssprops,
@@ -316,7 +322,7 @@ nd : float
       .def(
           "no_isotopologues",
           [](AtmPoint in) {
-            in.isots.clear();
+            in.set_isots({});
             return in;
           },
           "Returns an atmospheric point without isotopologue ratios.")
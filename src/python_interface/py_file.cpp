@@ -112,6 +112,26 @@ void enum_FileType(py::module_& m) {
       "bin",
       [](py::object&) { return FileType::binary; },
       R"-ENUMDOC-(Save as binary data
+)-ENUMDOC-");
+  _gFileType.def_prop_ro_static(
+      "cbinary",
+      [](py::object&) { return FileType::cbinary; },
+      R"-ENUMDOC-(Save as chunked binary data, deflated in independent blocks
+)-ENUMDOC-");
+  _gFileType.def_prop_ro_static(
+      "CBINARY",
+      [](py::object&) { return FileType::cbinary; },
+      R"-ENUMDOC-(Save as chunked binary data, deflated in independent blocks
+)-ENUMDOC-");
+  _gFileType.def_prop_ro_static(
+      "ChunkedBinary",
+      [](py::object&) { return FileType::cbinary; },
+      R"-ENUMDOC-(Save as chunked binary data, deflated in independent blocks
+)-ENUMDOC-");
+  _gFileType.def_prop_ro_static(
+      "cbin",
+      [](py::object&) { return FileType::cbinary; },
+      R"-ENUMDOC-(Save as chunked binary data, deflated in independent blocks
 )-ENUMDOC-");
 }
 
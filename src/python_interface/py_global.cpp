@@ -11,6 +11,7 @@
 #include <nanobind/stl/unordered_map.h>
 #include <nanobind/stl/vector.h>
 #include <parameters.h>
+#include <time_report.h>
 #include <workspace_variable_shortnames.h>
 
 #include "hpy_arts.h"
@@ -211,7 +212,7 @@ Parameters
                      "Whether the ARTS library is compiled with CDisort support\n\n.. :class:`bool`")
       .def_ro_static("has_profiling",
                      &global_data::has_profiling,
-                     "Whether the ARTS library is compiled with time profiling\n\n.. :class:`bool`")
+                     "Whether the ARTS library records time profiling from the start\n\n.. :class:`bool`")
       .def_ro_static("arts_source_dir",
                      &global_data::arts_source_dir,
                      "The original ARTS source directory, if available\n\n.. :class:`str`")
@@ -239,7 +240,7 @@ Each entry has another :class:`dict` with :class:`str` key representing the shor
 As a thread can call a method multiple times, these results are stored as a :class:`list` of a start and an end :class:`~pyarts3.arts.Time`.
 
 .. note::
-    This function is only available if ARTS is compiled with profiling enabled.
+    Methods are only timed while profiling is on, see :func:`set_profiling`.
 
     Also be aware that the minimum time is in *native* time units, which
     depends on the platform.
@@ -253,6 +254,105 @@ Return
 ------
 See above, :class:`dict`
 )");
+
+  py::class_<arts::profile_event>(global, "ProfileEvent")
+      .def_ro("name", &arts::profile_event::name, "Position of the name in the trace's names\n\n.. :class:`int`")
+      .def_ro("depth", &arts::profile_event::depth, "The number of enclosing scopes\n\n.. :class:`int`")
+      .def_ro("start", &arts::profile_event::start, "Start in nanoseconds since the epoch of the trace\n\n.. :class:`int`")
+      .def_ro("end", &arts::profile_event::end, "End in nanoseconds since the epoch of the trace\n\n.. :class:`int`")
+      .doc() = "A closed profiling scope";
+
+  py::class_<arts::profile_thread>(global, "ProfileThread")
+      .def_ro("id", &arts::profile_thread::id, "Unique thread identifier\n\n.. :class:`int`")
+      .def_ro("core", &arts::profile_thread::core, "The OpenMP thread number\n\n.. :class:`int`")
+      .def_ro("events",
+              &arts::profile_thread::events,
+              "The closed scopes, ordered by their end\n\n.. :class:`list[ProfileEvent]`")
+      .doc() = "The profiling scopes of a thread";
+
+  py::class_<arts::profile_node>(global, "ProfileNode")
+      .def_ro("name", &arts::profile_node::name, "The name of the scope\n\n.. :class:`str`")
+      .def_ro("calls", &arts::profile_node::calls, "Number of calls\n\n.. :class:`int`")
+      .def_ro("total", &arts::profile_node::total, "Total time in seconds\n\n.. :class:`float`")
+      .def_ro("self", &arts::profile_node::self, "Total time in seconds, excluding children\n\n.. :class:`float`")
+      .def_ro("min", &arts::profile_node::min, "Shortest call in seconds\n\n.. :class:`float`")
+      .def_ro("max", &arts::profile_node::max, "Longest call in seconds\n\n.. :class:`float`")
+      .def_ro("children", &arts::profile_node::children, "Scopes called by this scope\n\n.. :class:`list[ProfileNode]`")
+      .doc() = "Aggregated statistics of all calls of a scope with the same parents";
+
+  py::class_<arts::profile_trace>(global, "ProfileTrace")
+      .def_ro("names", &arts::profile_trace::names, "The names of the scopes\n\n.. :class:`list[str]`")
+      .def_ro("threads", &arts::profile_trace::threads, "The profiled threads\n\n.. :class:`list[ProfileThread]`")
+      .def_ro("epoch", &arts::profile_trace::epoch, "The time of the zero of the events\n\n.. :class:`~pyarts3.arts.Time`")
+      .def("tree",
+           &arts::aggregate,
+           R"(Merge the calls into a tree
+
+Calls with the same name and the same parents are merged over all threads.
+
+Return
+------
+:class:`ProfileNode`
+    The nameless root, its children are the outermost scopes)")
+      .def("chrome_trace",
+           &arts::to_chrome_trace,
+           R"(The trace in the Chrome trace event format
+
+Open the saved file in Perfetto or chrome://tracing.
+
+Return
+------
+:class:`str`
+    JSON)")
+      .def("speedscope",
+           &arts::to_speedscope,
+           R"(The trace in the speedscope evented format
+
+Open the saved file at https://www.speedscope.app.
+
+Return
+------
+:class:`str`
+    JSON)")
+      .doc() = "All recorded profiling scopes";
+
+  global.def("profile_trace",
+             &arts::get_trace,
+             "clear"_a = true,
+             R"(Get all profiling scopes that have been closed so far.
+
+Every thread records its scopes into its own buffer without locking.
+Nested scopes are recorded with their depth, so the trace can be turned into
+a call tree with :meth:`ProfileTrace.tree` or exported as a flame graph with
+:meth:`ProfileTrace.chrome_trace` and :meth:`ProfileTrace.speedscope`.
+
+.. note::
+    Scopes are only recorded while profiling is on, see :func:`set_profiling`.
+
+Parameters
+----------
+    clear : bool
+        Clear the recorded scopes after getting them.  Default: True.
+
+Return
+------
+:class:`ProfileTrace`
+    The trace)");
+
+  global.def("set_profiling",
+             &arts::set_profiling,
+             "on"_a,
+             R"(Turn the recording of profiling scopes on or off.
+
+Recording is on by default if ARTS is compiled with profiling enabled.
+Turning it off releases the buffers of the threads that have no open scope.
+
+Parameters
+----------
+    on : bool
+        Whether to record)");
+
+  global.def("profiling", &arts::profiling, "Whether profiling scopes are recorded\n\nReturn\n------\n:class:`bool`");
 } catch (std::exception& e) {
   throw std::runtime_error(std::format("DEV ERROR:\nCannot initialize global\n{}", e.what()));
 }
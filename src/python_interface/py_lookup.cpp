@@ -26,7 +26,22 @@ void py_lookup(py::module_& m) try {
   alt.def_rw("t_atmref",
              &AbsorptionLookupTable::t_atmref,
              "Local grids so that pressure interpolation may work\n\n.. :class:`Vector`");
-  alt.def_rw("xsec", &AbsorptionLookupTable::xsec, "The absorption cross section table\n\n.. :class:`Tensor4`");
+  alt.def_prop_rw(
+      "xsec",
+      [](AbsorptionLookupTable& self) -> Tensor4& { return self.xsec; },
+      [](AbsorptionLookupTable& self, Tensor4 x) {
+        // The mapped cross sections take precedence, so they must go
+        self.xsec = std::move(x);
+        self.mapped.reset();
+      },
+      "The absorption cross section table (empty if mapped from file, setting it drops the mapping)\n\n.. :class:`Tensor4`");
+  alt.def_prop_ro(
+      "mapped",
+      [](const AbsorptionLookupTable& self) { return static_cast<bool>(self.mapped); },
+      "Whether the cross sections are mapped from a file\n\n.. :class:`bool`");
+  alt.def("materialize",
+          &AbsorptionLookupTable::materialize,
+          "Copies mapped cross sections into :attr:`xsec` and drops the mapping");
 
   auto alts = py::bind_map<AbsorptionLookupTables, py::rv_policy::reference_internal>(m, "AbsorptionLookupTables");
   generic_interface(alts);
@@ -1,4 +1,5 @@
 #include <enumsSpectralRadianceUnitType.h>
+#include <functional_numeric_ternary.h>
 #include <nanobind/nanobind.h>
 #include <nanobind/ndarray.h>
 #include <nanobind/stl/function.h>
@@ -8,6 +9,9 @@
 #include <nanobind/stl/vector.h>
 #include <operators.h>
 
+#include <array>
+#include <memory>
+
 #include "henyey_greenstein.h"
 #include "hpy_arts.h"
 #include "hpy_numpy.h"
@@ -58,14 +62,64 @@ void py_operators(py::module_& m) {
   generic_interface(nbop);
   py::implicitly_convertible<NumericBinaryOperator::func_t, NumericBinaryOperator>();
 
+  // Holds the GIL while calling a scalar Python function
+  const auto scalar_ternary = [](NumericTernaryOperator::func_t f) {
+    return [f = std::move(f)](Numeric x, Numeric y, Numeric z) {
+      py::gil_scoped_acquire gil{};
+      return f(x, y, z);
+    };
+  };
+
   py::class_<NumericTernaryOperator> ntop(m, "NumericTernaryOperator");
   ntop.def("__init__",
-           [](NumericTernaryOperator* op, NumericTernaryOperator::func_t f) {
-             new (op) NumericTernaryOperator([f = std::move(f)](Numeric x, Numeric y, Numeric z) {
-               py::gil_scoped_acquire gil{};
-               return f(x, y, z);
-             });
+           [scalar_ternary](NumericTernaryOperator* op, NumericTernaryOperator::func_t f) {
+             new (op) NumericTernaryOperator(scalar_ternary(std::move(f)));
            })
+      .def(
+          "__init__",
+          [scalar_ternary, copyto = py::module_::import_("numpy").attr("copyto")](
+              NumericTernaryOperator* op, py::object f, bool vectorized) {
+            if (not vectorized) {
+              new (op) NumericTernaryOperator(scalar_ternary(py::cast<NumericTernaryOperator::func_t>(f)));
+              return;
+            }
+
+            // Copies of the operator are made and destroyed without the GIL
+            const std::shared_ptr<std::array<py::object, 2>> pyf(new std::array<py::object, 2>{std::move(f), copyto},
+                                                                 [](std::array<py::object, 2>* ptr) {
+                                                                   py::gil_scoped_acquire gil{};
+                                                                   delete ptr;
+                                                                 });
+
+            new (op) NumericTernaryOperator(ternary::Batched{[pyf](VectorView             out,
+                                                                   const ConstVectorView& x,
+                                                                   const ConstVectorView& y,
+                                                                   const ConstVectorView& z) {
+              using nd_in  = py::ndarray<py::numpy, const Numeric, py::ndim<1>, py::c_contig>;
+              using nd_out = py::ndarray<py::numpy, Numeric, py::ndim<1>, py::c_contig>;
+
+              py::gil_scoped_acquire gil{};
+
+              // Read-only views of the positions, valid for the duration of the call
+              const std::array<size_t, 1> shape{static_cast<size_t>(out.size())};
+              const auto                  view = [&shape](const ConstVectorView& v) {
+                return nd_in(v.data_handle(), 1, shape.data(), py::handle()).cast(py::rv_policy::reference);
+              };
+
+              auto& [fun, np_copyto] = *pyf;
+              np_copyto(nd_out(out.data_handle(), 1, shape.data(), py::handle()).cast(py::rv_policy::reference),
+                        fun(view(x), view(y), view(z)));
+            }});
+          },
+          "f"_a,
+          "vectorized"_a,
+          R"(Wraps a Python function of altitude, latitude, and longitude.
+
+If vectorized, f is called with 1D arrays of altitudes, latitudes, and
+longitudes and must return an array of the values, or a value for all.
+ARTS then calls it once for many positions, such as all points of a path,
+instead of once per position.  The arrays are read-only views of ARTS data
+that must not be kept after the call, copy them if needed.)")
       .def(
           "__call__",
           [](NumericTernaryOperator& f, py::object x, py::object y, py::object z) { return vectorize(f.f, x, y, z); },
@@ -499,6 +499,22 @@ void py_scattering_species(py::module_& m) try {
           "Get mass information")
       .doc() = "Particle habit";
 
+  py::class_<scattering::BulkPropertiesTable>(m, "BulkPropertiesTable")
+      .def_ro("t_grid", &scattering::BulkPropertiesTable::t_grid, "Temperature grid [K]")
+      .def_ro("moment_grid", &scattering::BulkPropertiesTable::moment_grid, "PSD moment grid")
+      .def_ro("f_grid", &scattering::BulkPropertiesTable::f_grid, "Frequency grid [Hz]")
+      .def_ro("data", &scattering::BulkPropertiesTable::data, "Bulk properties per unit moment")
+      .def_ro("build_time", &scattering::BulkPropertiesTable::build_time, "Time it took to build the table [s]")
+      .def_ro("max_rel_error",
+              &scattering::BulkPropertiesTable::max_rel_error,
+              "Largest relative error in extinction and absorption at the cell centres")
+      .def("interpolate",
+           &scattering::BulkPropertiesTable::interpolate,
+           "t"_a,
+           "moment"_a,
+           "Interpolate the table, returns None outside of it")
+      .doc() = "Precomputed bulk scattering properties of a scattering habit";
+
   py::class_<ScatteringHabit>(m, "ScatteringHabit")
       .def(py::init<const ParticleHabit&, const PSD&, Numeric, Numeric>(),
            py::arg("particle_habit"),
@@ -511,6 +527,19 @@ void py_scattering_species(py::module_& m) try {
            "f_grid"_a,
            "degree"_a,
            "Get the bulk scattering properties for totally random orientation but ignores the degree")
+      .def(
+          "set_bulk_table",
+          [](ScatteringHabit&     habit,
+             const AscendingGrid& t_grid,
+             const AscendingGrid& moment_grid,
+             const Vector&        f_grid) { return habit.set_bulk_table(t_grid, moment_grid, f_grid); },
+          "t_grid"_a,
+          "moment_grid"_a,
+          "f_grid"_a,
+          "Precompute the bulk scattering properties on a grid of temperature and PSD moment.\n\n"
+          "Returns a copy of the table, including its build time and accuracy.")
+      .def("clear_bulk_table", &ScatteringHabit::clear_bulk_table, "Remove the precomputed table")
+      .def_prop_ro("bulk_table", &ScatteringHabit::get_bulk_table, "The precomputed table or None")
       .doc() =
       "A scattering habit combines a particle habit with a PSD so that it can be used as a scattering species.";
 
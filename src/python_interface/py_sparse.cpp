@@ -387,18 +387,15 @@ arr : :class:`scipy.sparse.csr_matrix`
       .def(py::init<Range, Range, IndexPair, std::shared_ptr<Sparse>>(), "By value, sparse")
       .def_prop_rw(
           "matrix",
-          [](Block& x) -> std::variant<Matrix*, Sparse*> {
+          [](Block& x) -> std::variant<Matrix*, Sparse*, KroneckerCovariance*> {
             if (x.is_dense()) return &x.get_dense();
+            if (x.is_kronecker()) return &x.get_kronecker();
             return &x.get_sparse();
           },
-          [](Block& x, std::variant<Matrix*, Sparse*> y) {
-            if (std::holds_alternative<Matrix*>(y)) {
-              x.set_matrix(std::make_shared<Matrix>(**std::get_if<Matrix*>(&y)));
-            } else {
-              x.set_matrix(std::make_shared<Sparse>(**std::get_if<Sparse*>(&y)));
-            }
+          [](Block& x, std::variant<Matrix*, Sparse*, KroneckerCovariance*> y) {
+            std::visit([&x](auto* m) { x.matrix_ = *m; }, y);
           },
-          "The matrix held inside the instance\n\n.. :class:`~pyarts3.arts.Matrix`\n\n.. :class:`~pyarts3.arts.Sparse`")
+          "The matrix held inside the instance\n\n.. :class:`~pyarts3.arts.Matrix`\n\n.. :class:`~pyarts3.arts.Sparse`\n\n.. :class:`~pyarts3.arts.KroneckerCovariance`")
 
       .doc() = "A single block matrix";
 
@@ -407,9 +404,40 @@ arr : :class:`scipy.sparse.csr_matrix`
   vector_interface(aob);
   generic_interface(aob);
 
+  py::class_<KroneckerCovariance> kc(m, "KroneckerCovariance");
+  kc.def_ro("std_dev", &KroneckerCovariance::std_dev, "The standard deviations\n\n.. :class:`~pyarts3.arts.Vector`")
+      .def_ro("cholesky",
+              &KroneckerCovariance::cholesky,
+              "The lower Cholesky factor of the correlation of each dimension\n\n.. :class:`~pyarts3.arts.ArrayOfMatrix`")
+      .def_ro("inverse", &KroneckerCovariance::inverse, "Whether this is the inverse of the covariance\n\n.. :class:`bool`")
+      .def_static("from_correlations",
+                  &KroneckerCovariance::from_correlations,
+                  "std_dev"_a,
+                  "correlations"_a,
+                  "Factorize the correlation matrix of each dimension, the last dimension varying fastest")
+      .def_static("exponential",
+                  &KroneckerCovariance::exponential,
+                  "std_dev"_a,
+                  "grids"_a,
+                  "lengths"_a,
+                  "Exponential correlations along each grid, a length of 0 means no correlation")
+      .def("inverted", &KroneckerCovariance::inverted, "The inverse, sharing the same factors")
+      .def("diagonal", &KroneckerCovariance::diagonal, "The diagonal of the matrix")
+      .def("dense", &KroneckerCovariance::dense, "The full matrix, only meant for small sizes")
+      .def(
+          "__array__",
+          [](const KroneckerCovariance& k, py::object dtype, py::object copy) {
+            return py::cast(k.dense()).attr("__array__")(dtype, copy);
+          },
+          "dtype"_a.none() = py::none(),
+          "copy"_a.none()  = py::none(),
+          "Returns a :class:`~numpy.ndarray` of the full matrix.")
+      .doc() = "A covariance matrix as a Kronecker product of Cholesky-factorised correlations";
+
   py::class_<BlockMatrix> bm(m, "BlockMatrix");
   bm.def(py::init_implicit<Matrix>());
   bm.def(py::init_implicit<Sparse>());
+  bm.def(py::init_implicit<KroneckerCovariance>());
   bm.def(
       "__init__",
       [](BlockMatrix* s, Eigen::SparseMatrix<Numeric, Eigen::RowMajor> es) {
@@ -436,16 +464,19 @@ arr : :class:`scipy.sparse.csr_matrix`
   py::implicitly_convertible<py::ndarray<py::numpy, const Numeric, py::ndim<2>, py::c_contig>, BlockMatrix>();
   bm.def_prop_rw(
       "matrix",
-      [](BlockMatrix& bm) -> std::variant<Matrix, Sparse> {
+      [](BlockMatrix& bm) -> std::variant<Matrix, Sparse, KroneckerCovariance> {
         if (bm.not_null()) {
           if (bm.is_dense()) return bm.dense();
+          if (bm.is_kronecker()) return bm.kronecker();
           return bm.sparse();
         }
 
         return Matrix{};
       },
-      [](BlockMatrix& bm, const std::variant<Matrix, Sparse>& mat) { std::visit([&bm](auto& m) { bm = m; }, mat); },
-      "The matrix of the block\n\n.. :class:`~pyarts3.arts.Matrix`\n\n.. :class:`~pyarts3.arts.Sparse`");
+      [](BlockMatrix& bm, const std::variant<Matrix, Sparse, KroneckerCovariance>& mat) {
+        std::visit([&bm](auto& m) { bm = m; }, mat);
+      },
+      "The matrix of the block\n\n.. :class:`~pyarts3.arts.Matrix`\n\n.. :class:`~pyarts3.arts.Sparse`\n\n.. :class:`~pyarts3.arts.KroneckerCovariance`");
   bm.def(
       "__array__",
       [](py::object& v, py::object dtype, py::object copy) { return v.attr("matrix").attr("__array__")(dtype, copy); },
@@ -455,7 +486,9 @@ arr : :class:`scipy.sparse.csr_matrix`
   bm.def_prop_rw(
       "value",
       [](py::object& x) { return x.attr("__array__")("copy"_a = false); },
-      [](BlockMatrix& a, const std::variant<Matrix, Sparse>& b) { std::visit([&a](auto& c) { a = c; }, b); },
+      [](BlockMatrix& a, const std::variant<Matrix, Sparse, KroneckerCovariance>& b) {
+        std::visit([&a](auto& c) { a = c; }, b);
+      },
       "A python friendly version of the object.\n\n.. :class:`~numpy.ndarray`\n\n.. :class:`scipy.sparse.csr_matrix`");
   common_ndarray(bm);
   generic_interface(bm);
@@ -65,7 +65,25 @@ void py_auto_wsm(py::class_<Workspace>& ws);
 
 void py_workspace(py::class_<Workspace>& ws) try {
   generic_interface(ws);
-  ws.def_rw("wsv", &Workspace::wsv, "The workspace variables\n\n.. :class:`~pyarts3.arts.WsvMap`");
+  // The index table of the workspace must see every added or removed name,
+  // so the map is handed out as a read-only view of a shallow copy
+  ws.def_prop_rw(
+      "wsv",
+      [mapping_proxy = py::module_::import_("types").attr("MappingProxyType")](const Workspace& w) {
+        return mapping_proxy(py::cast(w.variables()));
+      },
+      [](Workspace& w, std::unordered_map<std::string, Wsv> v) {
+        WorkspaceCaches caches = std::move(w.caches);
+        w                      = Workspace{std::move(v)};
+        w.caches               = std::move(caches);
+      },
+      R"(The workspace variables
+
+The returned mapping is read-only, change the variables through
+attribute access or :meth:`set` and :meth:`init`.  Assigning a whole
+new map replaces all variables.
+
+.. :class:`~pyarts3.arts.WsvMap`)");
   ws.def(
         "__init__",
         [](Workspace* w, bool with_defaults) {
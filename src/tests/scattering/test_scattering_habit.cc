@@ -1,3 +1,4 @@
+#include <cmath>
 #include <iostream>
 
 #include "integration.h"
@@ -195,6 +196,42 @@ bool test_calculate_bulk_properties_tro_spectral() {
   return true;
 }
 
+// Test that the bulk property table reproduces the full integration at its nodes.
+bool test_bulk_properties_table() {
+  Vector                               t_grid{280.0, 290.0, 300.0};
+  Vector                               f_grid{10e9, 89e9, 183e9};
+  Vector                               diameters{50e-6, 500e-6, 1e-3};
+  scattering::IrregularZenithAngleGrid za_scat_grid = Vector{0.0, 30.0, 60.0, 90.0, 120.0, 150.0, 180.0};
+  auto  particle_habit = scattering::ParticleHabit::liquid_sphere(t_grid, f_grid, diameters, za_scat_grid);
+  Index l              = 7;
+  particle_habit       = particle_habit.to_tro_spectral(t_grid, f_grid, l);
+
+  ScatteringSpeciesProperty moment{"rain", ParticulateProperty::MassDensity};
+  auto psd              = scattering::MGDSingleMoment(moment, "Abel12", 0.0, 400.0, false);
+  auto scattering_habit = scattering::ScatteringHabit(particle_habit, psd);
+
+  AscendingGrid table_t_grid{280.0, 290.0, 300.0};
+  AscendingGrid moment_grid{1e-6, 1e-5, 1e-4, 1e-3};
+  const auto&   table = scattering_habit.set_bulk_table(table_t_grid, moment_grid, f_grid);
+  if (not std::isfinite(table.build_time) or not std::isfinite(table.max_rel_error)) return false;
+
+  auto point    = AtmPoint{1e4, 290.0};
+  point[moment] = 1e-4;
+
+  auto from_table = scattering_habit.get_bulk_scattering_properties_tro_spectral(point, f_grid, -1);
+  scattering_habit.clear_bulk_table();
+  auto integrated = scattering_habit.get_bulk_scattering_properties_tro_spectral(point, f_grid, -1);
+
+  for (Size f_ind = 0; f_ind < f_grid.size(); ++f_ind) {
+    Numeric err = std::abs(from_table.extinction_matrix[f_ind].A() - integrated.extinction_matrix[f_ind].A()) /
+                  integrated.extinction_matrix[f_ind].A();
+    if (err > 1e-10) return false;
+    err = max_rel_error(from_table.absorption_vector[f_ind], integrated.absorption_vector[f_ind]);
+    if (err > 1e-10) return false;
+  }
+  return true;
+}
+
 int main() {
   bool passed = false;
 
@@ -216,5 +253,14 @@ int main() {
     return 1;
   }
 
+  std::cout << "Test bulk properties table: \t";
+  passed = test_bulk_properties_table();
+  if (passed) {
+    std::cout << "PASSED." << '\n';
+  } else {
+    std::cout << "FAILED." << '\n';
+    return 1;
+  }
+
   return 0;
 }
@@ -6,8 +6,10 @@
 #include <debug.h>
 
 #include <algorithm>
+#include <array>
 #include <exception>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -19,12 +21,33 @@
 #include "workspace_class.h"
 #include "workspace_method_class.h"
 
+struct Agenda::parallel_plan {
+  std::vector<Agenda>      tasks{};
+  std::vector<std::string> outputs{};
+  std::vector<Size>        output_slots{};
+};
+
 void Agenda::add(const Method& method) {
   checked = false;
+  par_plan.reset();
   method.add_defaults_to_agenda(*this);
   methods.push_back(method);
 }
 
+void Agenda::compile() {
+  method_slots.clear();
+  method_offsets.clear();
+  max_args = 0;
+
+  method_offsets.push_back(0);
+  for (const Method& method : methods) {
+    for (auto& var : method.get_outs()) method_slots.push_back(Workspace::index(var));
+    for (auto& var : method.get_ins()) method_slots.push_back(Workspace::index(var));
+    method_offsets.push_back(method_slots.size());
+    max_args = std::max(max_args, method_offsets.back() - method_offsets[method_offsets.size() - 2]);
+  }
+}
+
 void Agenda::finalize(bool fix) try {
   const static auto& wsa = workspace_agendas();
 
@@ -123,7 +146,15 @@ Agenda required output: {:B,}
   copy  = in_then_out;
   share = ins_first;
 
+  compile();
   checked = true;
+
+  // Agendas that cannot run in parallel only fail if par_execute is called
+  try {
+    par_plan = std::make_shared<const parallel_plan>(make_parallel_plan());
+  } catch (std::exception&) {
+    par_plan.reset();
+  }
 } catch (std::exception& e) {
   throw std::runtime_error(std::format(R"(Cannot finalize agenda "{}"
 
@@ -139,6 +170,8 @@ void Agenda::set_name(const std::string& v, bool finalize_fix) {
 }
 
 void Agenda::share_workspace(Workspace& out, const Workspace& in) const try {
+  out.caches = in.caches;
+
   for (auto& str : share) {
     if (not out.contains(str)) out.set(str, in.share(str));
   }
@@ -177,6 +210,8 @@ startover:
 }  // namespace
 
 void Agenda::copy_workspace(Workspace& out, const Workspace& in) const try {
+  out.caches = in.caches;
+
   for (auto& str : share) out.set(str, in.share(str));
 
   //! If copy and share are the same, copy will overwrite share (keep them unique!)
@@ -207,6 +242,8 @@ Workspace contains:
 }
 
 void Agenda::copy_only_workspace(Workspace& out, const Workspace& in) const try {
+  out.caches = in.caches;
+
   for (auto& str : copy) {
     if (out.contains(str)) {
       out.overwrite(str, out.copy(str));
@@ -229,7 +266,31 @@ Workspace contains:
 }
 
 void Agenda::execute(Workspace& ws) const try {
-  for (auto& method : methods) method(ws);
+  if (not is_compiled()) {
+    for (auto& method : methods) method(ws);
+    return;
+  }
+
+  // The workspace keeps its variables by index, so no name is looked up
+  // here.  Most methods have few arguments, so they are gathered on the stack.
+  std::array<Wsv*, 32> small_args;
+  std::vector<Wsv*>    large_args;
+  std::span<Wsv*>      args{small_args};
+  if (max_args > small_args.size()) {
+    large_args.resize(max_args);
+    args = large_args;
+  }
+
+  for (Size i = 0; i < methods.size(); i++) {
+    const Method& method = methods[i];
+    const Size    first  = method_offsets[i];
+    const Size    nout   = method.get_outs().size();
+    const Size    nin    = method.get_ins().size();
+
+    for (Size j = 0; j < nout + nin; j++) args[j] = ws.slot(method_slots[first + j]);
+
+    if (not method(ws, args.first(nout), args.subspan(nout, nin))) method(ws);
+  }
 } catch (std::exception& e) {
   throw std::runtime_error(std::format(R"(Cannot execute "{}"
 
@@ -238,20 +299,22 @@ void Agenda::execute(Workspace& ws) const try {
                                        e.what()));
 }
 
-std::vector<Agenda> Agenda::par_tasks(Workspace& ws) const try {
-  ARTS_TIME_REPORT
-
+Agenda::parallel_plan Agenda::make_parallel_plan() const try {
   auto filter = stdv::filter([](const std::string& s) {
     return not s.starts_with(named_input_prefix) and not s.starts_with(internal_prefix);
   });
   auto concat = stdv::join | filter;
 
-  stdr::for_each(methods | stdv::transform(&Method::get_outs) | concat,
-                 [&ws](const std::string& o) { ws.init_if_new(o); });
+  parallel_plan plan{};
+  for (const std::string& o : methods | stdv::transform(&Method::get_outs) | concat) {
+    if (stdr::contains(plan.outputs, o)) continue;
+    plan.outputs.push_back(o);
+    plan.output_slots.push_back(Workspace::index(o));
+  }
 
   std::unordered_set<std::string> all_outputs{};
 
-  std::vector<Agenda>             tasks{};
+  std::vector<Agenda>&            tasks = plan.tasks;
   std::vector<Method>             task_methods{};
   std::string                     task_name{};
   std::unordered_set<std::string> task_output{};
@@ -329,7 +392,7 @@ std::vector<Agenda> Agenda::par_tasks(Workspace& ws) const try {
   }
   flush_batch();
 
-  return tasks;
+  return plan;
 } catch (std::exception& e) {
   throw std::runtime_error(std::format(R"(Cannot perform parallelization:
 
@@ -340,10 +403,27 @@ std::vector<Agenda> Agenda::par_tasks(Workspace& ws) const try {
                                        e.what()));
 }
 
+std::shared_ptr<const Agenda::parallel_plan> Agenda::prepare_parallel(Workspace& ws) const {
+  auto plan = par_plan ? par_plan : std::make_shared<const parallel_plan>(make_parallel_plan());
+
+  for (Size i = 0; i < plan->outputs.size(); i++) {
+    if (ws.slot(plan->output_slots[i]) == nullptr) ws.init(plan->outputs[i]);
+  }
+
+  return plan;
+}
+
+std::vector<Agenda> Agenda::par_tasks(Workspace& ws) const {
+  ARTS_TIME_REPORT
+
+  return prepare_parallel(ws)->tasks;
+}
+
 void Agenda::par_execute(Workspace& ws) const try {
   ARTS_TIME_REPORT
 
-  const auto tasks = par_tasks(ws);
+  const auto  plan  = prepare_parallel(ws);
+  const auto& tasks = plan->tasks;
 
   std::string error_message;
 
@@ -388,7 +468,9 @@ Agenda::Agenda(std::string                     n,
                const std::vector<std::string>& s,
                const std::vector<std::string>& c,
                bool                            check)
-    : name(std::move(n)), methods(m), share(s), copy(c), checked(check) {}
+    : name(std::move(n)), methods(m), share(s), copy(c), checked(check) {
+  compile();
+}
 
 std::string Agenda::sphinx_list(const std::string_view prep) const {
   std::string out{};
@@ -405,6 +487,8 @@ std::string Agenda::sphinx_list(const std::string_view prep) const {
 void Agenda::change_default(const std::string_view name, Wsv value) {
   assert(not name.empty());
 
+  par_plan.reset();
+
   for (Method& method : methods) {
     const auto& method_name = method.get_name();
     if (method_name.starts_with(internal_prefix) and method_name.ends_with(name)) {
@@ -3,6 +3,7 @@
 #include <array.h>
 #include <xml.h>
 
+#include <memory>
 #include <vector>
 
 class Method;
@@ -16,6 +17,24 @@ class Agenda {
   std::vector<std::string> copy{};
   bool                     checked{false};
 
+  //! The Workspace::index of the outputs and then the inputs of each method, back to back
+  std::vector<Size> method_slots{};
+
+  //! Where the slots of each method start in method_slots, one more than there are methods
+  std::vector<Size> method_offsets{};
+
+  //! The largest number of arguments of any method, the per-call buffer size of execute()
+  Size max_args{0};
+
+  //! The tasks of par_execute() and the variables they output, built by finalize
+  struct parallel_plan;
+  std::shared_ptr<const parallel_plan> par_plan{};
+
+  [[nodiscard]] parallel_plan make_parallel_plan() const;
+
+  //! The plan of finalize or a new one, after setting up its outputs on the workspace
+  [[nodiscard]] std::shared_ptr<const parallel_plan> prepare_parallel(Workspace& ws) const;
+
  public:
   Agenda(std::string name = "not-a-name");
 
@@ -39,6 +58,12 @@ class Agenda {
   //! Only copy the required workspace variables (ignores shared workspace variables)
   void copy_only_workspace(Workspace& out, const Workspace& in) const;
 
+  //! Resolves the variable names of all methods to workspace indices once, so that execute() looks up no names (called by finalize)
+  void compile();
+
+  //! True if compile() has been called since the last method was added
+  [[nodiscard]] bool is_compiled() const { return method_offsets.size() == methods.size() + 1; }
+
   //! Executes the agenda without checks on the current workspace
   void execute(Workspace& ws) const;
 
@@ -1,4 +1,4 @@
 #include "workspace_agenda_class.h"
 #include "workspace_method_class.h"
 
-Agenda::Agenda(std::string n) : name(std::move(n)), methods{} {}
+Agenda::Agenda(std::string n) : name(std::move(n)), methods{}, method_offsets{0} {}
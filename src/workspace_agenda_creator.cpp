@@ -84,12 +84,12 @@ Agenda get_spectral_rad_observer_agenda(const std::string_view option) {
   using enum spectral_rad_observer_agendaPredefined;
   switch (to<spectral_rad_observer_agendaPredefined>(option)) {
     case Emission:
-      agenda.add("ray_path_observer_agendaExecute");
+      agenda.add("ray_pathFromObserverAgenda");
       agenda.add("spectral_radClearskyEmission");
       agenda.add("spectral_rad_jacAddSensorJacobianPerturbations");
       break;
     case EmissionAdaptiveHalfsteps:
-      agenda.add("ray_path_observer_agendaExecute");
+      agenda.add("ray_pathFromObserverAgenda");
       agenda.add("ray_pointBackground");
       agenda.add("spectral_rad_bkgAgendasAtEndOfPath");
       agenda.add("atm_pathFromPath");
@@ -101,7 +101,7 @@ Agenda get_spectral_rad_observer_agenda(const std::string_view option) {
       agenda.add("spectral_rad_jacAddSensorJacobianPerturbations");
       break;
     case EmissionNoSensor:
-      agenda.add("ray_path_observer_agendaExecute");
+      agenda.add("ray_pathFromObserverAgenda");
       agenda.add("spectral_radClearskyEmission");
       break;
   }
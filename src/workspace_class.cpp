@@ -3,7 +3,9 @@
 #include <auto_wsv.h>
 #include <debug.h>
 
+#include <mutex>
 #include <ranges>
+#include <shared_mutex>
 #include <stdexcept>
 
 #include "enumsWorkspaceInitialization.h"
@@ -16,6 +18,18 @@ std::unordered_map<std::string, Wsv> from_global_defaults() {
   }
   return wsv;
 }
+
+struct variable_indices {
+  //! Fixed at start-up, read without a lock
+  std::unordered_map<std::string, Size> builtin{};
+
+  std::shared_mutex                     mtx{};
+  std::unordered_map<std::string, Size> other{};
+
+  variable_indices() {
+    for (auto& name : workspace_variables() | stdv::keys) builtin.try_emplace(name, builtin.size());
+  }
+};
 }  // namespace
 
 const std::unordered_map<std::string, Wsv>& global_wsv_defaults() {
@@ -23,6 +37,50 @@ const std::unordered_map<std::string, Wsv>& global_wsv_defaults() {
   return wsv;
 }
 
+Workspace::Workspace(WorkspaceInitialization how_to_initialize)
+    : wsv{WorkspaceInitialization::FromGlobalDefaults == how_to_initialize ? global_wsv_defaults()
+                                                                           : std::unordered_map<std::string, Wsv>{}} {
+  relink();
+}
+
+Workspace::Workspace(std::unordered_map<std::string, Wsv> variables) : wsv{std::move(variables)} { relink(); }
+
+Workspace::Workspace(const Workspace& other) : wsv{other.wsv}, caches{other.caches} { relink(); }
+
+Workspace& Workspace::operator=(const Workspace& other) {
+  if (this != &other) {
+    wsv    = other.wsv;
+    caches = other.caches;
+    relink();
+  }
+  return *this;
+}
+
+Size Workspace::index(const std::string& name) {
+  static variable_indices indices{};
+
+  if (auto ptr = indices.builtin.find(name); ptr != indices.builtin.end()) return ptr->second;
+
+  {
+    std::shared_lock lock{indices.mtx};
+    if (auto ptr = indices.other.find(name); ptr != indices.other.end()) return ptr->second;
+  }
+
+  std::unique_lock lock{indices.mtx};
+  return indices.other.try_emplace(name, indices.builtin.size() + indices.other.size()).first->second;
+}
+
+void Workspace::link(const std::string& name, Wsv* data) {
+  const Size i = index(name);
+  if (i >= slots.size()) slots.resize(i + 1, nullptr);
+  slots[i] = data;
+}
+
+void Workspace::relink() {
+  slots.clear();
+  for (auto& [name, data] : wsv) link(name, &data);
+}
+
 const Wsv& Workspace::share(const std::string& name) const try { return wsv.at(name); } catch (std::out_of_range&) {
   throw std::runtime_error(std::format("Cannot share workspace variable \"{}\" - is not set", name));
 }
@@ -42,7 +100,7 @@ void Workspace::set(const std::string& name, const Wsv& data) {
                       data.type_name()));
     }
 
-    wsv[name] = data;
+    link(name, &wsv.try_emplace(name, data).first->second);
   } else {
     if (not ptr->second.holds_same(data)) {
       throw std::runtime_error(std::format(R"(Workspace variable "{}" is of type "{}". It cannot be set to be a "{}")",
@@ -59,7 +117,7 @@ void Workspace::overwrite(const std::string& name, const Wsv& data) try {
   if (auto wsv_ptr = workspace_variables().find(name);
       wsv_ptr != workspace_variables().end() and wsv_ptr->second.type != data.type_name())
     throw wsv_ptr->second.type;
-  wsv[name] = data;
+  if (auto [ptr, is_new] = wsv.insert_or_assign(name, data); is_new) link(name, &ptr->second);
 } catch (const std::string& type) {
   throw std::runtime_error(
       std::format(R"(Cannot set built-in workspace variable "{}" of workspace group "{}" to type "{}")",
@@ -77,7 +135,11 @@ bool Workspace::wsv_and_contains(const std::string& name) const {
   return contains(name);
 }
 
-Size Workspace::erase(const std::string& name) { return wsv.erase(name); }
+Size Workspace::erase(const std::string& name) {
+  const Size n = wsv.erase(name);
+  if (n != 0) link(name, nullptr);
+  return n;
+}
 
 void Workspace::init(const std::string& name) try {
   set(name, Wsv::from_named_type(workspace_variables().at(name).type));
@@ -100,7 +162,7 @@ void xml_io_stream<Workspace>::write(std::ostream& os, const Workspace& x, bofst
   XMLTag tag(type_name, "name", name);
   tag.write_to_stream(os);
 
-  xml_write_to_stream(os, x.wsv, pbofs, "WSVs"sv);
+  xml_write_to_stream(os, x.variables(), pbofs, "WSVs"sv);
 
   tag.write_to_end_stream(os);
 }
@@ -110,7 +172,9 @@ void xml_io_stream<Workspace>::read(std::istream& is, Workspace& x, bifstream* p
   tag.read_from_stream(is);
   tag.check_name(type_name);
 
-  xml_read_from_stream(is, x.wsv, pbifs);
+  std::unordered_map<std::string, Wsv> variables{};
+  xml_read_from_stream(is, variables, pbifs);
+  x = Workspace{std::move(variables)};
 
   tag.read_from_stream(is);
   tag.check_end_name(type_name);
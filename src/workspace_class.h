@@ -6,16 +6,69 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 const std::unordered_map<std::string, Wsv>& global_wsv_defaults();
 
+namespace path {
+class geometry_cache;
+}  // namespace path
+
+namespace fwd {
+class propmat_species_cache;
+}  // namespace fwd
+
+/** Caches that a method sets up for the methods it calls
+
+  A Workspace shares its caches with its copies and with the workspaces
+  of the agendas that are executed on it.  The method that sets a cache
+  is responsible for keeping it valid.
+*/
+struct WorkspaceCaches {
+  //! Observed ray paths, see ray_pathFromObserverAgenda
+  std::shared_ptr<path::geometry_cache> ray_path{};
+
+  //! Species propagation matrices, see spectral_propmat_path_species_splitFromPath
+  std::shared_ptr<fwd::propmat_species_cache> propmat_species{};
+};
+
 struct Workspace {
+ private:
   std::unordered_map<std::string, Wsv> wsv;
 
-  Workspace(WorkspaceInitialization how_to_initialize = WorkspaceInitialization::FromGlobalDefaults)
-      : wsv{WorkspaceInitialization::FromGlobalDefaults == how_to_initialize ? global_wsv_defaults()
-                                                                             : std::unordered_map<std::string, Wsv>{}} {
-  }
+  //! The variables of wsv by their index(), nullptr where not set.  Map nodes are stable, so this only changes when wsv gains or loses a name
+  std::vector<Wsv*> slots{};
+
+  void link(const std::string& name, Wsv* data);
+  void relink();
+
+ public:
+  WorkspaceCaches caches{};
+
+  Workspace(WorkspaceInitialization how_to_initialize = WorkspaceInitialization::FromGlobalDefaults);
+
+  explicit Workspace(std::unordered_map<std::string, Wsv> variables);
+
+  Workspace(const Workspace&);
+  Workspace(Workspace&&) noexcept            = default;
+  Workspace& operator=(const Workspace&);
+  Workspace& operator=(Workspace&&) noexcept = default;
+
+  /** A process-wide index of a variable name
+   *
+   * Built-in workspace variables have fixed indices, other names are
+   * given the next free index the first time they are seen.
+   *
+   * @param name The name of a variable
+   * @return The index to use with slot()
+   */
+  [[nodiscard]] static Size index(const std::string& name);
+
+  //! The variable at index(name) or nullptr if it is not set, without any name lookup
+  [[nodiscard]] Wsv* slot(Size i) const { return i < slots.size() ? slots[i] : nullptr; }
+
+  //! All variables by name
+  [[nodiscard]] const std::unordered_map<std::string, Wsv>& variables() const { return wsv; }
 
   //! Returns a shared pointer to the workspace variable with the given name.
   [[nodiscard]] const Wsv& share(const std::string& name) const;
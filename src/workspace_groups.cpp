@@ -201,7 +201,9 @@ contain.
       .desc =
           R"(The data for a single *Block*, likely part of a *CovarianceMatrix*.
 
-This holds either a shared *Matrix* or a shared *Sparse* matrix.
+This holds either a shared *Matrix*, a shared *Sparse* matrix, or a shared
+Kronecker-factorised covariance matrix.  The latter is never formed, and
+products with its inverse are computed by triangular solves.
 )",
   };
 
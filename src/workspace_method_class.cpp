@@ -22,7 +22,7 @@ Method::Method() : name("this-is-not-a-method") {}
 Method::Method(const std::string&                                  n,
                const std::vector<std::string>&                     a,
                const std::unordered_map<std::string, std::string>& kw) try
-    : name(n), outargs(wsms.at(name).out), inargs(wsms.at(name).in) {
+    : name(n), outargs(wsms.at(name).out), inargs(wsms.at(name).in), record(&wsms.at(name)) {
   const std::size_t nargout = outargs.size();
   const std::size_t nargin  = inargs.size();
 
@@ -140,6 +140,27 @@ Method::Method(std::string n, const Wsv& wsv, bool overwrite)
 
 bool Method::is_callback() const { return setval.has_value() and setval->holds<CallbackOperator>(); }
 
+namespace {
+std::runtime_error method_error(const std::string&              name,
+                                const std::vector<std::string>& outargs,
+                                const std::vector<std::string>& inargs,
+                                const std::exception&           e) {
+  return std::runtime_error(std::format(R"(Cannot execute method {}
+        
+Method outputs: {:B,}
+Method inputs:  {:B,}
+(NOTE: "{}" and "{}" prefixes are used for default and user inputs, respectively)
+
+{})",
+                                        name,
+                                        inargs,
+                                        outargs,
+                                        internal_prefix,
+                                        named_input_prefix,
+                                        std::string_view(e.what())));
+}
+}  // namespace
+
 void Method::operator()(Workspace& ws) const try {
   if (setval) {
     if (const Wsv& wsv = setval.value(); wsv.holds<CallbackOperator>()) {
@@ -152,24 +173,31 @@ void Method::operator()(Workspace& ws) const try {
       }
     }
   } else {
-    wsms.at(name).func(ws, outargs, inargs);
+    (record ? *record : wsms.at(name)).func(ws, outargs, inargs);
   }
 } catch (std::out_of_range&) {
   throw std::runtime_error(std::format("No method named \"{}\"", name));
 } catch (std::exception& e) {
-  throw std::runtime_error(std::format(R"(Cannot execute method {}
-        
-Method outputs: {:B,}
-Method inputs:  {:B,}
-(NOTE: "{}" and "{}" prefixes are used for default and user inputs, respectively)
+  throw method_error(name, outargs, inargs, e);
+}
 
-{})",
-                                       name,
-                                       inargs,
-                                       outargs,
-                                       internal_prefix,
-                                       named_input_prefix,
-                                       std::string_view(e.what())));
+bool Method::operator()(Workspace& ws, std::span<Wsv* const> out, std::span<Wsv* const> in) const try {
+  if (stdr::contains(out, nullptr) or stdr::contains(in, nullptr)) return false;
+
+  if (setval) {
+    // Same as Workspace::set and Workspace::overwrite when the variable exists with the right type
+    const Wsv& wsv = setval.value();
+    if (wsv.holds<CallbackOperator>() or not out.front()->holds_same(wsv)) return false;
+    *out.front() = wsv.copied();
+    return true;
+  }
+
+  if (record == nullptr or not record->slot_func) return false;
+
+  record->slot_func(ws, out, in);
+  return true;
+} catch (std::exception& e) {
+  throw method_error(name, outargs, inargs, e);
 }
 
 void Method::add_defaults_to_agenda(Agenda& agenda) const {
@@ -186,7 +214,11 @@ Method::Method(const std::string&              n,
                const std::vector<std::string>& outs,
                const std::optional<Wsv>&       wsv,
                bool                            overwrite)
-    : name(n), outargs(outs), inargs(ins), setval(wsv), overwrite_setval(overwrite) {}
+    : name(n), outargs(outs), inargs(ins), setval(wsv), overwrite_setval(overwrite) {
+  if (not setval) {
+    if (auto ptr = wsms.find(name); ptr != wsms.end()) record = &ptr->second;
+  }
+}
 
 std::string std::formatter<Wsv>::to_string(const Wsv& wsv) const { return wsv.vformat("{}"sv); }
 
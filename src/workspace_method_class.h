@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -13,12 +14,15 @@
 inline constexpr char named_input_prefix = '@';
 inline constexpr char internal_prefix    = '_';
 
+struct WorkspaceMethodRecord;
+
 class Method {
-  std::string              name{};
-  std::vector<std::string> outargs{};
-  std::vector<std::string> inargs{};
-  std::optional<Wsv>       setval{std::nullopt};
-  bool                     overwrite_setval{false};
+  std::string                  name{};
+  std::vector<std::string>     outargs{};
+  std::vector<std::string>     inargs{};
+  std::optional<Wsv>           setval{std::nullopt};
+  bool                         overwrite_setval{false};
+  const WorkspaceMethodRecord* record{nullptr};
 
  public:
   Method();
@@ -39,6 +43,15 @@ class Method {
   [[nodiscard]] bool                            overwrite() const { return overwrite_setval; }
 
   void operator()(Workspace& ws) const;
+
+  /** Calls the method on variables that a compiled agenda has already resolved
+   *
+   * @param ws The workspace the variables live in
+   * @param out The outputs, in the order of get_outs()
+   * @param in The inputs, in the order of get_ins()
+   * @return false if nothing was done and the method must be called by name instead
+   */
+  [[nodiscard]] bool operator()(Workspace& ws, std::span<Wsv* const> out, std::span<Wsv* const> in) const;
   void add_defaults_to_agenda(Agenda& agenda) const;
 
   [[nodiscard]] std::string sphinx_list_item() const;
@@ -695,6 +695,11 @@ The IGRF model is available via :cite:t:`Alken2021`.
     to support retrievals of the magnetic field via Legendre coefficients, or
     use *atm_fieldAbsoluteMagneticField*, which allow returning the magnitude
     of the magnetic field.
+
+.. note::
+    All three components are computed by a single evaluation of the model when
+    the full atmospheric point is extracted.  Use *atm_fieldIGRFGridded* instead
+    if the field is needed at very many points.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"atm_field"},
@@ -705,6 +710,27 @@ The IGRF model is available via :cite:t:`Alken2021`.
       .gin_desc  = {"Time of data to use"},
   };
 
+  wsm_data["atm_fieldIGRFGridded"] = {
+      .desc      = R"--(Use IGRF to compute the magnetic field on a grid.
+
+This is *atm_fieldIGRF* evaluated once at every grid point and stored as
+a *GeodeticField3* for each component.  Evaluating the field at a position
+is then an interpolation instead of a spherical harmonics sum, which is
+much faster for calculations that need the field at many points.
+
+All components are set to use nearest-neighbor extrapolation outside the grid.
+
+The IGRF model is available via :cite:t:`Alken2021`.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"atm_field"},
+      .in        = {"atm_field"},
+      .gin       = {"time", "alt", "lat", "lon"},
+      .gin_type  = {"Time", "AscendingGrid", "LatGrid", "LonGrid"},
+      .gin_value = {Time{}, std::nullopt, std::nullopt, std::nullopt},
+      .gin_desc  = {"Time of data to use", "Altitude grid", "Latitude grid", "Longitude grid"},
+  };
+
   wsm_data["atm_fieldSchmidthFieldFromIGRF"] = {
       .desc =
           R"--(For forward calculations, this should be similar to *atm_fieldIGRF*.
@@ -2552,6 +2578,15 @@ This is only for LTE lines in Voigt.
       .desc      = R"--(Add line-by-line absorption to the propagation matrix.
 
 See :doc:`concept.absorption.lookup` for details.
+
+The derivatives for temperature, pressure and volume mixing ratio targets
+are computed analytically from the derivatives of the interpolation weights.
+Wind targets get the derivative with respect to frequency (per Hz), as for
+the other methods that add to *spectral_propmat*.  Use *spectral_propmat_jacWindFix*
+to convert these to derivatives with respect to the wind (per m/s).
+
+Both *spectral_propmat* and *spectral_propmat_jac* are added to, so they
+must be initialized, e.g., by *spectral_propmatInit*.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"spectral_propmat", "spectral_propmat_jac"},
@@ -3323,6 +3358,39 @@ The pressure range is set up logarithmically and all other ranges are set linear
                     "Number of steps in the water vapor perturbation"},
   };
 
+  wsm_data["abs_lookup_dataSaveMapped"] = {
+      .desc      = R"--(Saves *abs_lookup_data* to a single binary file that can be memory-mapped.
+
+The cross sections of each species are stored page-aligned, so that
+*abs_lookup_dataReadMapped* can map them directly from the file.
+The file is only readable on systems with the same byte order.
+)--",
+      .author    = {"Richard Larsson"},
+      .in        = {"abs_lookup_data"},
+      .gin       = {"filename"},
+      .gin_type  = {"String"},
+      .gin_value = {std::nullopt},
+      .gin_desc  = {"The file to write"},
+  };
+
+  wsm_data["abs_lookup_dataReadMapped"] = {
+      .desc      = R"--(Reads *abs_lookup_data* from a file written by *abs_lookup_dataSaveMapped*.
+
+Only the grids are read.  The cross sections of a species are mapped
+read-only from the file the first time that species is used, so large
+tables load immediately.  All processes on a machine that map the same
+file share one copy of the cross sections in memory.
+
+The file must not be changed while it is mapped.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"abs_lookup_data"},
+      .gin       = {"filename"},
+      .gin_type  = {"String"},
+      .gin_value = {std::nullopt},
+      .gin_desc  = {"The file to read"},
+  };
+
   wsm_data["abs_bandsReadSpeciesSplitCatalog"] = {
       .desc      = R"--(Reads all species in *abs_species* from a basename
 
@@ -3335,14 +3403,27 @@ ignore_missing is a boolean that indicates if the method should
 ignore missing files or not.  If set to true, the method will
 ignore missing files and continue.  If set to false, the method
 will throw an error if any file is missing.
+
+If an indexed file, e.g., ``"lbl/H2O-161.lbl"`` as created by
+*abs_bandsSaveSplitIndexed*, exists, it is read instead of the XML file.
+Only the bands with lines in the frequency window are then read from it.
+
+The result is the same as calling *abs_bandsSelectFrequencyByLine* with
+``fmin`` and ``fmax`` after reading.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"abs_bands"},
       .in        = {"abs_species"},
-      .gin       = {"basename", "ignore_missing"},
-      .gin_type  = {"String", "Index"},
-      .gin_value = {std::nullopt, Index{0}},
-      .gin_desc  = {"Absolute or relative path to the directory", "Ignore missing files instead of throwing an error"},
+      .gin       = {"basename", "ignore_missing", "fmin", "fmax"},
+      .gin_type  = {"String", "Index", "Numeric", "Numeric"},
+      .gin_value = {std::nullopt,
+                    Index{0},
+                    -std::numeric_limits<Numeric>::infinity(),
+                    std::numeric_limits<Numeric>::infinity()},
+      .gin_desc  = {"Absolute or relative path to the directory",
+                    "Ignore missing files instead of throwing an error",
+                    "Minimum frequency to keep",
+                    "Maximum frequency to keep"},
   };
 
   wsm_data["abs_bandsReadSpeciesSplitARTSCAT"] = {
@@ -3403,6 +3484,28 @@ variables are not considered
       .gin_desc  = {"Absolute or relative path to the directory"},
   };
 
+  wsm_data["abs_bandsSaveSplitIndexed"] = {
+      .desc      = R"--(Saves all bands in *abs_bands* to a directory in the indexed binary format
+
+Works as *abs_bandsSaveSplit* but the bands are stored as H2O-161.lbl,
+H2O-162.lbl, O2-66.lbl, and so on.  Each file holds an index of the
+frequency range of its bands, so that *abs_bandsReadSpeciesSplitCatalog*
+reads only the bands with lines in its frequency window and does
+not parse any text.
+
+The files are stored in the native byte order and are not meant to
+be shared between ARTS versions.  Files written by an ARTS with other
+species, quantum numbers or line shape options are rejected when read.
+Keep the XML files as the catalogue and create the indexed files from them.
+)--",
+      .author    = {"Richard Larsson"},
+      .in        = {"abs_bands"},
+      .gin       = {"dir"},
+      .gin_type  = {"String"},
+      .gin_value = {std::nullopt},
+      .gin_desc  = {"Absolute or relative path to the directory"},
+  };
+
   wsm_data["ray_pathAddGeometricGridCrossings"] = {
       .desc =
           R"--(Fill the path with with points that crosses the grid of the atmspheric field.
@@ -3680,6 +3783,68 @@ bad angles if this is turned off.
                     "Whether or not to search for the surface intersection in a safer but slower manner"},
   };
 
+  wsm_data["ray_pathRefractive"] = {
+      .desc      = R"--(Get a refractive radiation path
+
+The path is defined by the origo and the line of sight, see *ray_pathGeometric*
+for the meaning of ``as_observer``.
+
+The ray equation is integrated through the atmosphere with an embedded
+Dormand-Prince 5(4) Runge-Kutta scheme.  The step length adapts so that the
+estimated position error of each step is below ``tolerance`` meters, but it is
+never longer than *max_stepsize*.  Paths are thus sparse where the refractive
+index changes slowly, e.g., far from the tangent point of limb paths.  The last
+point is put at the top of the atmosphere or on the surface.
+
+The refractive index is the microwave refractivity of moist air:
+
+.. math::
+
+    n = 1 + 10^{-6} \left(k_1 \frac{p - e}{T} + k_2 \frac{e}{T} + k_3 \frac{e}{T^2}\right)
+
+where :math:`p` is the pressure, :math:`e` the partial pressure of water vapour,
+and :math:`T` the temperature in *atm_field*.  The coefficients are given in SI units
+by ``refractivity_coefficients``, the default being those of Bevis et al. (1994).
+Water vapour is ignored if it is not in *atm_field*.
+
+Paths starting in space are straight until they reach the top of the atmosphere.
+
+If ``remove_non_atm`` is true, all points that are not in the atmosphere are
+removed.
+
+If ``fix_updown_azi`` is true, the azimuthal angle of the path is
+fixed to the initial azimuthal angle of the path.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"ray_path"},
+      .in        = {"atm_field", "surf_field", "max_stepsize"},
+      .gin       = {"pos",
+                    "los",
+                    "tolerance",
+                    "refractivity_coefficients",
+                    "surf_search_accuracy",
+                    "as_observer",
+                    "remove_non_atm",
+                    "fix_updown_azi"},
+      .gin_type  = {"Vector3", "Vector2", "Numeric", "Vector3", "Numeric", "Index", "Index", "Index"},
+      .gin_value = {std::nullopt,
+                    std::nullopt,
+                    Numeric{0.1},
+                    Vector3{0.776, 0.704, 3739.0},
+                    Numeric{0.1},
+                    Index{1},
+                    Index{1},
+                    Index{1}},
+      .gin_desc  = {"The origo of the radiation path",
+                    "The line of sight of the radiation path",
+                    "The allowed position error of a single step [m]",
+                    "The refractivity coefficients k1 [K/Pa], k2 [K/Pa], and k3 [K^2/Pa]",
+                    "The accuracy of the final point of the path [m]",
+                    "Whether or not the path is as seen by the sensor or by the radiation (see *ray_pathGeometric*)",
+                    "Whether or not to keep only atmospheric points",
+                    "Whether or not to attempt fix a potential issue with the path azimuthal angle"},
+  };
+
   wsm_data["ray_pathFromPointAndDepth"] = {
       .desc      = R"--(Create a depth profile ray path from a point.
 )--",
@@ -4861,6 +5026,10 @@ for the linear system that has to be solved in each minimization step.
 This of advantage for very large problems, that would otherwise require
 the computation of expensive matrix products.
 
+Observed ray paths are cached for the duration of the inversion.  The cache is
+cleared whenever a retrieved atmospheric quantity or the surface elevation
+changes.  See *ray_pathFromObserverAgenda*.
+
 Description of the special input arguments:
 
     - ``method``:
@@ -4919,6 +5088,17 @@ Description of the special input arguments:
     - ``display_progress``:
 
       Controls if there is any screen output. The overall report level is ignored by this WSM.
+
+    - ``reuse_species_propmat``:
+
+      With this flag set to 1, *spectral_propmat_path_species_splitFromPath* reuses
+      the propagation matrix of a species at a path point from an earlier iteration
+      if the frequency grid and the atmospheric point are unchanged.  Changes
+      in the volume mixing ratios of the other retrieved species are then
+      ignored, i.e., their effect on the absorption of this species, as
+      broadening species or in continua, is assumed negligible.  Species
+      whose line parameters are retrieved are always recomputed.  At most
+      about 1 GiB of propagation matrices is kept, the oldest are dropped first.
 )",
       .author         = {"Patrick Eriksson"},
       .out            = {"model_state_vec",
@@ -4956,8 +5136,9 @@ Description of the special input arguments:
                          "stop_dx",
                          "lm_ga_settings",
                          "clear_matrices",
-                         "display_progress"},
-      .gin_type       = {"String", "Numeric", "Vector", "Index", "Numeric", "Vector", "Index", "Index"},
+                         "display_progress",
+                         "reuse_species_propmat"},
+      .gin_type       = {"String", "Numeric", "Vector", "Index", "Numeric", "Vector", "Index", "Index", "Index"},
       .gin_value      = {std::nullopt,
                          Numeric{std::numeric_limits<Numeric>::infinity()},
                          Vector{},
@@ -4965,6 +5146,7 @@ Description of the special input arguments:
                          Numeric{0.01},
                          Vector{},
                          Index{0},
+                         Index{0},
                          Index{0}},
       .gin_desc       = {"Iteration method. For this and all options below, see further above",
                          "Maximum allowed value of cost function at start",
@@ -4973,7 +5155,8 @@ Description of the special input arguments:
                          "Stop criterion for iterative inversions",
                          "Settings associated with the ga factor of the LM method",
                          "An option to save memory",
-                         "Flag to control if inversion diagnostics shall be printed on the screen"},
+                         "Flag to control if inversion diagnostics shall be printed on the screen",
+                         "Flag to reuse the propagation matrix of species that are not retrieved"},
       .pass_workspace = true,
   };
 
@@ -5475,11 +5658,20 @@ CDisort is only included for testing and comparisons with our own disort impleme
 #endif
 
   wsm_data["disort_spectral_flux_fieldCalc"] = {
-      .desc   = R"(Perform Disort calculations for spectral flux.
+      .desc      = R"(Perform Disort calculations for spectral flux.
+
+The frequencies are solved in batches of *batch_size*.  The banded systems
+of equations of a batch are solved together, which vectorizes the elimination
+over the frequencies.  Each thread holds *batch_size* models, so memory use
+grows with it.  A *batch_size* of 1 solves each frequency with LAPACK.
 )",
-      .author = {"Richard Larsson"},
-      .out    = {"disort_spectral_flux_field"},
-      .in     = {"disort_settings"},
+      .author    = {"Richard Larsson"},
+      .out       = {"disort_spectral_flux_field"},
+      .in        = {"disort_settings"},
+      .gin       = {"batch_size"},
+      .gin_type  = {"Index"},
+      .gin_value = {Index{4}},
+      .gin_desc  = {"The number of frequencies that are solved together"},
   };
 
   wsm_data["disort_spectral_flux_fieldCoupledCalc"] = {
@@ -5674,6 +5866,31 @@ Additional work is requires if proper coverage of the limb is required
       .pass_workspace = true,
   };
 
+  wsm_data["ray_pathFromObserverAgenda"] = {
+      .desc =
+          R"(Get the observed ray path from *ray_path_observer_agenda*, reusing cached paths when allowed.
+
+Paths are only reused while the workspace has a ray path cache.  *OEM* gives
+the workspaces of its agendas one for the duration of the retrieval.  It
+forgets all paths whenever the retrieved surface elevation or a retrieved
+quantity of the refractive index changes:
+
+- Paths traced by geometric methods only depend on the surface elevation.
+- *ray_pathRefractive* also depends on temperature, pressure, and water vapour.
+- Other methods that read *atm_field* or execute an agenda may depend on any
+  atmospheric quantity, e.g., free electrons, so all retrieved atmospheric
+  quantities are watched.
+
+A cached path is reused if the observer position and line of sight match exactly.
+
+Without a cache, this is the same as executing *ray_path_observer_agenda*.
+)",
+      .author         = {"Richard Larsson"},
+      .out            = {"ray_path"},
+      .in             = {"obs_pos", "obs_los", "ray_path_observer_agenda"},
+      .pass_workspace = true,
+  };
+
   wsm_data["subsurf_profileFromPath"] = {
       .desc =
           R"(Extract a subsurface profile from a ray path.
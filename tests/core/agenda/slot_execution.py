@@ -0,0 +1,86 @@
+import copy
+import numpy as np
+import pyarts3 as pyarts
+
+
+@pyarts.arts_agenda
+def agenda(ws: pyarts.Workspace):
+    ws.abs_speciesSet(species=["H2O", "CO2"])
+    ws.freq_grid = [1e9, 2e9, 3e9]
+    ws.measurement_sensorInit()
+    ws.measurement_sensorAddSimple(pos=[3, 4, 5], los=[6, 7])
+    ws.jac_targetsInit()
+
+
+# Not finalized, so executed by variable name
+by_name = agenda
+
+# Finalized, so executed through the workspace indices
+by_slot = copy.copy(agenda)
+by_slot.finalize()
+
+
+def run(ag, with_defaults):
+    ws = pyarts.Workspace(with_defaults)
+    ag.execute(ws)
+    return ws
+
+
+for with_defaults in [True, False]:
+    ref = run(by_name, with_defaults)
+    ws = run(by_slot, with_defaults)
+
+    assert ws.abs_species == ref.abs_species
+    assert np.allclose(ws.freq_grid, ref.freq_grid)
+    assert len(ws.measurement_sensor) == len(ref.measurement_sensor) > 0
+    for a, b in zip(ws.measurement_sensor, ref.measurement_sensor):
+        assert np.allclose(a.f_grid, b.f_grid)
+        assert str(a.poslos) == str(b.poslos)
+    assert sorted(ws.wsv.keys()) == sorted(ref.wsv.keys())
+
+# The compiled agenda sees variables set between executions
+ws = pyarts.Workspace()
+by_slot.execute(ws)
+n = len(ws.measurement_sensor)
+ws.abs_species = ["O2"]
+by_slot.execute(ws)
+assert ws.abs_species == ["H2O", "CO2"]
+assert len(ws.measurement_sensor) == n
+
+# Missing input gives the same outcome on both paths
+@pyarts.arts_agenda
+def missing(ws: pyarts.Workspace):
+    ws.measurement_sensorAddSimple(pos=[3, 4, 5], los=[6, 7])
+
+
+missing_slot = copy.copy(missing)
+missing_slot.finalize()
+
+
+def outcome(ag):
+    ws = pyarts.Workspace(False)
+    try:
+        ag.execute(ws)
+    except RuntimeError:
+        return None
+    return len(ws.measurement_sensor)
+
+
+assert outcome(missing) == outcome(missing_slot)
+
+# The parallel path gives the same outputs as the serial one
+ws = pyarts.Workspace()
+by_slot.par_execute(ws)
+assert ws.abs_species == ref.abs_species
+assert len(ws.measurement_sensor) == len(ref.measurement_sensor)
+
+# The variable map is read-only, so changes cannot bypass the workspace
+ws = pyarts.Workspace()
+name = next(iter(ws.wsv))
+try:
+    del ws.wsv[name]
+except TypeError:
+    pass
+else:
+    assert False, "ws.wsv must not be writable"
+assert name in ws.wsv
@@ -0,0 +1,31 @@
+import numpy as np
+import pyarts3 as pyarts
+
+fop = pyarts.recipe.SpectralAtmosphericFlux(
+    species=["H2O-161", "O2-66", "N2-44", "CO2-626"],
+    remove_lines_percentile={"H2O": 90},
+)
+
+# 7 frequencies, so the batches of 2 and 4 have a partial batch at the end
+kays = np.linspace(600, 700, 7)
+flux, alts = fop(pyarts.arts.convert.kaycm2freq(kays))
+
+# Copies, as the recipe may return views of the workspace field
+up = np.array(flux.up)
+down_diffuse = np.array(flux.diffuse_down)
+down_direct = np.array(flux.direct_down)
+
+ws = fop.ws
+for batch_size in [1, 2, 4, 16]:
+    ws.disort_spectral_flux_fieldCalc(batch_size=batch_size)
+    field = ws.disort_spectral_flux_field
+    assert np.allclose(field.up, up, rtol=1e-10), batch_size
+    assert np.allclose(field.down_diffuse, down_diffuse, rtol=1e-10), batch_size
+    assert np.allclose(field.down_direct, down_direct, rtol=1e-10), batch_size
+
+try:
+    ws.disort_spectral_flux_fieldCalc(batch_size=0)
+except Exception:
+    pass
+else:
+    assert False, "A batch size of 0 must be rejected"
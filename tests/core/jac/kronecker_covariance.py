@@ -0,0 +1,26 @@
+import pyarts3 as pyarts
+import numpy as np
+
+z = np.linspace(0, 10e3, 7)
+lat = np.array([-10.0, 0.0, 5.0, 20.0])
+sd = np.linspace(1.0, 2.0, len(z) * len(lat))
+lz, llat = 2e3, 8.0
+
+kc = pyarts.arts.KroneckerCovariance.exponential(sd, [z, lat], [lz, llat])
+
+# Reference, with the last grid varying fastest
+rz = np.exp(-np.abs(z[:, None] - z[None, :]) / lz)
+rlat = np.exp(-np.abs(lat[:, None] - lat[None, :]) / llat)
+ref = np.diag(sd) @ np.kron(rz, rlat) @ np.diag(sd)
+
+assert np.allclose(kc.dense(), ref, rtol=1e-12, atol=0)
+assert np.allclose(kc.diagonal(), np.diag(ref), rtol=1e-12, atol=0)
+
+inv = kc.inverted()
+assert inv.inverse
+assert np.allclose(inv.dense() @ ref, np.eye(len(sd)), atol=1e-8)
+assert np.allclose(inv.diagonal(), np.diag(np.linalg.inv(ref)), rtol=1e-8)
+
+# A zero correlation length means no correlation along that grid
+kc = pyarts.arts.KroneckerCovariance.exponential(sd, [z, lat], [0.0, llat])
+assert np.allclose(kc.dense(), np.diag(sd) @ np.kron(np.eye(len(z)), rlat) @ np.diag(sd))
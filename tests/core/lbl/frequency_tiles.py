@@ -0,0 +1,43 @@
+import pyarts3 as pyarts
+import numpy as np
+
+# Dense around the 557 GHz water line and sparse elsewhere, so that the
+# frequency tiles see very different numbers of lines
+f = np.unique(
+    np.concatenate(
+        [np.linspace(1e9, 1000e9, 1001), np.linspace(550e9, 565e9, 4001)]
+    )
+)
+
+ws = pyarts.Workspace()
+
+ws.abs_speciesSet(species=["H2O-161", "O2-66"])
+ws.ReadCatalogData()
+ws.abs_bandsSelectFrequencyByLine(fmax=2000e9)
+for key in ws.abs_bands:
+    ws.abs_bands[key].cutoff = "ByLine"
+    ws.abs_bands[key].cutoff_value = 25e9
+
+ws.jac_targetsInit()
+ws.atm_pointInit()
+ws.atm_point.temperature = 250
+ws.atm_point.pressure = 1e4
+ws.atm_point[pyarts.arts.SpeciesEnum("O2")] = 0.21
+ws.atm_point[pyarts.arts.SpeciesEnum("H2O")] = 0.01
+ws.atm_point.mag = [40e-6, 20e-6, 10e-6]
+
+
+def calc(ws, freqs):
+    ws.freq_grid = freqs
+    ws.spectral_propmatInit()
+    ws.spectral_propmatAddLines()
+    return 1.0 * ws.spectral_propmat[:, 0]
+
+
+# All at once, in tiles when there are threads
+tiled = calc(ws, f)
+
+# One frequency at a time, all bands in one go
+for i in range(0, len(f), 97):
+    single = calc(ws, f[i : i + 1])
+    assert np.allclose(tiled[i], single[0], rtol=1e-10, atol=0), (f[i], tiled[i], single[0])
@@ -0,0 +1,45 @@
+import pyarts3 as pyarts
+import numpy as np
+import os
+import tempfile
+
+fmin = 40e9
+fmax = 600e9
+
+
+def summary(bands):
+    out = {}
+    for key, band in bands.items():
+        out[str(key)] = [(line.f0, line.a, line.e0, line.gu, line.gl) for line in band.lines]
+    return out
+
+
+ws = pyarts.Workspace()
+
+ws.abs_speciesSet(species=["O2-66", "H2O-161"])
+ws.ReadCatalogData()
+
+ref_all = summary(ws.abs_bands)
+
+ws.abs_bandsSelectFrequencyByLine(fmin=fmin, fmax=fmax)
+ref = summary(ws.abs_bands)
+
+with tempfile.TemporaryDirectory() as tmp:
+    ws.ReadCatalogData()
+    ws.abs_bandsSaveSplitIndexed(dir=tmp)
+    assert os.path.isfile(os.path.join(tmp, "O2-66.lbl"))
+    assert os.path.isfile(os.path.join(tmp, "H2O-161.lbl"))
+
+    # Only the bands with lines in the window
+    ws.abs_bandsReadSpeciesSplitCatalog(basename=tmp + "/", fmin=fmin, fmax=fmax)
+    res = summary(ws.abs_bands)
+    assert res.keys() == ref.keys(), (len(res), len(ref))
+    for key in ref:
+        assert np.allclose(np.sort(np.array(res[key]), axis=0), np.sort(np.array(ref[key]), axis=0)), key
+
+    # Everything
+    ws.abs_bandsReadSpeciesSplitCatalog(basename=tmp + "/")
+    res = summary(ws.abs_bands)
+    assert res.keys() == ref_all.keys(), (len(res), len(ref_all))
+    for key in ref_all:
+        assert np.allclose(np.sort(np.array(res[key]), axis=0), np.sort(np.array(ref_all[key]), axis=0)), key
@@ -0,0 +1,96 @@
+import pyarts3 as pyarts
+import numpy as np
+
+
+toa = 100e3
+
+# %% Setup workspace
+
+ws = pyarts.Workspace()
+
+ws.abs_speciesSet(species=["H2O-161", "O2-66"])
+
+ws.ReadCatalogData()
+ws.abs_bands.keep_hitran_s(70)
+
+ws.surf_fieldPlanet(option="Earth")
+ws.surf_field["t"] = 295.0
+
+ws.atm_fieldRead(
+    toa=toa, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+# Train on one grid and evaluate between its points
+table_grid = np.linspace(1e9, 400e9, 400)
+ws.freq_grid = table_grid
+ws.abs_lookup_dataCalc(
+    lat=0.0,
+    lon=0.0,
+    alt_grid=np.linspace(0, toa, 101),
+    temperature_perturbation=np.linspace(-30, 30, 7),
+    water_perturbation=np.logspace(-1, 1, 7),
+    water_affected_species=["H2O"],
+)
+f = 0.5 * (table_grid[1:] + table_grid[:-1])
+
+ws.ray_point.pos = [5e3, 0, 0]
+ws.ray_point.los = [40, 20]
+
+
+def propmat(key=None, dx=0.0):
+    ws.atm_point = ws.atm_field(*ws.ray_point.pos)
+    if key is not None:
+        ws.atm_point[key] = ws.atm_point[key] + dx
+
+    ws.freq_grid = f
+    ws.freq_gridWindShift()
+    ws.spectral_propmatInit()
+    ws.spectral_propmatAddLookup(
+        p_interp_order=3, t_interp_order=3, water_interp_order=3, f_interp_order=3
+    )
+    ws.spectral_propmat_jacWindFix()
+
+    return ws.spectral_propmat[:, 0] * 1.0, ws.spectral_propmat_jac[:, :, 0] * 1.0
+
+
+# %% Compare each analytical derivative to central finite differences
+
+atm = ws.atm_field(*ws.ray_point.pos)
+
+targets = {
+    "t": (lambda: ws.jac_targetsAddTemperature(), pyarts.arts.AtmKey("t"), 1e-2),
+    "p": (lambda: ws.jac_targetsAddPressure(), pyarts.arts.AtmKey("p"), 1e-4 * atm[pyarts.arts.AtmKey("p")]),
+    "H2O": (
+        lambda: ws.jac_targetsAddSpeciesVMR(species="H2O"),
+        pyarts.arts.SpeciesEnum("H2O"),
+        1e-4 * atm[pyarts.arts.SpeciesEnum("H2O")],
+    ),
+    "O2": (
+        lambda: ws.jac_targetsAddSpeciesVMR(species="O2"),
+        pyarts.arts.SpeciesEnum("O2"),
+        1e-4 * atm[pyarts.arts.SpeciesEnum("O2")],
+    ),
+}
+for c in "uvw":
+    targets[f"wind_{c}"] = (
+        lambda c=c: ws.jac_targetsAddWindField(component=c),
+        pyarts.arts.AtmKey(f"wind_{c}"),
+        1e-1,
+    )
+
+for name, (add, key, dx) in targets.items():
+    ws.jac_targetsInit()
+    add()
+    ws.jac_targetsFinalize(measurement_sensor=[])
+
+    x0, dx0 = propmat()
+    assert np.all(x0 > 0), name
+
+    x1, _ = propmat(key, dx)
+    x2, _ = propmat(key, -dx)
+    d = (x1 - x2) / (2 * dx)
+
+    assert np.any(dx0[0] != 0), f"No analytical derivative for {name}"
+    assert np.allclose(
+        dx0[0], d, rtol=1e-3, atol=1e-6 * np.max(np.abs(d))
+    ), f"{name}: max relative error {np.max(np.abs(dx0[0] - d) / np.max(np.abs(d)))}"
@@ -0,0 +1,75 @@
+import copy
+import os
+import tempfile
+import numpy as np
+import pyarts3 as pyarts
+
+
+toa = 100e3
+
+ws = pyarts.Workspace()
+
+ws.abs_speciesSet(species=["H2O-161", "O2-66"])
+
+ws.ReadCatalogData()
+ws.abs_bands.keep_hitran_s(70)
+
+ws.atm_fieldRead(
+    toa=toa, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+ws.freq_grid = np.linspace(1e9, 400e9, 100)
+ws.abs_lookup_dataCalc(
+    lat=0.0,
+    lon=0.0,
+    alt_grid=np.linspace(0, toa, 11),
+    temperature_perturbation=np.linspace(-30, 30, 3),
+    water_perturbation=np.logspace(-1, 1, 3),
+    water_affected_species=["H2O"],
+)
+orig = copy.copy(ws.abs_lookup_data)
+
+with tempfile.TemporaryDirectory() as d:
+    fn = os.path.join(d, "lookup.bin")
+
+    # Save, map back and compare
+    ws.abs_lookup_dataSaveMapped(filename=fn)
+    ws.abs_lookup_dataReadMapped(filename=fn)
+
+    atm = ws.atm_field(5e3, 0, 0)
+    for key in orig:
+        table = ws.abs_lookup_data[key]
+        assert table.mapped
+        assert np.allclose(table.f_grid, orig[key].f_grid)
+        assert np.allclose(table.log_p_grid, orig[key].log_p_grid)
+        assert np.allclose(
+            ws.abs_lookup_data.spectral_propmat(f=ws.freq_grid, atm=atm, spec=key),
+            orig.spectral_propmat(f=ws.freq_grid, atm=atm, spec=key),
+        )
+
+    # Assigning the cross sections drops the mapping
+    key = next(iter(orig))
+    table = ws.abs_lookup_data[key]
+    table.xsec = np.zeros_like(orig[key].xsec)
+    assert not table.mapped
+    assert np.allclose(
+        ws.abs_lookup_data.spectral_propmat(f=ws.freq_grid, atm=atm, spec=key),
+        0.0,
+    )
+
+    # Materializing keeps the values
+    ws.abs_lookup_dataReadMapped(filename=fn)
+    table = ws.abs_lookup_data[key]
+    table.materialize()
+    assert not table.mapped
+    assert np.allclose(table.xsec, orig[key].xsec)
+
+    # Saving over the file keeps the tables mapped from it intact
+    other = pyarts.Workspace()
+    other.abs_lookup_dataReadMapped(filename=fn)
+    ws.abs_lookup_data = copy.copy(orig)
+    ws.abs_lookup_data[key].xsec = 2 * orig[key].xsec
+    ws.abs_lookup_dataSaveMapped(filename=fn)
+    assert other.abs_lookup_data[key].mapped
+    assert np.allclose(other.abs_lookup_data[key].xsec, orig[key].xsec)
+    assert os.listdir(d) == ["lookup.bin"]
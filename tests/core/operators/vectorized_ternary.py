@@ -0,0 +1,59 @@
+import pyarts3 as pyarts
+import numpy as np
+
+calls = []
+
+
+def temperature(alt, lat, lon):
+    calls.append(np.size(alt))
+    return 300.0 - 6.5e-3 * np.asarray(alt) + 0.1 * np.asarray(lat)
+
+
+def pressure(alt, lat, lon):
+    return 1e5 * np.exp(-np.asarray(alt) / 8e3)
+
+
+ws = pyarts.workspace.Workspace()
+
+ws.surf_fieldPlanet(option="Earth")
+ws.atm_fieldInit(toa=100e3)
+ws.atm_field["t"] = pyarts.arts.NumericTernaryOperator(temperature, vectorized=True)
+ws.atm_field["p"] = pyarts.arts.NumericTernaryOperator(pressure, vectorized=True)
+
+# A single position is a batch of one
+assert np.isclose(ws.atm_field["t"].data(10e3, 5.0, 0.0), 235.5)
+calls.clear()
+
+ws.ray_pathGeometric(pos=[100e3, 5, 0], los=[180.0, 0.0], max_stepsize=1000.0)
+ws.atm_pathFromPath()
+
+# One call for the whole path
+assert len(calls) == 1, calls
+assert calls[0] == len(ws.ray_path), (calls, len(ws.ray_path))
+
+for point, atm in zip(ws.ray_path, ws.atm_path):
+    alt, lat, lon = point.pos
+    assert np.isclose(atm.temperature, temperature(alt, lat, lon))
+    assert np.isclose(atm.pressure, pressure(alt, lat, lon))
+
+# A function that returns a scalar is broadcast to all positions
+ws.atm_field["t"] = pyarts.arts.NumericTernaryOperator(
+    lambda alt, lat, lon: 250.0, vectorized=True
+)
+ws.atm_pathFromPath()
+assert all(atm.temperature == 250.0 for atm in ws.atm_path)
+
+
+# The positions are read-only views
+def writes(alt, lat, lon):
+    alt[0] = 0.0
+    return 250.0
+
+
+ws.atm_field["t"] = pyarts.arts.NumericTernaryOperator(writes, vectorized=True)
+failed = False
+try:
+    ws.atm_pathFromPath()
+except Exception:
+    failed = True
+assert failed, "Writing to the positions should fail"
@@ -0,0 +1,149 @@
+import numpy as np
+import pyarts3 as pyarts
+
+# OEM caches the observed ray paths.  The retrievals below must give exactly
+# what they give when every path is traced again.
+
+NF = 21
+line_f0 = 118750348044.712
+
+ws = pyarts.workspace.Workspace()
+
+ws.freq_grid = np.linspace(-2e9, 2e9, NF) + line_f0
+ws.abs_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.abs_bandsSelectFrequencyByLine(fmin=118e9, fmax=119e9)
+ws.WignerInit()
+ws.spectral_propmat_agendaAuto()
+
+ws.surf_fieldPlanet(option="Earth")
+ws.surf_field["t"] = 295.0
+ws.atm_fieldRead(toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1)
+
+temps = [295, 230, 220, 250]
+
+
+def reset():
+    ws.surf_field["t"] = 295.0
+    ws.atm_field["t"] = pyarts.arts.GriddedField3(
+        name="Temperature",
+        data=np.array(temps, dtype=float).reshape(4, 1, 1),
+        grid_names=["Altitude", "Latitude", "Longitude"],
+        grids=[[0, 10e3, 40e3, 100e3], [0], [0]],
+    )
+
+
+reset()
+
+ws.spectral_rad_transform_operatorSet(option="Tb")
+ws.max_stepsize = 1e3
+
+
+# The refractive index depends on temperature, so its paths change with it
+@pyarts.workspace.arts_agenda(ws=ws, fix=True)
+def ray_path_observer_agenda(ws):
+    ws.ray_pathRefractive(pos=ws.obs_pos, los=ws.obs_los)
+
+
+@pyarts.workspace.arts_agenda(ws=ws, fix=True)
+def inversion_iterate_agenda(ws):
+    ws.UpdateModelStates()
+    ws.measurement_vecFromSensor()
+    ws.measurement_vec_fitFromMeasurement()
+
+
+def uncached():
+    # Traces every path, for reference
+    @pyarts.workspace.arts_agenda(ws=ws, fix=True)
+    def spectral_rad_observer_agenda(ws):
+        ws.ray_path_observer_agendaExecute()
+        ws.spectral_radClearskyEmission()
+        ws.spectral_rad_jacAddSensorJacobianPerturbations()
+
+
+def cached():
+    ws.spectral_rad_observer_agendaSet(option="Emission")
+
+
+ws.measurement_sensorSimple(pos=[110e3, 0, 0], los=[140.0, 0.0])
+
+
+def retrieve(setup, observer_agenda):
+    reset()
+    observer_agenda()
+    ws.RetrievalInit()
+    setup()
+    ws.RetrievalFinalizeDiagonal()
+
+    ws.measurement_vecFromSensor()
+    ws.measurement_vec += np.linspace(-1, 1, NF)
+
+    ws.measurement_vec_fit = []
+    ws.model_state_vec = []
+    ws.measurement_jac = [[]]
+    ws.model_state_vec_aprioriFromData()
+    ws.measurement_vec_error_covmatConstant(value=0.5**2)
+
+    ws.OEM(method="gn", max_iter=3)
+    return np.array(ws.model_state_vec), np.array(ws.measurement_vec_fit)
+
+
+def surface():
+    ws.RetrievalAddSurface(target=pyarts.arts.SurfaceKey.t, matrix=np.diag([100.0]))
+
+
+def temperature():
+    ws.RetrievalAddTemperature(matrix=np.diag(np.ones(4) * 10))
+
+
+# Paths are reused between iterations when only the surface temperature is retrieved
+x0, y0 = retrieve(surface, uncached)
+x1, y1 = retrieve(surface, cached)
+assert np.allclose(x0, x1, rtol=1e-12, atol=0), (x0, x1)
+assert np.allclose(y0, y1, rtol=1e-12, atol=0), (y0, y1)
+
+# Retrieving temperature changes the refracted paths, so the cache must forget them
+x0, y0 = retrieve(temperature, uncached)
+x1, y1 = retrieve(temperature, cached)
+assert not np.allclose(x0, temps), "The retrieval must move the temperature"
+assert np.allclose(x0, x1, rtol=1e-12, atol=0), (x0, x1)
+assert np.allclose(y0, y1, rtol=1e-12, atol=0), (y0, y1)
+
+# Volume mixing ratios do not enter geometric paths, so the path of the
+# measurement is traced only once by OEM even as oxygen is retrieved
+traced = [0]
+
+
+def count_traced(obs_pos):
+    traced[0] += 1
+
+
+@pyarts.workspace.arts_agenda(ws=ws, fix=True)
+def ray_path_observer_agenda(ws):
+    ws.ray_pathGeometric(pos=ws.obs_pos, los=ws.obs_los)
+    count_traced()
+
+
+def oxygen():
+    ws.atm_field["O2"] = pyarts.arts.GriddedField3(
+        name="O2",
+        data=np.array([0.21, 0.21, 0.2, 0.19]).reshape(4, 1, 1),
+        grid_names=["Altitude", "Latitude", "Longitude"],
+        grids=[[0, 10e3, 40e3, 100e3], [0], [0]],
+    )
+    ws.RetrievalAddSpeciesVMR(species="O2", matrix=np.diag(np.ones(4) * 1e-2))
+
+
+traced[0] = 0
+x0, y0 = retrieve(oxygen, uncached)
+uncached_traced = traced[0]
+
+traced[0] = 0
+x1, y1 = retrieve(oxygen, cached)
+assert not np.allclose(x0, [0.21, 0.21, 0.2, 0.19]), "The retrieval must move the VMR"
+assert np.allclose(x0, x1, rtol=1e-12, atol=0), (x0, x1)
+assert np.allclose(y0, y1, rtol=1e-12, atol=0), (y0, y1)
+
+# One path for the simulated measurement and one for the first OEM iteration
+assert uncached_traced > 2, uncached_traced
+assert traced[0] == 2, traced[0]
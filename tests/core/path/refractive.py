@@ -0,0 +1,35 @@
+import pyarts3 as pyarts
+import numpy as np
+
+R = 6371e3
+
+ws = pyarts.workspace.Workspace()
+
+ws.surf_fieldPlanet(option="Earth")
+ws.surf_field.ellipsoid = [R, R]
+ws.atm_fieldInit(toa=100e3)
+ws.atm_field["t"] = 250.0
+ws.atm_field["p"] = pyarts.arts.NumericTernaryOperator(lambda alt, lat, lon: 1e5 * np.exp(-alt / 7e3))
+
+pos = [600e3, 0, 0]
+los = [113.7, 30.0]
+
+# No refractivity gives the geometric path
+ws.ray_pathGeometric(pos=pos, los=los, max_stepsize=1e3)
+geometric = [p.pos for p in ws.ray_path]
+ws.ray_pathRefractive(pos=pos, los=los, max_stepsize=1e5, refractivity_coefficients=[0, 0, 0])
+assert np.allclose(ws.ray_path[-1].pos, geometric[-1], atol=1e-5), (ws.ray_path[-1].pos, geometric[-1])
+
+ws.ray_pathRefractive(pos=pos, los=los, max_stepsize=1e5, tolerance=1e-3)
+refractive = ws.ray_path
+
+# Far fewer points than a geometric path with a similar accuracy
+assert len(refractive) < len(geometric) / 4, (len(refractive), len(geometric))
+
+# The refracted ray bends towards the surface
+assert min(p.pos[0] for p in refractive) < min(p[0] for p in geometric) - 100
+
+# Bouguer's rule, n r sin(za) is constant in a spherically symmetric atmosphere,
+# the last point is ignored as it is snapped to the boundary
+c = [p.nreal * (R + p.pos[0]) * np.sin(np.deg2rad(p.los[0])) for p in refractive[:-1]]
+assert np.allclose(c, c[0], rtol=1e-7, atol=0), np.ptp(c) / c[0]
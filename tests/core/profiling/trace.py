@@ -0,0 +1,75 @@
+import json
+import pyarts3 as pyarts
+
+glob = pyarts.arts.globals
+
+N = 5
+
+
+def find(node, name):
+    if node.name == name:
+        return node
+    for child in node.children:
+        found = find(child, name)
+        if found is not None:
+            return found
+    return None
+
+
+def calls(ws):
+    for _ in range(N):
+        ws.abs_speciesSet(species=["H2O", "O2"])
+
+
+ws = pyarts.Workspace()
+
+# Nothing is recorded while profiling is off
+glob.set_profiling(False)
+glob.profile_trace(clear=True)
+calls(ws)
+assert not glob.profiling()
+assert find(glob.profile_trace().tree(), "abs_speciesSet") is None
+
+# Recorded scopes are merged into a tree
+glob.set_profiling(True)
+calls(ws)
+trace = glob.profile_trace(clear=False)
+glob.set_profiling(False)
+
+tree = trace.tree()
+node = find(tree, "abs_speciesSet")
+assert node is not None
+assert node.calls == N
+assert 0 <= node.min <= node.max <= node.total
+assert node.self <= node.total
+assert abs(tree.total - sum(x.total for x in tree.children)) <= 1e-12 * tree.total
+
+# The Chrome trace has one complete event per call
+chrome = json.loads(trace.chrome_trace())
+events = [e for e in chrome["traceEvents"] if e["name"] == "abs_speciesSet"]
+assert len(events) == N
+assert all(e["ph"] == "X" and e["dur"] >= 0 for e in events)
+
+# Speedscope opens and closes each call, in order
+speedscope = json.loads(trace.speedscope())
+frame = [f["name"] for f in speedscope["shared"]["frames"]].index("abs_speciesSet")
+assert len(speedscope["profiles"]) == len(trace.threads)
+for profile in speedscope["profiles"]:
+    assert profile["type"] == "evented"
+    depth = 0
+    for e in profile["events"]:
+        depth += 1 if e["type"] == "O" else -1
+        assert depth >= 0
+    assert depth == 0
+opened = sum(1 for p in speedscope["profiles"] for e in p["events"] if e["type"] == "O" and e["frame"] == frame)
+assert opened == N
+
+# The recorded scopes are cleared once collected
+glob.profile_trace(clear=True)
+assert find(glob.profile_trace().tree(), "abs_speciesSet") is None
+
+# Turning profiling back on after the buffers were released records again
+glob.set_profiling(True)
+calls(ws)
+glob.set_profiling(False)
+assert find(glob.profile_trace().tree(), "abs_speciesSet").calls == N
@@ -0,0 +1,89 @@
+import pyarts3 as pyarts
+import numpy as np
+
+NF = 101
+
+ws = pyarts.workspace.Workspace()
+
+# %% Sampled frequency range
+
+line_f0 = 118750348044.712
+f = np.linspace(-5e6, 5e6, NF) + line_f0
+
+# %% Species and line absorption
+
+ws.abs_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.abs_bandsSelectFrequencyByLine(fmin=118e9, fmax=119e9)
+ws.spectral_propmat_agendaAuto()
+
+# %% Grids and planet
+
+ws.surf_fieldPlanet(option="Earth")
+ws.surf_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atm_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+ws.spectral_rad_transform_operatorSet(option="Tb")
+ws.ray_path_observer_agendaSetGeometric()
+
+# %% Sensor
+
+pos = [100e3, 0, 0]
+los = [180.0, 0.0]
+
+ws.measurement_sensorSimpleGaussian(freq_grid=f, std=1e5, pos=pos, los=los, pol="RC")
+ws.measurement_sensorAddSimpleGaussian(
+    freq_grid=f, std=1e5, pos=pos, los=los, pol="Ih"
+)
+
+ws.RetrievalInit()
+ws.RetrievalAddSensorFrequencyPolyOffset(
+    sensor_elem=0, d=1e3, matrix=np.diag(np.ones((1)) * 1e10), polyorder=0
+)
+ws.RetrievalFinalizeDiagonal()
+
+
+def compare():
+    """The high-performance kernel against the low-memory one"""
+    ws.measurement_vecFromSensor(kernel="High Performance")
+    y = np.array(ws.measurement_vec)
+    dy = np.array(ws.measurement_jac)
+
+    ws.measurement_vecFromSensor(kernel="Low Memory")
+    assert np.allclose(y, ws.measurement_vec), "Bad measurement vector"
+    assert np.allclose(dy, ws.measurement_jac), "Bad measurement Jacobian"
+    return y
+
+
+# %% The operator of the sensor is assembled, then reused
+
+y0 = compare()
+assert np.allclose(y0, compare())
+
+# %% New weights on the same grids
+
+ws.measurement_sensor.normalize([1, 0, 0, 0])
+compare()
+
+# %% New frequency grids
+
+ws.measurement_sensorSimpleGaussian(
+    freq_grid=f + 1e6, std=1e5, pos=pos, los=los, pol="RC"
+)
+ws.measurement_sensorAddSimpleGaussian(
+    freq_grid=f + 1e6, std=1e5, pos=pos, los=los, pol="Ih"
+)
+y2 = compare()
+assert not np.allclose(y0, y2)
+
+# %% New position
+
+ws.measurement_sensorSimpleGaussian(
+    freq_grid=f, std=1e5, pos=[90e3, 0, 0], los=los, pol="RC"
+)
+ws.measurement_sensorAddSimpleGaussian(
+    freq_grid=f, std=1e5, pos=[90e3, 0, 0], los=los, pol="Ih"
+)
+compare()